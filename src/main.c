@@ -26,6 +26,11 @@
 
 #include "saturn-application.h"
 
+#define APPLICATION_ID "net.kolunmi.Saturn"
+
+static gboolean
+primary_is_running (void);
+
 static void
 init_ecl_thread (SaturnApplication *app);
 
@@ -37,6 +42,7 @@ main (int   argc,
       char *argv[])
 {
   g_autoptr (SaturnApplication) app = NULL;
+  g_autoptr (GError) local_error    = NULL;
   g_autoptr (GThread) init_ecl      = NULL;
   int ret                           = 0;
 
@@ -44,6 +50,29 @@ main (int   argc,
   bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
   textdomain (GETTEXT_PACKAGE);
 
+  app = saturn_application_new (APPLICATION_ID, G_APPLICATION_DEFAULT_FLAGS);
+
+  /* a secondary instance only hands its command line over to the primary
+     one and exits, so it has no use for lisp, which takes a while to boot.
+     Only then do we register up front, since that also runs startup, which
+     the primary instance should only get to once lisp is booted */
+  if (primary_is_running ())
+    {
+      if (!g_application_register (G_APPLICATION (app), NULL, &local_error))
+        {
+          g_printerr ("Unable to register: %s\n", local_error->message);
+          return 1;
+        }
+
+      if (g_application_get_is_remote (G_APPLICATION (app)))
+        return g_application_run (G_APPLICATION (app), argc, argv);
+
+      /* the primary instance quit in the meantime and we took its place,
+         with startup run before the command line was parsed, so this one
+         can't become resident. Nothing touches lisp until the init thread
+         is done, so booting it now is still fine */
+    }
+
   ecl_set_option (ECL_OPT_TRAP_SIGFPE, 0);
   ecl_set_option (ECL_OPT_TRAP_SIGINT, 0);
   ecl_set_option (ECL_OPT_TRAP_SIGILL, 0);
@@ -54,7 +83,6 @@ main (int   argc,
   ecl_set_option (ECL_OPT_SIGNAL_HANDLING_THREAD, 0);
   g_assert (cl_boot (argc, argv) != 0);
 
-  app      = saturn_application_new ("net.kolunmi.Saturn", G_APPLICATION_DEFAULT_FLAGS);
   init_ecl = g_thread_new ("Init ECL", (GThreadFunc) init_ecl_thread, g_object_ref (app));
   ret      = g_application_run (G_APPLICATION (app), argc, argv);
 
@@ -65,6 +93,38 @@ main (int   argc,
   return ret;
 }
 
+/* The GDBus worker thread this starts is the only one to exist before
+   cl_boot(), and it never runs any lisp */
+static gboolean
+primary_is_running (void)
+{
+  g_autoptr (GDBusConnection) bus = NULL;
+  g_autoptr (GVariant) reply      = NULL;
+  gboolean has_owner              = FALSE;
+
+  bus = g_bus_get_sync (G_BUS_TYPE_SESSION, NULL, NULL);
+  if (bus == NULL)
+    /* there is no primary instance to forward to without a bus either */
+    return FALSE;
+
+  reply = g_dbus_connection_call_sync (
+      bus,
+      "org.freedesktop.DBus",
+      "/org/freedesktop/DBus",
+      "org.freedesktop.DBus",
+      "NameHasOwner",
+      g_variant_new ("(s)", APPLICATION_ID),
+      G_VARIANT_TYPE ("(b)"),
+      G_DBUS_CALL_FLAGS_NONE,
+      -1,
+      NULL,
+      NULL);
+  if (reply != NULL)
+    g_variant_get (reply, "(b)", &has_owner);
+
+  return has_owner;
+}
+
 extern void init_lib_SATURN_CL_DEPS (cl_object);
 
 static void
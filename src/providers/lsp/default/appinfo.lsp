@@ -35,123 +35,38 @@
                    (home-dir-path ".local/share/flatpak/exports/share/"))))
    :test #'equal))
 
-(progn
-  (defconstant +desktop-group-key+ "Desktop Entry")
-
-  (defconstant +desktop-type-key+             "Type")
-  (defconstant +desktop-version-key+          "Version")
-  (defconstant +desktop-name-key+             "Name")
-  (defconstant +desktop-generic-name-key+     "GenericName")
-  (defconstant +desktop-no-display-key+       "NoDisplay")
-  (defconstant +desktop-comment-key+          "Comment")
-  (defconstant +desktop-icon-key+             "Icon")
-  (defconstant +desktop-hidden-key+           "Hidden")
-  (defconstant +desktop-only-show-in-key+     "OnlyShowIn")
-  (defconstant +desktop-not-show-in-key+      "NotShowIn")
-  (defconstant +desktop-try-exec-key+         "TryExec")
-  (defconstant +desktop-exec-key+             "Exec")
-  (defconstant +desktop-path-key+             "Path")
-  (defconstant +desktop-terminal-key+         "Terminal")
-  (defconstant +desktop-mime-type-key+        "MimeType")
-  (defconstant +desktop-categories-key+       "Categories")
-  (defconstant +desktop-startup-notify-key+   "StartupNotify")
-  (defconstant +desktop-startup-wm-class-key+ "StartupWMClass")
-  (defconstant +desktop-url-key+              "URL")
-  (defconstant +desktop-dbus-activatable-key+ "DBusActivatable")
-  (defconstant +desktop-actions-key+          "Actions")
-  (defconstant +desktop-keywords-key+         "Keywords")
-
-  (defconstant +desktop-application-type+     "Application")
-  (defconstant +desktop-link-type+            "Link")
-  (defconstant +desktop-directory-type+       "Directory")
-  )
-
-(defstruct app-info
-  desktop-file
-  desktop-name
-  desktop-exec
-  keywords
-  needs-terminal
-  startup-notify
-  icon-name)
-
-(defun read-app-infos-from-system ()
-  (labels ((keep-desktop-files (files)
-             (loop for file in files
-                   for extension = (pathname-type file)
-                   when (equal extension "desktop")
-                     collect file))
-           (make-data-dirs ()
-             (remove-duplicates
-              (append (mapcar #'(lambda (x)
-                                  (merge-pathnames
-                                   (concatenate 'string
-                                                "/run/host"
-                                                (uiop:unix-namestring x)
-                                                "/")))
-                              (uiop:xdg-data-dirs))
-                      *extra-data-dirs*)
-              :test #'equal))
-           (collect-desktop-files ()
-             (let ((data-dirs (make-data-dirs)))
-               (apply #'append
-                      (loop for data-dir in data-dirs
-                            for appsdir = (uiop:subpathname data-dir "applications/")
-                            for files = (uiop:directory-files appsdir)
-                            collect (keep-desktop-files files)))))
-           (file-to-info (file)
-             (let* ((keyfile
-                      (let ((keyfile (g:key-file-new)))
-                        (g:key-file-load-from-file keyfile file :none)
-                        keyfile))
-                    (desktop-name
-                      (g:key-file-string keyfile
-                                         +desktop-group-key+
-                                         +desktop-name-key+))
-                    (desktop-exec
-                      (g:key-file-string keyfile
-                                         +desktop-group-key+
-                                         +desktop-exec-key+))
-                    (desktop-categories
-                      (g:key-file-string keyfile
-                                         +desktop-group-key+
-                                         +desktop-categories-key+))
-                    (desktop-categories-list
-                      (split-sequence:split-sequence #\;
-                                                     desktop-categories
-                                                     :remove-empty-subseqs t))
-                    (desktop-keywords
-                      (g:key-file-string keyfile
-                                         +desktop-group-key+
-                                         +desktop-keywords-key+))
-                    (desktop-keywords-list
-                      (split-sequence:split-sequence #\;
-                                                     desktop-keywords
-                                                     :remove-empty-subseqs t))
-                    (keywords-list (append desktop-categories-list
-                                           desktop-keywords-list))
-                    (needs-terminal
-                      (g:key-file-boolean keyfile
-                                          +desktop-group-key+
-                                          +desktop-terminal-key+))
-                    (startup-notify
-                      (g:key-file-boolean keyfile
-                                          +desktop-group-key+
-                                          +desktop-startup-notify-key+))
-                    (icon-name
-                      (g:key-file-string keyfile
-                                         +desktop-group-key+
-                                         +desktop-icon-key+)))
-               (make-app-info :desktop-file file
-                              :desktop-name desktop-name
-                              :desktop-exec desktop-exec
-                              :keywords keywords-list
-                              :needs-terminal needs-terminal
-                              :startup-notify startup-notify
-                              :icon-name icon-name))))
-    (mapcar #'file-to-info (collect-desktop-files))))
-
-(defvar *app-infos* (read-app-infos-from-system))
+;; desktop entries are parsed natively and cached along with the mtimes of
+;; their directories (see saturn-appinfo-catalogue.c), so a warm start
+;; doesn't parse a single one of them
+(defun app-info-desktop-file (info)
+  (g:object-property info "desktop-file"))
+(defun app-info-desktop-name (info)
+  (g:object-property info "name"))
+(defun app-info-desktop-exec (info)
+  (g:object-property info "exec"))
+(defun app-info-needs-terminal (info)
+  (g:object-property info "needs-terminal"))
+(defun app-info-startup-notify (info)
+  (g:object-property info "startup-notify"))
+(defun app-info-icon-name (info)
+  (g:object-property info "icon-name"))
+
+(defun application-dirs ()
+  (mapcar #'(lambda (data-dir)
+              (uiop:unix-namestring
+               (uiop:subpathname data-dir "applications/")))
+          (remove-duplicates
+           (append (mapcar #'(lambda (x)
+                               (merge-pathnames
+                                (concatenate 'string
+                                             "/run/host"
+                                             (uiop:unix-namestring x)
+                                             "/")))
+                           (uiop:xdg-data-dirs))
+                   *extra-data-dirs*)
+           :test #'equal)))
+
+(saturn:appinfo-catalogue-load (application-dirs))
 
 
 (gobject:define-gobject-subclass
@@ -179,11 +94,9 @@
         <property name=\"spacing\">6</property>
         <child>
           <object class=\"GtkImage\">
-            <binding name=\"icon-name\">
-              <lookup name=\"string\" type=\"GtkStringObject\">
-                <lookup name=\"obj1\" type=\"SaturnAppinfoResult\">
-                  <lookup name=\"item\">SaturnAppinfoResultListItem</lookup>
-                </lookup>
+            <binding name=\"paintable\">
+              <lookup name=\"obj1\" type=\"SaturnAppinfoResult\">
+                <lookup name=\"item\">SaturnAppinfoResultListItem</lookup>
               </lookup>
             </binding>
             <property name=\"icon-size\">large</property>
@@ -236,55 +149,47 @@
   nil)
 
 (defun query (provider object store)
-  (let* ((str (gtk:string-object-string object))
-         (tokens (saturn:extract-tokens str)))
+  (let ((str (gtk:string-object-string object)))
     (unless (> (length str) 0)
       (return-from query))
-    (loop for info in *app-infos*
-          for desktop-name = (app-info-desktop-name info)
-          for keywords = (append (list desktop-name)
-                                 (app-info-keywords info))
-          for icon-name = (app-info-icon-name info)
-          when (and desktop-name
-                    icon-name
-                    (saturn:match-str-tokens tokens keywords))
-            do (saturn:submit-result
-                (let ((result (make-instance 'appinfo-result
-                                             :obj0 (gtk:string-object-new desktop-name)
-                                             :obj1 (gtk:string-object-new icon-name))))
-                  (setf (g:object-data result "info") info)
-                  result)
-                store provider))))
+    ;; the catalogue keeps a casefolded prefix index of every entry's name,
+    ;; categories and keywords, swapped together with the entries whenever
+    ;; a desktop file changes. results are built natively, obj0 being the
+    ;; name, obj1 the icon, usually prefetched right after the catalogue
+    ;; loaded (see saturn-icon-cache.c), and obj2 the entry itself
+    (saturn:appinfo-query str store provider "SaturnAppinfoResult")))
 
 (defun score (provider item query)
   (let* ((str (gtk:string-object-string query))
-         (info (g:object-data item "info"))
+         (info (g:object-property item "obj2"))
          (name (app-info-desktop-name info)))
     (* 100 (saturn:generic-str-score str name))))
 
 (defun select (provider item query)
-  (let* ((info (g:object-data item "info"))
-         (desktop-file (uiop:unix-namestring (app-info-desktop-file info)))
+  (let* ((info (g:object-property item "obj2"))
+         (desktop-file (app-info-desktop-file info))
          (run-host (search "/run/host" desktop-file)))
     (when (and run-host
                (= run-host 0))
       (setf desktop-file (subseq desktop-file (length "/run/host"))))
-    (uiop:run-program (list "flatpak-spawn"
-                            "--host"
-                            "gio"
-                            "launch"
-                            desktop-file))
+    ;; returns right away, failures are logged and show up as a
+    ;; notification since the window is already gone by then
+    (saturn:launch-async (list "flatpak-spawn"
+                               "--host"
+                               "gio"
+                               "launch"
+                               desktop-file))
     (make-instance 'saturn:selection-event
                    :kind :close
                    :selected-text (app-info-desktop-name info))))
 
 (defun bind-preview (provider item)
-  (let* ((info (g:object-data item "info"))
+  (let* ((info (g:object-property item "obj2"))
          (name (app-info-desktop-name info))
          (icon-name (app-info-icon-name info))
          (image
            (saturn:make-widget
             'gtk:image
-            (:props (:icon-name icon-name
+            (:props (:paintable (saturn:icon-cache-lookup icon-name 256)
                      :pixel-size 256)))))
     image))
@@ -22,6 +22,13 @@
                      "--host"
                      "/var/home/linuxbrew/.linuxbrew/bin/brew"))
 
+;; every formula is listed once with this and searched locally from then
+;; on, since each brew invocation boots a ruby interpreter on the host
+(defvar *brew-index-cmd* (append *brew-cmd* '("search" "--desc" "/./")))
+;; seconds before the local index is considered stale and listed again in
+;; the background
+(defvar *brew-index-max-age* (* 24 60 60))
+
 (gobject:define-gobject-subclass
     "SaturnBrewResult"
     brew-result
@@ -124,44 +131,23 @@
     (let ((str (gtk:string-object-string object)))
       (unless (>= (length str) *min-query-length*)
         (return-from query))
-      (labels ((run-cmd ()
-                 (ignore-errors
-                  (uiop:run-program (append *brew-cmd*
-                                            (list "search"
-                                                  "--desc"
-                                                  str))
-                                    :output :string)))
-               (make-result (pkg-name pkg-desc)
-                 (make-instance 'brew-result
-                                :obj0 (gtk:string-object-new pkg-name)
-                                :obj1 (gtk:string-object-new pkg-desc)))
-               (process-line (line)
-                 (let* ((colon-idx (search ":" line)))
-                   (unless colon-idx
-                     (return-from process-line))
-                   (let ((pkg-name (subseq line 0 colon-idx))
-                         (pkg-desc (subseq line (1+ colon-idx))))
-                     (unless (and pkg-name pkg-desc)
-                       (return-from process-line))
-                     (let ((result (make-result pkg-name pkg-desc)))
-                       (saturn:submit-result result store provider)))))
-               (thread ()
-                 (let ((results (run-cmd)))
-                   (unless results
-                     (return-from thread))
-                   (with-input-from-string (s results)
-                     (loop for line = (read-line s nil nil)
-                           while line
-                           do (unless (process-line line)
-                                (return-from thread))))))
+      (labels ((thread ()
+                 ;; the first call loads whatever index the last session left
+                 ;; behind, and after that it's a no-op unless the index has
+                 ;; gone stale. Nothing is spawned before anyone searches
+                 (saturn:brew-index-refresh *brew-index-cmd* *brew-index-max-age*)
+                 ;; matches names and descriptions against the local index
+                 ;; (see saturn-brew-index.c), obj0 being the name and obj1
+                 ;; the description
+                 (saturn:brew-query str store provider "SaturnBrewResult"))
                (idle-timeout ()
                  (setf *timeout-source* 0)
                  (bordeaux-threads:make-thread #'thread)
                  ;; don't run again
                  nil))
         (setf *timeout-source*
-              ;; debounce 0.5 seconds
-              (g:timeout-add 500 #'idle-timeout)))))
+              ;; debounce 0.05 seconds
+              (g:timeout-add 50 #'idle-timeout)))))
 
   )
 
@@ -17,114 +17,6 @@
 ;;
 ;; SPDX-License-Identifier: GPL-3.0-or-later
 
-(defun parse-tokens (str)
-  (let ((skip 0))
-    (labels ((handle-digit (ch idx)
-               (parse-integer
-                (concatenate
-                 'string
-                 (append (list ch)
-                         (loop for scan from 0
-                               for digit across (subseq str (1+ idx))
-                               while (digit-char-p digit)
-                               collect digit
-                               finally (incf skip scan))))))
-             (recurse (ch idx)
-               (parse-tokens
-                (let* ((stack (list idx))
-                       (matching-paren nil))
-                  (loop for scan from 0
-                        for subch across (subseq str (1+ idx))
-                        while stack
-                        when (member subch '(#\())
-                          do (push (+ idx scan 1) stack)
-                        when (member subch '(#\)))
-                          do (pop stack)
-                        finally (progn
-                                  (setf matching-paren (+ idx scan))
-                                  (incf skip scan)))
-                  (subseq str (1+ idx) matching-paren))))
-             (handle-paren (ch idx)
-               (let ((tokens (recurse ch idx)))
-                 (unless tokens
-                   (error "malformed expression"))
-                 tokens)))
-      (loop for ch across str
-            for idx from 0
-            unless (or (when (> skip 0)
-                         (decf skip))
-                       (member ch '(#\ )))
-              collect
-              (cond
-                ((equal ch #\+) #'+)
-                ((equal ch #\-) #'-)
-                ((equal ch #\*) #'*)
-                ((equal ch #\/) #'/)
-                ((equal ch #\%) #'mod)
-                ((equal ch #\^) #'expt)
-                ((digit-char-p ch) (handle-digit ch idx))
-                ((equal ch #\() (handle-paren ch idx))
-                (t (error "invalid expression")))))))
-
-(defun calc-tokens (tokens)
-  (if (= (length tokens) 1)
-      (let ((result (car tokens)))
-        (cond
-          ((listp result)
-           (calc-tokens result))
-          (result result)
-          (t (error "malformed tokens"))))
-      (let ((operators nil)
-            (numbers nil)
-            (final-result nil)
-            (steps nil))
-        (loop for token in tokens
-              for idx from 0
-              if (evenp idx)
-                collect (if (listp token)
-                            (multiple-value-bind (sub-result sub-steps)
-                                (calc-tokens token)
-                              (loop for step in sub-steps
-                                    do (push step steps))
-                              sub-result)
-                            token)
-                  into l-numbers
-              else
-                collect (list token (/ (1- idx) 2)) into l-operators
-              finally (setf operators l-operators
-                            numbers l-numbers))
-        (labels ((get-precedence (x)
-                   (let ((op (first x)))
-                     (cond
-                       ((equal op #'+) 1)
-                       ((equal op #'-) 1)
-                       ((equal op #'*) 2)
-                       ((equal op #'/) 2)
-                       ((equal op #'mod) 2)
-                       ((equal op #'expt) 3)
-                       (t 0))))
-                 (predicate (&rest args)
-                   (apply #'> (mapcar #'get-precedence args))))
-          (setf operators (sort operators #'predicate)))
-        (loop for operator in operators
-              do (destructuring-bind (op idx) operator
-                   (labels ((test-num-b (a b) (numberp b))
-                            (find-num-backwards (idx lis)
-                              (find t lis :test #'test-num-b
-                                          :end (1+ idx)
-                                          :from-end t))
-                            (find-num-forwards (idx lis)
-                              (find t lis :test #'test-num-b
-                                          :start (1+ idx))))
-                     (let ((left (find-num-backwards idx numbers))
-                           (right (find-num-forwards idx numbers)))
-                       (let ((result (funcall op left right)))
-                         (setf (nth idx numbers) result
-                               (nth (1+ idx) numbers) nil
-                               final-result result)
-                         (push (list left op right result) steps))))))
-        (values final-result (reverse steps)))))
-
 (gobject:define-gobject-subclass
     "SaturnCaclResult"
     calc-result
@@ -139,14 +31,14 @@
   nil)
 
 (defun query (provider object store)
-  (let* ((str (gtk:string-object-string object))
-         (tokens (ignore-errors (parse-tokens str))))
+  (let ((str (gtk:string-object-string object)))
     (unless (> (length str) 0)
       (return-from query))
-    (unless tokens
-      (return-from query))
-    (multiple-value-bind (number steps)
-        (ignore-errors (calc-tokens tokens))
+    ;; parsed and evaluated natively in a single pass over the string (see
+    ;; saturn-calc.c). steps come back as (left op right result) lists in
+    ;; evaluation order, op being the operator's name
+    (destructuring-bind (&optional number &rest steps)
+        (ignore-errors (saturn:calc-evaluate str))
       (unless (and number steps)
         (return-from query))
       (saturn:submit-result (let ((result (make-instance 'calc-result)))
@@ -199,7 +91,7 @@
                        (destructuring-bind (left op right result) x
                          (format nil "~a ~a ~a = ~a~%"
                                  left
-                                 (symbol-name (si:compiled-function-name op))
+                                 op
                                  right
                                  result)))
                    steps))
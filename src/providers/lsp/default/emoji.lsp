@@ -19,3968 +19,6 @@
 
 (defvar *min-query-length* 2)
 
-(defun code-seq-to-string (seq)
-  (concatenate 'string (mapcar #'code-char seq)))
-(defvar emojis
-  '(((#x1F600)                                                    "grinning face")
-    ((#x1F603)                                                    "grinning face with big eyes")
-    ((#x1F604)                                                    "grinning face with smiling eyes")
-    ((#x1F601)                                                    "beaming face with smiling eyes")
-    ((#x1F606)                                                    "grinning squinting face")
-    ((#x1F605)                                                    "grinning face with sweat")
-    ((#x1F923)                                                    "rolling on the floor laughing")
-    ((#x1F602)                                                    "face with tears of joy")
-    ((#x1F642)                                                    "slightly smiling face")
-    ((#x1F643)                                                    "upside-down face")
-    ((#x1FAE0)                                                    "melting face")
-    ((#x1F609)                                                    "winking face")
-    ((#x1F60A)                                                    "smiling face with smiling eyes")
-    ((#x1F607)                                                    "smiling face with halo")
-    ((#x1F970)                                                    "smiling face with hearts")
-    ((#x1F60D)                                                    "smiling face with heart-eyes")
-    ((#x1F929)                                                    "star-struck")
-    ((#x1F618)                                                    "face blowing a kiss")
-    ((#x1F617)                                                    "kissing face")
-    ((#x263A #xFE0F)                                                "smiling face")
-    ((#x1F61A)                                                    "kissing face with closed eyes")
-    ((#x1F619)                                                    "kissing face with smiling eyes")
-    ((#x1F972)                                                    "smiling face with tear")
-    ((#x1F60B)                                                    "face savoring food")
-    ((#x1F61B)                                                    "face with tongue")
-    ((#x1F61C)                                                    "winking face with tongue")
-    ((#x1F92A)                                                    "zany face")
-    ((#x1F61D)                                                    "squinting face with tongue")
-    ((#x1F911)                                                    "money-mouth face")
-    ((#x1F917)                                                    "smiling face with open hands")
-    ((#x1F92D)                                                    "face with hand over mouth")
-    ((#x1FAE2)                                                    "face with open eyes and hand over mouth")
-    ((#x1FAE3)                                                    "face with peeking eye")
-    ((#x1F92B)                                                    "shushing face")
-    ((#x1F914)                                                    "thinking face")
-    ((#x1FAE1)                                                    "saluting face")
-    ((#x1F910)                                                    "zipper-mouth face")
-    ((#x1F928)                                                    "face with raised eyebrow")
-    ((#x1F610)                                                    "neutral face")
-    ((#x1F611)                                                    "expressionless face")
-    ((#x1F636)                                                    "face without mouth")
-    ((#x1FAE5)                                                    "dotted line face")
-    ((#x1F636 #x200D #x1F32B #xFE0F)                                    "face in clouds")
-    ((#x1F60F)                                                    "smirking face")
-    ((#x1F612)                                                    "unamused face")
-    ((#x1F644)                                                    "face with rolling eyes")
-    ((#x1F62C)                                                    "grimacing face")
-    ((#x1F62E #x200D #x1F4A8)                                         "face exhaling")
-    ((#x1F925)                                                    "lying face")
-    ((#x1FAE8)                                                    "shaking face")
-    ((#x1F642 #x200D #x2194 #xFE0F)                                     "head shaking horizontally")
-    ((#x1F642 #x200D #x2195 #xFE0F)                                     "head shaking vertically")
-    ((#x1F60C)                                                    "relieved face")
-    ((#x1F614)                                                    "pensive face")
-    ((#x1F62A)                                                    "sleepy face")
-    ((#x1F924)                                                    "drooling face")
-    ((#x1F634)                                                    "sleeping face")
-    ((#x1FAE9)                                                    "face with bags under eyes")
-    ((#x1F637)                                                    "face with medical mask")
-    ((#x1F912)                                                    "face with thermometer")
-    ((#x1F915)                                                    "face with head-bandage")
-    ((#x1F922)                                                    "nauseated face")
-    ((#x1F92E)                                                    "face vomiting")
-    ((#x1F927)                                                    "sneezing face")
-    ((#x1F975)                                                    "hot face")
-    ((#x1F976)                                                    "cold face")
-    ((#x1F974)                                                    "woozy face")
-    ((#x1F635)                                                    "face with crossed-out eyes")
-    ((#x1F635 #x200D #x1F4AB)                                         "face with spiral eyes")
-    ((#x1F92F)                                                    "exploding head")
-    ((#x1F920)                                                    "cowboy hat face")
-    ((#x1F973)                                                    "partying face")
-    ((#x1F978)                                                    "disguised face")
-    ((#x1F60E)                                                    "smiling face with sunglasses")
-    ((#x1F913)                                                    "nerd face")
-    ((#x1F9D0)                                                    "face with monocle")
-    ((#x1F615)                                                    "confused face")
-    ((#x1FAE4)                                                    "face with diagonal mouth")
-    ((#x1F61F)                                                    "worried face")
-    ((#x1F641)                                                    "slightly frowning face")
-    ((#x2639 #xFE0F)                                                "frowning face")
-    ((#x1F62E)                                                    "face with open mouth")
-    ((#x1F62F)                                                    "hushed face")
-    ((#x1F632)                                                    "astonished face")
-    ((#x1F633)                                                    "flushed face")
-    ((#x1FAEA)                                                    "distorted face")
-    ((#x1F97A)                                                    "pleading face")
-    ((#x1F979)                                                    "face holding back tears")
-    ((#x1F626)                                                    "frowning face with open mouth")
-    ((#x1F627)                                                    "anguished face")
-    ((#x1F628)                                                    "fearful face")
-    ((#x1F630)                                                    "anxious face with sweat")
-    ((#x1F625)                                                    "sad but relieved face")
-    ((#x1F622)                                                    "crying face")
-    ((#x1F62D)                                                    "loudly crying face")
-    ((#x1F631)                                                    "face screaming in fear")
-    ((#x1F616)                                                    "confounded face")
-    ((#x1F623)                                                    "persevering face")
-    ((#x1F61E)                                                    "disappointed face")
-    ((#x1F613)                                                    "downcast face with sweat")
-    ((#x1F629)                                                    "weary face")
-    ((#x1F62B)                                                    "tired face")
-    ((#x1F971)                                                    "yawning face")
-    ((#x1F624)                                                    "face with steam from nose")
-    ((#x1F621)                                                    "enraged face")
-    ((#x1F620)                                                    "angry face")
-    ((#x1F92C)                                                    "face with symbols on mouth")
-    ((#x1F608)                                                    "smiling face with horns")
-    ((#x1F47F)                                                    "angry face with horns")
-    ((#x1F480)                                                    "skull")
-    ((#x2620 #xFE0F)                                                "skull and crossbones")
-    ((#x1F4A9)                                                    "pile of poo")
-    ((#x1F921)                                                    "clown face")
-    ((#x1F479)                                                    "ogre")
-    ((#x1F47A)                                                    "goblin")
-    ((#x1F47B)                                                    "ghost")
-    ((#x1F47D)                                                    "alien")
-    ((#x1F47E)                                                    "alien monster")
-    ((#x1F916)                                                    "robot")
-    ((#x1F63A)                                                    "grinning cat")
-    ((#x1F638)                                                    "grinning cat with smiling eyes")
-    ((#x1F639)                                                    "cat with tears of joy")
-    ((#x1F63B)                                                    "smiling cat with heart-eyes")
-    ((#x1F63C)                                                    "cat with wry smile")
-    ((#x1F63D)                                                    "kissing cat")
-    ((#x1F640)                                                    "weary cat")
-    ((#x1F63F)                                                    "crying cat")
-    ((#x1F63E)                                                    "pouting cat")
-    ((#x1F648)                                                    "see-no-evil monkey")
-    ((#x1F649)                                                    "hear-no-evil monkey")
-    ((#x1F64A)                                                    "speak-no-evil monkey")
-    ((#x1F48C)                                                    "love letter")
-    ((#x1F498)                                                    "heart with arrow")
-    ((#x1F49D)                                                    "heart with ribbon")
-    ((#x1F496)                                                    "sparkling heart")
-    ((#x1F497)                                                    "growing heart")
-    ((#x1F493)                                                    "beating heart")
-    ((#x1F49E)                                                    "revolving hearts")
-    ((#x1F495)                                                    "two hearts")
-    ((#x1F49F)                                                    "heart decoration")
-    ((#x2763 #xFE0F)                                                "heart exclamation")
-    ((#x1F494)                                                    "broken heart")
-    ((#x2764 #xFE0F #x200D #x1F525)                                     "heart on fire")
-    ((#x2764 #xFE0F #x200D #x1FA79)                                     "mending heart")
-    ((#x2764 #xFE0F)                                                "red heart")
-    ((#x1FA77)                                                    "pink heart")
-    ((#x1F9E1)                                                    "orange heart")
-    ((#x1F49B)                                                    "yellow heart")
-    ((#x1F49A)                                                    "green heart")
-    ((#x1F499)                                                    "blue heart")
-    ((#x1FA75)                                                    "light blue heart")
-    ((#x1F49C)                                                    "purple heart")
-    ((#x1F90E)                                                    "brown heart")
-    ((#x1F5A4)                                                    "black heart")
-    ((#x1FA76)                                                    "grey heart")
-    ((#x1F90D)                                                    "white heart")
-    ((#x1F48B)                                                    "kiss mark")
-    ((#x1F4AF)                                                    "hundred points")
-    ((#x1F4A2)                                                    "anger symbol")
-    ((#x1FAEF)                                                    "fight cloud")
-    ((#x1F4A5)                                                    "collision")
-    ((#x1F4AB)                                                    "dizzy")
-    ((#x1F4A6)                                                    "sweat droplets")
-    ((#x1F4A8)                                                    "dashing away")
-    ((#x1F573 #xFE0F)                                               "hole")
-    ((#x1F4AC)                                                    "speech balloon")
-    ((#x1F441 #xFE0F #x200D #x1F5E8 #xFE0F)                               "eye in speech bubble")
-    ((#x1F5E8 #xFE0F)                                               "left speech bubble")
-    ((#x1F5EF #xFE0F)                                               "right anger bubble")
-    ((#x1F4AD)                                                    "thought balloon")
-    ((#x1F4A4)                                                    "ZZZ")
-    ((#x1F44B)                                                    "waving hand")
-    ((#x1F44B #x1F3FB)                                              "waving hand: light skin tone")
-    ((#x1F44B #x1F3FC)                                              "waving hand: medium-light skin tone")
-    ((#x1F44B #x1F3FD)                                              "waving hand: medium skin tone")
-    ((#x1F44B #x1F3FE)                                              "waving hand: medium-dark skin tone")
-    ((#x1F44B #x1F3FF)                                              "waving hand: dark skin tone")
-    ((#x1F91A)                                                    "raised back of hand")
-    ((#x1F91A #x1F3FB)                                              "raised back of hand: light skin tone")
-    ((#x1F91A #x1F3FC)                                              "raised back of hand: medium-light skin tone")
-    ((#x1F91A #x1F3FD)                                              "raised back of hand: medium skin tone")
-    ((#x1F91A #x1F3FE)                                              "raised back of hand: medium-dark skin tone")
-    ((#x1F91A #x1F3FF)                                              "raised back of hand: dark skin tone")
-    ((#x1F590 #xFE0F)                                               "hand with fingers splayed")
-    ((#x1F590 #x1F3FB)                                              "hand with fingers splayed: light skin tone")
-    ((#x1F590 #x1F3FC)                                              "hand with fingers splayed: medium-light skin tone")
-    ((#x1F590 #x1F3FD)                                              "hand with fingers splayed: medium skin tone")
-    ((#x1F590 #x1F3FE)                                              "hand with fingers splayed: medium-dark skin tone")
-    ((#x1F590 #x1F3FF)                                              "hand with fingers splayed: dark skin tone")
-    ((#x270B)                                                     "raised hand")
-    ((#x270B #x1F3FB)                                               "raised hand: light skin tone")
-    ((#x270B #x1F3FC)                                               "raised hand: medium-light skin tone")
-    ((#x270B #x1F3FD)                                               "raised hand: medium skin tone")
-    ((#x270B #x1F3FE)                                               "raised hand: medium-dark skin tone")
-    ((#x270B #x1F3FF)                                               "raised hand: dark skin tone")
-    ((#x1F596)                                                    "vulcan salute")
-    ((#x1F596 #x1F3FB)                                              "vulcan salute: light skin tone")
-    ((#x1F596 #x1F3FC)                                              "vulcan salute: medium-light skin tone")
-    ((#x1F596 #x1F3FD)                                              "vulcan salute: medium skin tone")
-    ((#x1F596 #x1F3FE)                                              "vulcan salute: medium-dark skin tone")
-    ((#x1F596 #x1F3FF)                                              "vulcan salute: dark skin tone")
-    ((#x1FAF1)                                                    "rightwards hand")
-    ((#x1FAF1 #x1F3FB)                                              "rightwards hand: light skin tone")
-    ((#x1FAF1 #x1F3FC)                                              "rightwards hand: medium-light skin tone")
-    ((#x1FAF1 #x1F3FD)                                              "rightwards hand: medium skin tone")
-    ((#x1FAF1 #x1F3FE)                                              "rightwards hand: medium-dark skin tone")
-    ((#x1FAF1 #x1F3FF)                                              "rightwards hand: dark skin tone")
-    ((#x1FAF2)                                                    "leftwards hand")
-    ((#x1FAF2 #x1F3FB)                                              "leftwards hand: light skin tone")
-    ((#x1FAF2 #x1F3FC)                                              "leftwards hand: medium-light skin tone")
-    ((#x1FAF2 #x1F3FD)                                              "leftwards hand: medium skin tone")
-    ((#x1FAF2 #x1F3FE)                                              "leftwards hand: medium-dark skin tone")
-    ((#x1FAF2 #x1F3FF)                                              "leftwards hand: dark skin tone")
-    ((#x1FAF3)                                                    "palm down hand")
-    ((#x1FAF3 #x1F3FB)                                              "palm down hand: light skin tone")
-    ((#x1FAF3 #x1F3FC)                                              "palm down hand: medium-light skin tone")
-    ((#x1FAF3 #x1F3FD)                                              "palm down hand: medium skin tone")
-    ((#x1FAF3 #x1F3FE)                                              "palm down hand: medium-dark skin tone")
-    ((#x1FAF3 #x1F3FF)                                              "palm down hand: dark skin tone")
-    ((#x1FAF4)                                                    "palm up hand")
-    ((#x1FAF4 #x1F3FB)                                              "palm up hand: light skin tone")
-    ((#x1FAF4 #x1F3FC)                                              "palm up hand: medium-light skin tone")
-    ((#x1FAF4 #x1F3FD)                                              "palm up hand: medium skin tone")
-    ((#x1FAF4 #x1F3FE)                                              "palm up hand: medium-dark skin tone")
-    ((#x1FAF4 #x1F3FF)                                              "palm up hand: dark skin tone")
-    ((#x1FAF7)                                                    "leftwards pushing hand")
-    ((#x1FAF7 #x1F3FB)                                              "leftwards pushing hand: light skin tone")
-    ((#x1FAF7 #x1F3FC)                                              "leftwards pushing hand: medium-light skin tone")
-    ((#x1FAF7 #x1F3FD)                                              "leftwards pushing hand: medium skin tone")
-    ((#x1FAF7 #x1F3FE)                                              "leftwards pushing hand: medium-dark skin tone")
-    ((#x1FAF7 #x1F3FF)                                              "leftwards pushing hand: dark skin tone")
-    ((#x1FAF8)                                                    "rightwards pushing hand")
-    ((#x1FAF8 #x1F3FB)                                              "rightwards pushing hand: light skin tone")
-    ((#x1FAF8 #x1F3FC)                                              "rightwards pushing hand: medium-light skin tone")
-    ((#x1FAF8 #x1F3FD)                                              "rightwards pushing hand: medium skin tone")
-    ((#x1FAF8 #x1F3FE)                                              "rightwards pushing hand: medium-dark skin tone")
-    ((#x1FAF8 #x1F3FF)                                              "rightwards pushing hand: dark skin tone")
-    ((#x1F44C)                                                    "OK hand")
-    ((#x1F44C #x1F3FB)                                              "OK hand: light skin tone")
-    ((#x1F44C #x1F3FC)                                              "OK hand: medium-light skin tone")
-    ((#x1F44C #x1F3FD)                                              "OK hand: medium skin tone")
-    ((#x1F44C #x1F3FE)                                              "OK hand: medium-dark skin tone")
-    ((#x1F44C #x1F3FF)                                              "OK hand: dark skin tone")
-    ((#x1F90C)                                                    "pinched fingers")
-    ((#x1F90C #x1F3FB)                                              "pinched fingers: light skin tone")
-    ((#x1F90C #x1F3FC)                                              "pinched fingers: medium-light skin tone")
-    ((#x1F90C #x1F3FD)                                              "pinched fingers: medium skin tone")
-    ((#x1F90C #x1F3FE)                                              "pinched fingers: medium-dark skin tone")
-    ((#x1F90C #x1F3FF)                                              "pinched fingers: dark skin tone")
-    ((#x1F90F)                                                    "pinching hand")
-    ((#x1F90F #x1F3FB)                                              "pinching hand: light skin tone")
-    ((#x1F90F #x1F3FC)                                              "pinching hand: medium-light skin tone")
-    ((#x1F90F #x1F3FD)                                              "pinching hand: medium skin tone")
-    ((#x1F90F #x1F3FE)                                              "pinching hand: medium-dark skin tone")
-    ((#x1F90F #x1F3FF)                                              "pinching hand: dark skin tone")
-    ((#x270C #xFE0F)                                                "victory hand")
-    ((#x270C #x1F3FB)                                               "victory hand: light skin tone")
-    ((#x270C #x1F3FC)                                               "victory hand: medium-light skin tone")
-    ((#x270C #x1F3FD)                                               "victory hand: medium skin tone")
-    ((#x270C #x1F3FE)                                               "victory hand: medium-dark skin tone")
-    ((#x270C #x1F3FF)                                               "victory hand: dark skin tone")
-    ((#x1F91E)                                                    "crossed fingers")
-    ((#x1F91E #x1F3FB)                                              "crossed fingers: light skin tone")
-    ((#x1F91E #x1F3FC)                                              "crossed fingers: medium-light skin tone")
-    ((#x1F91E #x1F3FD)                                              "crossed fingers: medium skin tone")
-    ((#x1F91E #x1F3FE)                                              "crossed fingers: medium-dark skin tone")
-    ((#x1F91E #x1F3FF)                                              "crossed fingers: dark skin tone")
-    ((#x1FAF0)                                                    "hand with index finger and thumb crossed")
-    ((#x1FAF0 #x1F3FB)                                              "hand with index finger and thumb crossed: light skin tone")
-    ((#x1FAF0 #x1F3FC)                                              "hand with index finger and thumb crossed: medium-light skin tone")
-    ((#x1FAF0 #x1F3FD)                                              "hand with index finger and thumb crossed: medium skin tone")
-    ((#x1FAF0 #x1F3FE)                                              "hand with index finger and thumb crossed: medium-dark skin tone")
-    ((#x1FAF0 #x1F3FF)                                              "hand with index finger and thumb crossed: dark skin tone")
-    ((#x1F91F)                                                    "love-you gesture")
-    ((#x1F91F #x1F3FB)                                              "love-you gesture: light skin tone")
-    ((#x1F91F #x1F3FC)                                              "love-you gesture: medium-light skin tone")
-    ((#x1F91F #x1F3FD)                                              "love-you gesture: medium skin tone")
-    ((#x1F91F #x1F3FE)                                              "love-you gesture: medium-dark skin tone")
-    ((#x1F91F #x1F3FF)                                              "love-you gesture: dark skin tone")
-    ((#x1F918)                                                    "sign of the horns")
-    ((#x1F918 #x1F3FB)                                              "sign of the horns: light skin tone")
-    ((#x1F918 #x1F3FC)                                              "sign of the horns: medium-light skin tone")
-    ((#x1F918 #x1F3FD)                                              "sign of the horns: medium skin tone")
-    ((#x1F918 #x1F3FE)                                              "sign of the horns: medium-dark skin tone")
-    ((#x1F918 #x1F3FF)                                              "sign of the horns: dark skin tone")
-    ((#x1F919)                                                    "call me hand")
-    ((#x1F919 #x1F3FB)                                              "call me hand: light skin tone")
-    ((#x1F919 #x1F3FC)                                              "call me hand: medium-light skin tone")
-    ((#x1F919 #x1F3FD)                                              "call me hand: medium skin tone")
-    ((#x1F919 #x1F3FE)                                              "call me hand: medium-dark skin tone")
-    ((#x1F919 #x1F3FF)                                              "call me hand: dark skin tone")
-    ((#x1F448)                                                    "backhand index pointing left")
-    ((#x1F448 #x1F3FB)                                              "backhand index pointing left: light skin tone")
-    ((#x1F448 #x1F3FC)                                              "backhand index pointing left: medium-light skin tone")
-    ((#x1F448 #x1F3FD)                                              "backhand index pointing left: medium skin tone")
-    ((#x1F448 #x1F3FE)                                              "backhand index pointing left: medium-dark skin tone")
-    ((#x1F448 #x1F3FF)                                              "backhand index pointing left: dark skin tone")
-    ((#x1F449)                                                    "backhand index pointing right")
-    ((#x1F449 #x1F3FB)                                              "backhand index pointing right: light skin tone")
-    ((#x1F449 #x1F3FC)                                              "backhand index pointing right: medium-light skin tone")
-    ((#x1F449 #x1F3FD)                                              "backhand index pointing right: medium skin tone")
-    ((#x1F449 #x1F3FE)                                              "backhand index pointing right: medium-dark skin tone")
-    ((#x1F449 #x1F3FF)                                              "backhand index pointing right: dark skin tone")
-    ((#x1F446)                                                    "backhand index pointing up")
-    ((#x1F446 #x1F3FB)                                              "backhand index pointing up: light skin tone")
-    ((#x1F446 #x1F3FC)                                              "backhand index pointing up: medium-light skin tone")
-    ((#x1F446 #x1F3FD)                                              "backhand index pointing up: medium skin tone")
-    ((#x1F446 #x1F3FE)                                              "backhand index pointing up: medium-dark skin tone")
-    ((#x1F446 #x1F3FF)                                              "backhand index pointing up: dark skin tone")
-    ((#x1F595)                                                    "middle finger")
-    ((#x1F595 #x1F3FB)                                              "middle finger: light skin tone")
-    ((#x1F595 #x1F3FC)                                              "middle finger: medium-light skin tone")
-    ((#x1F595 #x1F3FD)                                              "middle finger: medium skin tone")
-    ((#x1F595 #x1F3FE)                                              "middle finger: medium-dark skin tone")
-    ((#x1F595 #x1F3FF)                                              "middle finger: dark skin tone")
-    ((#x1F447)                                                    "backhand index pointing down")
-    ((#x1F447 #x1F3FB)                                              "backhand index pointing down: light skin tone")
-    ((#x1F447 #x1F3FC)                                              "backhand index pointing down: medium-light skin tone")
-    ((#x1F447 #x1F3FD)                                              "backhand index pointing down: medium skin tone")
-    ((#x1F447 #x1F3FE)                                              "backhand index pointing down: medium-dark skin tone")
-    ((#x1F447 #x1F3FF)                                              "backhand index pointing down: dark skin tone")
-    ((#x261D #xFE0F)                                                "index pointing up")
-    ((#x261D #x1F3FB)                                               "index pointing up: light skin tone")
-    ((#x261D #x1F3FC)                                               "index pointing up: medium-light skin tone")
-    ((#x261D #x1F3FD)                                               "index pointing up: medium skin tone")
-    ((#x261D #x1F3FE)                                               "index pointing up: medium-dark skin tone")
-    ((#x261D #x1F3FF)                                               "index pointing up: dark skin tone")
-    ((#x1FAF5)                                                    "index pointing at the viewer")
-    ((#x1FAF5 #x1F3FB)                                              "index pointing at the viewer: light skin tone")
-    ((#x1FAF5 #x1F3FC)                                              "index pointing at the viewer: medium-light skin tone")
-    ((#x1FAF5 #x1F3FD)                                              "index pointing at the viewer: medium skin tone")
-    ((#x1FAF5 #x1F3FE)                                              "index pointing at the viewer: medium-dark skin tone")
-    ((#x1FAF5 #x1F3FF)                                              "index pointing at the viewer: dark skin tone")
-    ((#x1F44D)                                                    "thumbs up")
-    ((#x1F44D #x1F3FB)                                              "thumbs up: light skin tone")
-    ((#x1F44D #x1F3FC)                                              "thumbs up: medium-light skin tone")
-    ((#x1F44D #x1F3FD)                                              "thumbs up: medium skin tone")
-    ((#x1F44D #x1F3FE)                                              "thumbs up: medium-dark skin tone")
-    ((#x1F44D #x1F3FF)                                              "thumbs up: dark skin tone")
-    ((#x1F44E)                                                    "thumbs down")
-    ((#x1F44E #x1F3FB)                                              "thumbs down: light skin tone")
-    ((#x1F44E #x1F3FC)                                              "thumbs down: medium-light skin tone")
-    ((#x1F44E #x1F3FD)                                              "thumbs down: medium skin tone")
-    ((#x1F44E #x1F3FE)                                              "thumbs down: medium-dark skin tone")
-    ((#x1F44E #x1F3FF)                                              "thumbs down: dark skin tone")
-    ((#x270A)                                                     "raised fist")
-    ((#x270A #x1F3FB)                                               "raised fist: light skin tone")
-    ((#x270A #x1F3FC)                                               "raised fist: medium-light skin tone")
-    ((#x270A #x1F3FD)                                               "raised fist: medium skin tone")
-    ((#x270A #x1F3FE)                                               "raised fist: medium-dark skin tone")
-    ((#x270A #x1F3FF)                                               "raised fist: dark skin tone")
-    ((#x1F44A)                                                    "oncoming fist")
-    ((#x1F44A #x1F3FB)                                              "oncoming fist: light skin tone")
-    ((#x1F44A #x1F3FC)                                              "oncoming fist: medium-light skin tone")
-    ((#x1F44A #x1F3FD)                                              "oncoming fist: medium skin tone")
-    ((#x1F44A #x1F3FE)                                              "oncoming fist: medium-dark skin tone")
-    ((#x1F44A #x1F3FF)                                              "oncoming fist: dark skin tone")
-    ((#x1F91B)                                                    "left-facing fist")
-    ((#x1F91B #x1F3FB)                                              "left-facing fist: light skin tone")
-    ((#x1F91B #x1F3FC)                                              "left-facing fist: medium-light skin tone")
-    ((#x1F91B #x1F3FD)                                              "left-facing fist: medium skin tone")
-    ((#x1F91B #x1F3FE)                                              "left-facing fist: medium-dark skin tone")
-    ((#x1F91B #x1F3FF)                                              "left-facing fist: dark skin tone")
-    ((#x1F91C)                                                    "right-facing fist")
-    ((#x1F91C #x1F3FB)                                              "right-facing fist: light skin tone")
-    ((#x1F91C #x1F3FC)                                              "right-facing fist: medium-light skin tone")
-    ((#x1F91C #x1F3FD)                                              "right-facing fist: medium skin tone")
-    ((#x1F91C #x1F3FE)                                              "right-facing fist: medium-dark skin tone")
-    ((#x1F91C #x1F3FF)                                              "right-facing fist: dark skin tone")
-    ((#x1F44F)                                                    "clapping hands")
-    ((#x1F44F #x1F3FB)                                              "clapping hands: light skin tone")
-    ((#x1F44F #x1F3FC)                                              "clapping hands: medium-light skin tone")
-    ((#x1F44F #x1F3FD)                                              "clapping hands: medium skin tone")
-    ((#x1F44F #x1F3FE)                                              "clapping hands: medium-dark skin tone")
-    ((#x1F44F #x1F3FF)                                              "clapping hands: dark skin tone")
-    ((#x1F64C)                                                    "raising hands")
-    ((#x1F64C #x1F3FB)                                              "raising hands: light skin tone")
-    ((#x1F64C #x1F3FC)                                              "raising hands: medium-light skin tone")
-    ((#x1F64C #x1F3FD)                                              "raising hands: medium skin tone")
-    ((#x1F64C #x1F3FE)                                              "raising hands: medium-dark skin tone")
-    ((#x1F64C #x1F3FF)                                              "raising hands: dark skin tone")
-    ((#x1FAF6)                                                    "heart hands")
-    ((#x1FAF6 #x1F3FB)                                              "heart hands: light skin tone")
-    ((#x1FAF6 #x1F3FC)                                              "heart hands: medium-light skin tone")
-    ((#x1FAF6 #x1F3FD)                                              "heart hands: medium skin tone")
-    ((#x1FAF6 #x1F3FE)                                              "heart hands: medium-dark skin tone")
-    ((#x1FAF6 #x1F3FF)                                              "heart hands: dark skin tone")
-    ((#x1F450)                                                    "open hands")
-    ((#x1F450 #x1F3FB)                                              "open hands: light skin tone")
-    ((#x1F450 #x1F3FC)                                              "open hands: medium-light skin tone")
-    ((#x1F450 #x1F3FD)                                              "open hands: medium skin tone")
-    ((#x1F450 #x1F3FE)                                              "open hands: medium-dark skin tone")
-    ((#x1F450 #x1F3FF)                                              "open hands: dark skin tone")
-    ((#x1F932)                                                    "palms up together")
-    ((#x1F932 #x1F3FB)                                              "palms up together: light skin tone")
-    ((#x1F932 #x1F3FC)                                              "palms up together: medium-light skin tone")
-    ((#x1F932 #x1F3FD)                                              "palms up together: medium skin tone")
-    ((#x1F932 #x1F3FE)                                              "palms up together: medium-dark skin tone")
-    ((#x1F932 #x1F3FF)                                              "palms up together: dark skin tone")
-    ((#x1F91D)                                                    "handshake")
-    ((#x1F91D #x1F3FB)                                              "handshake: light skin tone")
-    ((#x1F91D #x1F3FC)                                              "handshake: medium-light skin tone")
-    ((#x1F91D #x1F3FD)                                              "handshake: medium skin tone")
-    ((#x1F91D #x1F3FE)                                              "handshake: medium-dark skin tone")
-    ((#x1F91D #x1F3FF)                                              "handshake: dark skin tone")
-    ((#x1FAF1 #x1F3FB #x200D #x1FAF2 #x1F3FC)                             "handshake: light skin tone, medium-light skin tone")
-    ((#x1FAF1 #x1F3FB #x200D #x1FAF2 #x1F3FD)                             "handshake: light skin tone, medium skin tone")
-    ((#x1FAF1 #x1F3FB #x200D #x1FAF2 #x1F3FE)                             "handshake: light skin tone, medium-dark skin tone")
-    ((#x1FAF1 #x1F3FB #x200D #x1FAF2 #x1F3FF)                             "handshake: light skin tone, dark skin tone")
-    ((#x1FAF1 #x1F3FC #x200D #x1FAF2 #x1F3FB)                             "handshake: medium-light skin tone, light skin tone")
-    ((#x1FAF1 #x1F3FC #x200D #x1FAF2 #x1F3FD)                             "handshake: medium-light skin tone, medium skin tone")
-    ((#x1FAF1 #x1F3FC #x200D #x1FAF2 #x1F3FE)                             "handshake: medium-light skin tone, medium-dark skin tone")
-    ((#x1FAF1 #x1F3FC #x200D #x1FAF2 #x1F3FF)                             "handshake: medium-light skin tone, dark skin tone")
-    ((#x1FAF1 #x1F3FD #x200D #x1FAF2 #x1F3FB)                             "handshake: medium skin tone, light skin tone")
-    ((#x1FAF1 #x1F3FD #x200D #x1FAF2 #x1F3FC)                             "handshake: medium skin tone, medium-light skin tone")
-    ((#x1FAF1 #x1F3FD #x200D #x1FAF2 #x1F3FE)                             "handshake: medium skin tone, medium-dark skin tone")
-    ((#x1FAF1 #x1F3FD #x200D #x1FAF2 #x1F3FF)                             "handshake: medium skin tone, dark skin tone")
-    ((#x1FAF1 #x1F3FE #x200D #x1FAF2 #x1F3FB)                             "handshake: medium-dark skin tone, light skin tone")
-    ((#x1FAF1 #x1F3FE #x200D #x1FAF2 #x1F3FC)                             "handshake: medium-dark skin tone, medium-light skin tone")
-    ((#x1FAF1 #x1F3FE #x200D #x1FAF2 #x1F3FD)                             "handshake: medium-dark skin tone, medium skin tone")
-    ((#x1FAF1 #x1F3FE #x200D #x1FAF2 #x1F3FF)                             "handshake: medium-dark skin tone, dark skin tone")
-    ((#x1FAF1 #x1F3FF #x200D #x1FAF2 #x1F3FB)                             "handshake: dark skin tone, light skin tone")
-    ((#x1FAF1 #x1F3FF #x200D #x1FAF2 #x1F3FC)                             "handshake: dark skin tone, medium-light skin tone")
-    ((#x1FAF1 #x1F3FF #x200D #x1FAF2 #x1F3FD)                             "handshake: dark skin tone, medium skin tone")
-    ((#x1FAF1 #x1F3FF #x200D #x1FAF2 #x1F3FE)                             "handshake: dark skin tone, medium-dark skin tone")
-    ((#x1F64F)                                                    "folded hands")
-    ((#x1F64F #x1F3FB)                                              "folded hands: light skin tone")
-    ((#x1F64F #x1F3FC)                                              "folded hands: medium-light skin tone")
-    ((#x1F64F #x1F3FD)                                              "folded hands: medium skin tone")
-    ((#x1F64F #x1F3FE)                                              "folded hands: medium-dark skin tone")
-    ((#x1F64F #x1F3FF)                                              "folded hands: dark skin tone")
-    ((#x270D #xFE0F)                                                "writing hand")
-    ((#x270D #x1F3FB)                                               "writing hand: light skin tone")
-    ((#x270D #x1F3FC)                                               "writing hand: medium-light skin tone")
-    ((#x270D #x1F3FD)                                               "writing hand: medium skin tone")
-    ((#x270D #x1F3FE)                                               "writing hand: medium-dark skin tone")
-    ((#x270D #x1F3FF)                                               "writing hand: dark skin tone")
-    ((#x1F485)                                                    "nail polish")
-    ((#x1F485 #x1F3FB)                                              "nail polish: light skin tone")
-    ((#x1F485 #x1F3FC)                                              "nail polish: medium-light skin tone")
-    ((#x1F485 #x1F3FD)                                              "nail polish: medium skin tone")
-    ((#x1F485 #x1F3FE)                                              "nail polish: medium-dark skin tone")
-    ((#x1F485 #x1F3FF)                                              "nail polish: dark skin tone")
-    ((#x1F933)                                                    "selfie")
-    ((#x1F933 #x1F3FB)                                              "selfie: light skin tone")
-    ((#x1F933 #x1F3FC)                                              "selfie: medium-light skin tone")
-    ((#x1F933 #x1F3FD)                                              "selfie: medium skin tone")
-    ((#x1F933 #x1F3FE)                                              "selfie: medium-dark skin tone")
-    ((#x1F933 #x1F3FF)                                              "selfie: dark skin tone")
-    ((#x1F4AA)                                                    "flexed biceps")
-    ((#x1F4AA #x1F3FB)                                              "flexed biceps: light skin tone")
-    ((#x1F4AA #x1F3FC)                                              "flexed biceps: medium-light skin tone")
-    ((#x1F4AA #x1F3FD)                                              "flexed biceps: medium skin tone")
-    ((#x1F4AA #x1F3FE)                                              "flexed biceps: medium-dark skin tone")
-    ((#x1F4AA #x1F3FF)                                              "flexed biceps: dark skin tone")
-    ((#x1F9BE)                                                    "mechanical arm")
-    ((#x1F9BF)                                                    "mechanical leg")
-    ((#x1F9B5)                                                    "leg")
-    ((#x1F9B5 #x1F3FB)                                              "leg: light skin tone")
-    ((#x1F9B5 #x1F3FC)                                              "leg: medium-light skin tone")
-    ((#x1F9B5 #x1F3FD)                                              "leg: medium skin tone")
-    ((#x1F9B5 #x1F3FE)                                              "leg: medium-dark skin tone")
-    ((#x1F9B5 #x1F3FF)                                              "leg: dark skin tone")
-    ((#x1F9B6)                                                    "foot")
-    ((#x1F9B6 #x1F3FB)                                              "foot: light skin tone")
-    ((#x1F9B6 #x1F3FC)                                              "foot: medium-light skin tone")
-    ((#x1F9B6 #x1F3FD)                                              "foot: medium skin tone")
-    ((#x1F9B6 #x1F3FE)                                              "foot: medium-dark skin tone")
-    ((#x1F9B6 #x1F3FF)                                              "foot: dark skin tone")
-    ((#x1F442)                                                    "ear")
-    ((#x1F442 #x1F3FB)                                              "ear: light skin tone")
-    ((#x1F442 #x1F3FC)                                              "ear: medium-light skin tone")
-    ((#x1F442 #x1F3FD)                                              "ear: medium skin tone")
-    ((#x1F442 #x1F3FE)                                              "ear: medium-dark skin tone")
-    ((#x1F442 #x1F3FF)                                              "ear: dark skin tone")
-    ((#x1F9BB)                                                    "ear with hearing aid")
-    ((#x1F9BB #x1F3FB)                                              "ear with hearing aid: light skin tone")
-    ((#x1F9BB #x1F3FC)                                              "ear with hearing aid: medium-light skin tone")
-    ((#x1F9BB #x1F3FD)                                              "ear with hearing aid: medium skin tone")
-    ((#x1F9BB #x1F3FE)                                              "ear with hearing aid: medium-dark skin tone")
-    ((#x1F9BB #x1F3FF)                                              "ear with hearing aid: dark skin tone")
-    ((#x1F443)                                                    "nose")
-    ((#x1F443 #x1F3FB)                                              "nose: light skin tone")
-    ((#x1F443 #x1F3FC)                                              "nose: medium-light skin tone")
-    ((#x1F443 #x1F3FD)                                              "nose: medium skin tone")
-    ((#x1F443 #x1F3FE)                                              "nose: medium-dark skin tone")
-    ((#x1F443 #x1F3FF)                                              "nose: dark skin tone")
-    ((#x1F9E0)                                                    "brain")
-    ((#x1FAC0)                                                    "anatomical heart")
-    ((#x1FAC1)                                                    "lungs")
-    ((#x1F9B7)                                                    "tooth")
-    ((#x1F9B4)                                                    "bone")
-    ((#x1F440)                                                    "eyes")
-    ((#x1F441 #xFE0F)                                               "eye")
-    ((#x1F445)                                                    "tongue")
-    ((#x1F444)                                                    "mouth")
-    ((#x1FAE6)                                                    "biting lip")
-    ((#x1F476)                                                    "baby")
-    ((#x1F476 #x1F3FB)                                              "baby: light skin tone")
-    ((#x1F476 #x1F3FC)                                              "baby: medium-light skin tone")
-    ((#x1F476 #x1F3FD)                                              "baby: medium skin tone")
-    ((#x1F476 #x1F3FE)                                              "baby: medium-dark skin tone")
-    ((#x1F476 #x1F3FF)                                              "baby: dark skin tone")
-    ((#x1F9D2)                                                    "child")
-    ((#x1F9D2 #x1F3FB)                                              "child: light skin tone")
-    ((#x1F9D2 #x1F3FC)                                              "child: medium-light skin tone")
-    ((#x1F9D2 #x1F3FD)                                              "child: medium skin tone")
-    ((#x1F9D2 #x1F3FE)                                              "child: medium-dark skin tone")
-    ((#x1F9D2 #x1F3FF)                                              "child: dark skin tone")
-    ((#x1F466)                                                    "boy")
-    ((#x1F466 #x1F3FB)                                              "boy: light skin tone")
-    ((#x1F466 #x1F3FC)                                              "boy: medium-light skin tone")
-    ((#x1F466 #x1F3FD)                                              "boy: medium skin tone")
-    ((#x1F466 #x1F3FE)                                              "boy: medium-dark skin tone")
-    ((#x1F466 #x1F3FF)                                              "boy: dark skin tone")
-    ((#x1F467)                                                    "girl")
-    ((#x1F467 #x1F3FB)                                              "girl: light skin tone")
-    ((#x1F467 #x1F3FC)                                              "girl: medium-light skin tone")
-    ((#x1F467 #x1F3FD)                                              "girl: medium skin tone")
-    ((#x1F467 #x1F3FE)                                              "girl: medium-dark skin tone")
-    ((#x1F467 #x1F3FF)                                              "girl: dark skin tone")
-    ((#x1F9D1)                                                    "person")
-    ((#x1F9D1 #x1F3FB)                                              "person: light skin tone")
-    ((#x1F9D1 #x1F3FC)                                              "person: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD)                                              "person: medium skin tone")
-    ((#x1F9D1 #x1F3FE)                                              "person: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF)                                              "person: dark skin tone")
-    ((#x1F471)                                                    "person: blond hair")
-    ((#x1F471 #x1F3FB)                                              "person: light skin tone, blond hair")
-    ((#x1F471 #x1F3FC)                                              "person: medium-light skin tone, blond hair")
-    ((#x1F471 #x1F3FD)                                              "person: medium skin tone, blond hair")
-    ((#x1F471 #x1F3FE)                                              "person: medium-dark skin tone, blond hair")
-    ((#x1F471 #x1F3FF)                                              "person: dark skin tone, blond hair")
-    ((#x1F468)                                                    "man")
-    ((#x1F468 #x1F3FB)                                              "man: light skin tone")
-    ((#x1F468 #x1F3FC)                                              "man: medium-light skin tone")
-    ((#x1F468 #x1F3FD)                                              "man: medium skin tone")
-    ((#x1F468 #x1F3FE)                                              "man: medium-dark skin tone")
-    ((#x1F468 #x1F3FF)                                              "man: dark skin tone")
-    ((#x1F9D4)                                                    "person: beard")
-    ((#x1F9D4 #x1F3FB)                                              "person: light skin tone, beard")
-    ((#x1F9D4 #x1F3FC)                                              "person: medium-light skin tone, beard")
-    ((#x1F9D4 #x1F3FD)                                              "person: medium skin tone, beard")
-    ((#x1F9D4 #x1F3FE)                                              "person: medium-dark skin tone, beard")
-    ((#x1F9D4 #x1F3FF)                                              "person: dark skin tone, beard")
-    ((#x1F9D4 #x200D #x2642 #xFE0F)                                     "man: beard")
-    ((#x1F9D4 #x1F3FB #x200D #x2642 #xFE0F)                               "man: light skin tone, beard")
-    ((#x1F9D4 #x1F3FC #x200D #x2642 #xFE0F)                               "man: medium-light skin tone, beard")
-    ((#x1F9D4 #x1F3FD #x200D #x2642 #xFE0F)                               "man: medium skin tone, beard")
-    ((#x1F9D4 #x1F3FE #x200D #x2642 #xFE0F)                               "man: medium-dark skin tone, beard")
-    ((#x1F9D4 #x1F3FF #x200D #x2642 #xFE0F)                               "man: dark skin tone, beard")
-    ((#x1F9D4 #x200D #x2640 #xFE0F)                                     "woman: beard")
-    ((#x1F9D4 #x1F3FB #x200D #x2640 #xFE0F)                               "woman: light skin tone, beard")
-    ((#x1F9D4 #x1F3FC #x200D #x2640 #xFE0F)                               "woman: medium-light skin tone, beard")
-    ((#x1F9D4 #x1F3FD #x200D #x2640 #xFE0F)                               "woman: medium skin tone, beard")
-    ((#x1F9D4 #x1F3FE #x200D #x2640 #xFE0F)                               "woman: medium-dark skin tone, beard")
-    ((#x1F9D4 #x1F3FF #x200D #x2640 #xFE0F)                               "woman: dark skin tone, beard")
-    ((#x1F468 #x200D #x1F9B0)                                         "man: red hair")
-    ((#x1F468 #x1F3FB #x200D #x1F9B0)                                   "man: light skin tone, red hair")
-    ((#x1F468 #x1F3FC #x200D #x1F9B0)                                   "man: medium-light skin tone, red hair")
-    ((#x1F468 #x1F3FD #x200D #x1F9B0)                                   "man: medium skin tone, red hair")
-    ((#x1F468 #x1F3FE #x200D #x1F9B0)                                   "man: medium-dark skin tone, red hair")
-    ((#x1F468 #x1F3FF #x200D #x1F9B0)                                   "man: dark skin tone, red hair")
-    ((#x1F468 #x200D #x1F9B1)                                         "man: curly hair")
-    ((#x1F468 #x1F3FB #x200D #x1F9B1)                                   "man: light skin tone, curly hair")
-    ((#x1F468 #x1F3FC #x200D #x1F9B1)                                   "man: medium-light skin tone, curly hair")
-    ((#x1F468 #x1F3FD #x200D #x1F9B1)                                   "man: medium skin tone, curly hair")
-    ((#x1F468 #x1F3FE #x200D #x1F9B1)                                   "man: medium-dark skin tone, curly hair")
-    ((#x1F468 #x1F3FF #x200D #x1F9B1)                                   "man: dark skin tone, curly hair")
-    ((#x1F468 #x200D #x1F9B3)                                         "man: white hair")
-    ((#x1F468 #x1F3FB #x200D #x1F9B3)                                   "man: light skin tone, white hair")
-    ((#x1F468 #x1F3FC #x200D #x1F9B3)                                   "man: medium-light skin tone, white hair")
-    ((#x1F468 #x1F3FD #x200D #x1F9B3)                                   "man: medium skin tone, white hair")
-    ((#x1F468 #x1F3FE #x200D #x1F9B3)                                   "man: medium-dark skin tone, white hair")
-    ((#x1F468 #x1F3FF #x200D #x1F9B3)                                   "man: dark skin tone, white hair")
-    ((#x1F468 #x200D #x1F9B2)                                         "man: bald")
-    ((#x1F468 #x1F3FB #x200D #x1F9B2)                                   "man: light skin tone, bald")
-    ((#x1F468 #x1F3FC #x200D #x1F9B2)                                   "man: medium-light skin tone, bald")
-    ((#x1F468 #x1F3FD #x200D #x1F9B2)                                   "man: medium skin tone, bald")
-    ((#x1F468 #x1F3FE #x200D #x1F9B2)                                   "man: medium-dark skin tone, bald")
-    ((#x1F468 #x1F3FF #x200D #x1F9B2)                                   "man: dark skin tone, bald")
-    ((#x1F469)                                                    "woman")
-    ((#x1F469 #x1F3FB)                                              "woman: light skin tone")
-    ((#x1F469 #x1F3FC)                                              "woman: medium-light skin tone")
-    ((#x1F469 #x1F3FD)                                              "woman: medium skin tone")
-    ((#x1F469 #x1F3FE)                                              "woman: medium-dark skin tone")
-    ((#x1F469 #x1F3FF)                                              "woman: dark skin tone")
-    ((#x1F469 #x200D #x1F9B0)                                         "woman: red hair")
-    ((#x1F469 #x1F3FB #x200D #x1F9B0)                                   "woman: light skin tone, red hair")
-    ((#x1F469 #x1F3FC #x200D #x1F9B0)                                   "woman: medium-light skin tone, red hair")
-    ((#x1F469 #x1F3FD #x200D #x1F9B0)                                   "woman: medium skin tone, red hair")
-    ((#x1F469 #x1F3FE #x200D #x1F9B0)                                   "woman: medium-dark skin tone, red hair")
-    ((#x1F469 #x1F3FF #x200D #x1F9B0)                                   "woman: dark skin tone, red hair")
-    ((#x1F9D1 #x200D #x1F9B0)                                         "person: red hair")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9B0)                                   "person: light skin tone, red hair")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9B0)                                   "person: medium-light skin tone, red hair")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9B0)                                   "person: medium skin tone, red hair")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9B0)                                   "person: medium-dark skin tone, red hair")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9B0)                                   "person: dark skin tone, red hair")
-    ((#x1F469 #x200D #x1F9B1)                                         "woman: curly hair")
-    ((#x1F469 #x1F3FB #x200D #x1F9B1)                                   "woman: light skin tone, curly hair")
-    ((#x1F469 #x1F3FC #x200D #x1F9B1)                                   "woman: medium-light skin tone, curly hair")
-    ((#x1F469 #x1F3FD #x200D #x1F9B1)                                   "woman: medium skin tone, curly hair")
-    ((#x1F469 #x1F3FE #x200D #x1F9B1)                                   "woman: medium-dark skin tone, curly hair")
-    ((#x1F469 #x1F3FF #x200D #x1F9B1)                                   "woman: dark skin tone, curly hair")
-    ((#x1F9D1 #x200D #x1F9B1)                                         "person: curly hair")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9B1)                                   "person: light skin tone, curly hair")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9B1)                                   "person: medium-light skin tone, curly hair")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9B1)                                   "person: medium skin tone, curly hair")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9B1)                                   "person: medium-dark skin tone, curly hair")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9B1)                                   "person: dark skin tone, curly hair")
-    ((#x1F469 #x200D #x1F9B3)                                         "woman: white hair")
-    ((#x1F469 #x1F3FB #x200D #x1F9B3)                                   "woman: light skin tone, white hair")
-    ((#x1F469 #x1F3FC #x200D #x1F9B3)                                   "woman: medium-light skin tone, white hair")
-    ((#x1F469 #x1F3FD #x200D #x1F9B3)                                   "woman: medium skin tone, white hair")
-    ((#x1F469 #x1F3FE #x200D #x1F9B3)                                   "woman: medium-dark skin tone, white hair")
-    ((#x1F469 #x1F3FF #x200D #x1F9B3)                                   "woman: dark skin tone, white hair")
-    ((#x1F9D1 #x200D #x1F9B3)                                         "person: white hair")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9B3)                                   "person: light skin tone, white hair")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9B3)                                   "person: medium-light skin tone, white hair")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9B3)                                   "person: medium skin tone, white hair")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9B3)                                   "person: medium-dark skin tone, white hair")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9B3)                                   "person: dark skin tone, white hair")
-    ((#x1F469 #x200D #x1F9B2)                                         "woman: bald")
-    ((#x1F469 #x1F3FB #x200D #x1F9B2)                                   "woman: light skin tone, bald")
-    ((#x1F469 #x1F3FC #x200D #x1F9B2)                                   "woman: medium-light skin tone, bald")
-    ((#x1F469 #x1F3FD #x200D #x1F9B2)                                   "woman: medium skin tone, bald")
-    ((#x1F469 #x1F3FE #x200D #x1F9B2)                                   "woman: medium-dark skin tone, bald")
-    ((#x1F469 #x1F3FF #x200D #x1F9B2)                                   "woman: dark skin tone, bald")
-    ((#x1F9D1 #x200D #x1F9B2)                                         "person: bald")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9B2)                                   "person: light skin tone, bald")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9B2)                                   "person: medium-light skin tone, bald")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9B2)                                   "person: medium skin tone, bald")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9B2)                                   "person: medium-dark skin tone, bald")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9B2)                                   "person: dark skin tone, bald")
-    ((#x1F471 #x200D #x2640 #xFE0F)                                     "woman: blond hair")
-    ((#x1F471 #x1F3FB #x200D #x2640 #xFE0F)                               "woman: light skin tone, blond hair")
-    ((#x1F471 #x1F3FC #x200D #x2640 #xFE0F)                               "woman: medium-light skin tone, blond hair")
-    ((#x1F471 #x1F3FD #x200D #x2640 #xFE0F)                               "woman: medium skin tone, blond hair")
-    ((#x1F471 #x1F3FE #x200D #x2640 #xFE0F)                               "woman: medium-dark skin tone, blond hair")
-    ((#x1F471 #x1F3FF #x200D #x2640 #xFE0F)                               "woman: dark skin tone, blond hair")
-    ((#x1F471 #x200D #x2642 #xFE0F)                                     "man: blond hair")
-    ((#x1F471 #x1F3FB #x200D #x2642 #xFE0F)                               "man: light skin tone, blond hair")
-    ((#x1F471 #x1F3FC #x200D #x2642 #xFE0F)                               "man: medium-light skin tone, blond hair")
-    ((#x1F471 #x1F3FD #x200D #x2642 #xFE0F)                               "man: medium skin tone, blond hair")
-    ((#x1F471 #x1F3FE #x200D #x2642 #xFE0F)                               "man: medium-dark skin tone, blond hair")
-    ((#x1F471 #x1F3FF #x200D #x2642 #xFE0F)                               "man: dark skin tone, blond hair")
-    ((#x1F9D3)                                                    "older person")
-    ((#x1F9D3 #x1F3FB)                                              "older person: light skin tone")
-    ((#x1F9D3 #x1F3FC)                                              "older person: medium-light skin tone")
-    ((#x1F9D3 #x1F3FD)                                              "older person: medium skin tone")
-    ((#x1F9D3 #x1F3FE)                                              "older person: medium-dark skin tone")
-    ((#x1F9D3 #x1F3FF)                                              "older person: dark skin tone")
-    ((#x1F474)                                                    "old man")
-    ((#x1F474 #x1F3FB)                                              "old man: light skin tone")
-    ((#x1F474 #x1F3FC)                                              "old man: medium-light skin tone")
-    ((#x1F474 #x1F3FD)                                              "old man: medium skin tone")
-    ((#x1F474 #x1F3FE)                                              "old man: medium-dark skin tone")
-    ((#x1F474 #x1F3FF)                                              "old man: dark skin tone")
-    ((#x1F475)                                                    "old woman")
-    ((#x1F475 #x1F3FB)                                              "old woman: light skin tone")
-    ((#x1F475 #x1F3FC)                                              "old woman: medium-light skin tone")
-    ((#x1F475 #x1F3FD)                                              "old woman: medium skin tone")
-    ((#x1F475 #x1F3FE)                                              "old woman: medium-dark skin tone")
-    ((#x1F475 #x1F3FF)                                              "old woman: dark skin tone")
-    ((#x1F64D)                                                    "person frowning")
-    ((#x1F64D #x1F3FB)                                              "person frowning: light skin tone")
-    ((#x1F64D #x1F3FC)                                              "person frowning: medium-light skin tone")
-    ((#x1F64D #x1F3FD)                                              "person frowning: medium skin tone")
-    ((#x1F64D #x1F3FE)                                              "person frowning: medium-dark skin tone")
-    ((#x1F64D #x1F3FF)                                              "person frowning: dark skin tone")
-    ((#x1F64D #x200D #x2642 #xFE0F)                                     "man frowning")
-    ((#x1F64D #x1F3FB #x200D #x2642 #xFE0F)                               "man frowning: light skin tone")
-    ((#x1F64D #x1F3FC #x200D #x2642 #xFE0F)                               "man frowning: medium-light skin tone")
-    ((#x1F64D #x1F3FD #x200D #x2642 #xFE0F)                               "man frowning: medium skin tone")
-    ((#x1F64D #x1F3FE #x200D #x2642 #xFE0F)                               "man frowning: medium-dark skin tone")
-    ((#x1F64D #x1F3FF #x200D #x2642 #xFE0F)                               "man frowning: dark skin tone")
-    ((#x1F64D #x200D #x2640 #xFE0F)                                     "woman frowning")
-    ((#x1F64D #x1F3FB #x200D #x2640 #xFE0F)                               "woman frowning: light skin tone")
-    ((#x1F64D #x1F3FC #x200D #x2640 #xFE0F)                               "woman frowning: medium-light skin tone")
-    ((#x1F64D #x1F3FD #x200D #x2640 #xFE0F)                               "woman frowning: medium skin tone")
-    ((#x1F64D #x1F3FE #x200D #x2640 #xFE0F)                               "woman frowning: medium-dark skin tone")
-    ((#x1F64D #x1F3FF #x200D #x2640 #xFE0F)                               "woman frowning: dark skin tone")
-    ((#x1F64E)                                                    "person pouting")
-    ((#x1F64E #x1F3FB)                                              "person pouting: light skin tone")
-    ((#x1F64E #x1F3FC)                                              "person pouting: medium-light skin tone")
-    ((#x1F64E #x1F3FD)                                              "person pouting: medium skin tone")
-    ((#x1F64E #x1F3FE)                                              "person pouting: medium-dark skin tone")
-    ((#x1F64E #x1F3FF)                                              "person pouting: dark skin tone")
-    ((#x1F64E #x200D #x2642 #xFE0F)                                     "man pouting")
-    ((#x1F64E #x1F3FB #x200D #x2642 #xFE0F)                               "man pouting: light skin tone")
-    ((#x1F64E #x1F3FC #x200D #x2642 #xFE0F)                               "man pouting: medium-light skin tone")
-    ((#x1F64E #x1F3FD #x200D #x2642 #xFE0F)                               "man pouting: medium skin tone")
-    ((#x1F64E #x1F3FE #x200D #x2642 #xFE0F)                               "man pouting: medium-dark skin tone")
-    ((#x1F64E #x1F3FF #x200D #x2642 #xFE0F)                               "man pouting: dark skin tone")
-    ((#x1F64E #x200D #x2640 #xFE0F)                                     "woman pouting")
-    ((#x1F64E #x1F3FB #x200D #x2640 #xFE0F)                               "woman pouting: light skin tone")
-    ((#x1F64E #x1F3FC #x200D #x2640 #xFE0F)                               "woman pouting: medium-light skin tone")
-    ((#x1F64E #x1F3FD #x200D #x2640 #xFE0F)                               "woman pouting: medium skin tone")
-    ((#x1F64E #x1F3FE #x200D #x2640 #xFE0F)                               "woman pouting: medium-dark skin tone")
-    ((#x1F64E #x1F3FF #x200D #x2640 #xFE0F)                               "woman pouting: dark skin tone")
-    ((#x1F645)                                                    "person gesturing NO")
-    ((#x1F645 #x1F3FB)                                              "person gesturing NO: light skin tone")
-    ((#x1F645 #x1F3FC)                                              "person gesturing NO: medium-light skin tone")
-    ((#x1F645 #x1F3FD)                                              "person gesturing NO: medium skin tone")
-    ((#x1F645 #x1F3FE)                                              "person gesturing NO: medium-dark skin tone")
-    ((#x1F645 #x1F3FF)                                              "person gesturing NO: dark skin tone")
-    ((#x1F645 #x200D #x2642 #xFE0F)                                     "man gesturing NO")
-    ((#x1F645 #x1F3FB #x200D #x2642 #xFE0F)                               "man gesturing NO: light skin tone")
-    ((#x1F645 #x1F3FC #x200D #x2642 #xFE0F)                               "man gesturing NO: medium-light skin tone")
-    ((#x1F645 #x1F3FD #x200D #x2642 #xFE0F)                               "man gesturing NO: medium skin tone")
-    ((#x1F645 #x1F3FE #x200D #x2642 #xFE0F)                               "man gesturing NO: medium-dark skin tone")
-    ((#x1F645 #x1F3FF #x200D #x2642 #xFE0F)                               "man gesturing NO: dark skin tone")
-    ((#x1F645 #x200D #x2640 #xFE0F)                                     "woman gesturing NO")
-    ((#x1F645 #x1F3FB #x200D #x2640 #xFE0F)                               "woman gesturing NO: light skin tone")
-    ((#x1F645 #x1F3FC #x200D #x2640 #xFE0F)                               "woman gesturing NO: medium-light skin tone")
-    ((#x1F645 #x1F3FD #x200D #x2640 #xFE0F)                               "woman gesturing NO: medium skin tone")
-    ((#x1F645 #x1F3FE #x200D #x2640 #xFE0F)                               "woman gesturing NO: medium-dark skin tone")
-    ((#x1F645 #x1F3FF #x200D #x2640 #xFE0F)                               "woman gesturing NO: dark skin tone")
-    ((#x1F646)                                                    "person gesturing OK")
-    ((#x1F646 #x1F3FB)                                              "person gesturing OK: light skin tone")
-    ((#x1F646 #x1F3FC)                                              "person gesturing OK: medium-light skin tone")
-    ((#x1F646 #x1F3FD)                                              "person gesturing OK: medium skin tone")
-    ((#x1F646 #x1F3FE)                                              "person gesturing OK: medium-dark skin tone")
-    ((#x1F646 #x1F3FF)                                              "person gesturing OK: dark skin tone")
-    ((#x1F646 #x200D #x2642 #xFE0F)                                     "man gesturing OK")
-    ((#x1F646 #x1F3FB #x200D #x2642 #xFE0F)                               "man gesturing OK: light skin tone")
-    ((#x1F646 #x1F3FC #x200D #x2642 #xFE0F)                               "man gesturing OK: medium-light skin tone")
-    ((#x1F646 #x1F3FD #x200D #x2642 #xFE0F)                               "man gesturing OK: medium skin tone")
-    ((#x1F646 #x1F3FE #x200D #x2642 #xFE0F)                               "man gesturing OK: medium-dark skin tone")
-    ((#x1F646 #x1F3FF #x200D #x2642 #xFE0F)                               "man gesturing OK: dark skin tone")
-    ((#x1F646 #x200D #x2640 #xFE0F)                                     "woman gesturing OK")
-    ((#x1F646 #x1F3FB #x200D #x2640 #xFE0F)                               "woman gesturing OK: light skin tone")
-    ((#x1F646 #x1F3FC #x200D #x2640 #xFE0F)                               "woman gesturing OK: medium-light skin tone")
-    ((#x1F646 #x1F3FD #x200D #x2640 #xFE0F)                               "woman gesturing OK: medium skin tone")
-    ((#x1F646 #x1F3FE #x200D #x2640 #xFE0F)                               "woman gesturing OK: medium-dark skin tone")
-    ((#x1F646 #x1F3FF #x200D #x2640 #xFE0F)                               "woman gesturing OK: dark skin tone")
-    ((#x1F481)                                                    "person tipping hand")
-    ((#x1F481 #x1F3FB)                                              "person tipping hand: light skin tone")
-    ((#x1F481 #x1F3FC)                                              "person tipping hand: medium-light skin tone")
-    ((#x1F481 #x1F3FD)                                              "person tipping hand: medium skin tone")
-    ((#x1F481 #x1F3FE)                                              "person tipping hand: medium-dark skin tone")
-    ((#x1F481 #x1F3FF)                                              "person tipping hand: dark skin tone")
-    ((#x1F481 #x200D #x2642 #xFE0F)                                     "man tipping hand")
-    ((#x1F481 #x1F3FB #x200D #x2642 #xFE0F)                               "man tipping hand: light skin tone")
-    ((#x1F481 #x1F3FC #x200D #x2642 #xFE0F)                               "man tipping hand: medium-light skin tone")
-    ((#x1F481 #x1F3FD #x200D #x2642 #xFE0F)                               "man tipping hand: medium skin tone")
-    ((#x1F481 #x1F3FE #x200D #x2642 #xFE0F)                               "man tipping hand: medium-dark skin tone")
-    ((#x1F481 #x1F3FF #x200D #x2642 #xFE0F)                               "man tipping hand: dark skin tone")
-    ((#x1F481 #x200D #x2640 #xFE0F)                                     "woman tipping hand")
-    ((#x1F481 #x1F3FB #x200D #x2640 #xFE0F)                               "woman tipping hand: light skin tone")
-    ((#x1F481 #x1F3FC #x200D #x2640 #xFE0F)                               "woman tipping hand: medium-light skin tone")
-    ((#x1F481 #x1F3FD #x200D #x2640 #xFE0F)                               "woman tipping hand: medium skin tone")
-    ((#x1F481 #x1F3FE #x200D #x2640 #xFE0F)                               "woman tipping hand: medium-dark skin tone")
-    ((#x1F481 #x1F3FF #x200D #x2640 #xFE0F)                               "woman tipping hand: dark skin tone")
-    ((#x1F64B)                                                    "person raising hand")
-    ((#x1F64B #x1F3FB)                                              "person raising hand: light skin tone")
-    ((#x1F64B #x1F3FC)                                              "person raising hand: medium-light skin tone")
-    ((#x1F64B #x1F3FD)                                              "person raising hand: medium skin tone")
-    ((#x1F64B #x1F3FE)                                              "person raising hand: medium-dark skin tone")
-    ((#x1F64B #x1F3FF)                                              "person raising hand: dark skin tone")
-    ((#x1F64B #x200D #x2642 #xFE0F)                                     "man raising hand")
-    ((#x1F64B #x1F3FB #x200D #x2642 #xFE0F)                               "man raising hand: light skin tone")
-    ((#x1F64B #x1F3FC #x200D #x2642 #xFE0F)                               "man raising hand: medium-light skin tone")
-    ((#x1F64B #x1F3FD #x200D #x2642 #xFE0F)                               "man raising hand: medium skin tone")
-    ((#x1F64B #x1F3FE #x200D #x2642 #xFE0F)                               "man raising hand: medium-dark skin tone")
-    ((#x1F64B #x1F3FF #x200D #x2642 #xFE0F)                               "man raising hand: dark skin tone")
-    ((#x1F64B #x200D #x2640 #xFE0F)                                     "woman raising hand")
-    ((#x1F64B #x1F3FB #x200D #x2640 #xFE0F)                               "woman raising hand: light skin tone")
-    ((#x1F64B #x1F3FC #x200D #x2640 #xFE0F)                               "woman raising hand: medium-light skin tone")
-    ((#x1F64B #x1F3FD #x200D #x2640 #xFE0F)                               "woman raising hand: medium skin tone")
-    ((#x1F64B #x1F3FE #x200D #x2640 #xFE0F)                               "woman raising hand: medium-dark skin tone")
-    ((#x1F64B #x1F3FF #x200D #x2640 #xFE0F)                               "woman raising hand: dark skin tone")
-    ((#x1F9CF)                                                    "deaf person")
-    ((#x1F9CF #x1F3FB)                                              "deaf person: light skin tone")
-    ((#x1F9CF #x1F3FC)                                              "deaf person: medium-light skin tone")
-    ((#x1F9CF #x1F3FD)                                              "deaf person: medium skin tone")
-    ((#x1F9CF #x1F3FE)                                              "deaf person: medium-dark skin tone")
-    ((#x1F9CF #x1F3FF)                                              "deaf person: dark skin tone")
-    ((#x1F9CF #x200D #x2642 #xFE0F)                                     "deaf man")
-    ((#x1F9CF #x1F3FB #x200D #x2642 #xFE0F)                               "deaf man: light skin tone")
-    ((#x1F9CF #x1F3FC #x200D #x2642 #xFE0F)                               "deaf man: medium-light skin tone")
-    ((#x1F9CF #x1F3FD #x200D #x2642 #xFE0F)                               "deaf man: medium skin tone")
-    ((#x1F9CF #x1F3FE #x200D #x2642 #xFE0F)                               "deaf man: medium-dark skin tone")
-    ((#x1F9CF #x1F3FF #x200D #x2642 #xFE0F)                               "deaf man: dark skin tone")
-    ((#x1F9CF #x200D #x2640 #xFE0F)                                     "deaf woman")
-    ((#x1F9CF #x1F3FB #x200D #x2640 #xFE0F)                               "deaf woman: light skin tone")
-    ((#x1F9CF #x1F3FC #x200D #x2640 #xFE0F)                               "deaf woman: medium-light skin tone")
-    ((#x1F9CF #x1F3FD #x200D #x2640 #xFE0F)                               "deaf woman: medium skin tone")
-    ((#x1F9CF #x1F3FE #x200D #x2640 #xFE0F)                               "deaf woman: medium-dark skin tone")
-    ((#x1F9CF #x1F3FF #x200D #x2640 #xFE0F)                               "deaf woman: dark skin tone")
-    ((#x1F647)                                                    "person bowing")
-    ((#x1F647 #x1F3FB)                                              "person bowing: light skin tone")
-    ((#x1F647 #x1F3FC)                                              "person bowing: medium-light skin tone")
-    ((#x1F647 #x1F3FD)                                              "person bowing: medium skin tone")
-    ((#x1F647 #x1F3FE)                                              "person bowing: medium-dark skin tone")
-    ((#x1F647 #x1F3FF)                                              "person bowing: dark skin tone")
-    ((#x1F647 #x200D #x2642 #xFE0F)                                     "man bowing")
-    ((#x1F647 #x1F3FB #x200D #x2642 #xFE0F)                               "man bowing: light skin tone")
-    ((#x1F647 #x1F3FC #x200D #x2642 #xFE0F)                               "man bowing: medium-light skin tone")
-    ((#x1F647 #x1F3FD #x200D #x2642 #xFE0F)                               "man bowing: medium skin tone")
-    ((#x1F647 #x1F3FE #x200D #x2642 #xFE0F)                               "man bowing: medium-dark skin tone")
-    ((#x1F647 #x1F3FF #x200D #x2642 #xFE0F)                               "man bowing: dark skin tone")
-    ((#x1F647 #x200D #x2640 #xFE0F)                                     "woman bowing")
-    ((#x1F647 #x1F3FB #x200D #x2640 #xFE0F)                               "woman bowing: light skin tone")
-    ((#x1F647 #x1F3FC #x200D #x2640 #xFE0F)                               "woman bowing: medium-light skin tone")
-    ((#x1F647 #x1F3FD #x200D #x2640 #xFE0F)                               "woman bowing: medium skin tone")
-    ((#x1F647 #x1F3FE #x200D #x2640 #xFE0F)                               "woman bowing: medium-dark skin tone")
-    ((#x1F647 #x1F3FF #x200D #x2640 #xFE0F)                               "woman bowing: dark skin tone")
-    ((#x1F926)                                                    "person facepalming")
-    ((#x1F926 #x1F3FB)                                              "person facepalming: light skin tone")
-    ((#x1F926 #x1F3FC)                                              "person facepalming: medium-light skin tone")
-    ((#x1F926 #x1F3FD)                                              "person facepalming: medium skin tone")
-    ((#x1F926 #x1F3FE)                                              "person facepalming: medium-dark skin tone")
-    ((#x1F926 #x1F3FF)                                              "person facepalming: dark skin tone")
-    ((#x1F926 #x200D #x2642 #xFE0F)                                     "man facepalming")
-    ((#x1F926 #x1F3FB #x200D #x2642 #xFE0F)                               "man facepalming: light skin tone")
-    ((#x1F926 #x1F3FC #x200D #x2642 #xFE0F)                               "man facepalming: medium-light skin tone")
-    ((#x1F926 #x1F3FD #x200D #x2642 #xFE0F)                               "man facepalming: medium skin tone")
-    ((#x1F926 #x1F3FE #x200D #x2642 #xFE0F)                               "man facepalming: medium-dark skin tone")
-    ((#x1F926 #x1F3FF #x200D #x2642 #xFE0F)                               "man facepalming: dark skin tone")
-    ((#x1F926 #x200D #x2640 #xFE0F)                                     "woman facepalming")
-    ((#x1F926 #x1F3FB #x200D #x2640 #xFE0F)                               "woman facepalming: light skin tone")
-    ((#x1F926 #x1F3FC #x200D #x2640 #xFE0F)                               "woman facepalming: medium-light skin tone")
-    ((#x1F926 #x1F3FD #x200D #x2640 #xFE0F)                               "woman facepalming: medium skin tone")
-    ((#x1F926 #x1F3FE #x200D #x2640 #xFE0F)                               "woman facepalming: medium-dark skin tone")
-    ((#x1F926 #x1F3FF #x200D #x2640 #xFE0F)                               "woman facepalming: dark skin tone")
-    ((#x1F937)                                                    "person shrugging")
-    ((#x1F937 #x1F3FB)                                              "person shrugging: light skin tone")
-    ((#x1F937 #x1F3FC)                                              "person shrugging: medium-light skin tone")
-    ((#x1F937 #x1F3FD)                                              "person shrugging: medium skin tone")
-    ((#x1F937 #x1F3FE)                                              "person shrugging: medium-dark skin tone")
-    ((#x1F937 #x1F3FF)                                              "person shrugging: dark skin tone")
-    ((#x1F937 #x200D #x2642 #xFE0F)                                     "man shrugging")
-    ((#x1F937 #x1F3FB #x200D #x2642 #xFE0F)                               "man shrugging: light skin tone")
-    ((#x1F937 #x1F3FC #x200D #x2642 #xFE0F)                               "man shrugging: medium-light skin tone")
-    ((#x1F937 #x1F3FD #x200D #x2642 #xFE0F)                               "man shrugging: medium skin tone")
-    ((#x1F937 #x1F3FE #x200D #x2642 #xFE0F)                               "man shrugging: medium-dark skin tone")
-    ((#x1F937 #x1F3FF #x200D #x2642 #xFE0F)                               "man shrugging: dark skin tone")
-    ((#x1F937 #x200D #x2640 #xFE0F)                                     "woman shrugging")
-    ((#x1F937 #x1F3FB #x200D #x2640 #xFE0F)                               "woman shrugging: light skin tone")
-    ((#x1F937 #x1F3FC #x200D #x2640 #xFE0F)                               "woman shrugging: medium-light skin tone")
-    ((#x1F937 #x1F3FD #x200D #x2640 #xFE0F)                               "woman shrugging: medium skin tone")
-    ((#x1F937 #x1F3FE #x200D #x2640 #xFE0F)                               "woman shrugging: medium-dark skin tone")
-    ((#x1F937 #x1F3FF #x200D #x2640 #xFE0F)                               "woman shrugging: dark skin tone")
-    ((#x1F9D1 #x200D #x2695 #xFE0F)                                     "health worker")
-    ((#x1F9D1 #x1F3FB #x200D #x2695 #xFE0F)                               "health worker: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2695 #xFE0F)                               "health worker: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2695 #xFE0F)                               "health worker: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2695 #xFE0F)                               "health worker: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2695 #xFE0F)                               "health worker: dark skin tone")
-    ((#x1F468 #x200D #x2695 #xFE0F)                                     "man health worker")
-    ((#x1F468 #x1F3FB #x200D #x2695 #xFE0F)                               "man health worker: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2695 #xFE0F)                               "man health worker: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2695 #xFE0F)                               "man health worker: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2695 #xFE0F)                               "man health worker: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2695 #xFE0F)                               "man health worker: dark skin tone")
-    ((#x1F469 #x200D #x2695 #xFE0F)                                     "woman health worker")
-    ((#x1F469 #x1F3FB #x200D #x2695 #xFE0F)                               "woman health worker: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2695 #xFE0F)                               "woman health worker: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2695 #xFE0F)                               "woman health worker: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2695 #xFE0F)                               "woman health worker: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2695 #xFE0F)                               "woman health worker: dark skin tone")
-    ((#x1F9D1 #x200D #x1F393)                                         "student")
-    ((#x1F9D1 #x1F3FB #x200D #x1F393)                                   "student: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F393)                                   "student: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F393)                                   "student: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F393)                                   "student: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F393)                                   "student: dark skin tone")
-    ((#x1F468 #x200D #x1F393)                                         "man student")
-    ((#x1F468 #x1F3FB #x200D #x1F393)                                   "man student: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F393)                                   "man student: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F393)                                   "man student: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F393)                                   "man student: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F393)                                   "man student: dark skin tone")
-    ((#x1F469 #x200D #x1F393)                                         "woman student")
-    ((#x1F469 #x1F3FB #x200D #x1F393)                                   "woman student: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F393)                                   "woman student: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F393)                                   "woman student: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F393)                                   "woman student: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F393)                                   "woman student: dark skin tone")
-    ((#x1F9D1 #x200D #x1F3EB)                                         "teacher")
-    ((#x1F9D1 #x1F3FB #x200D #x1F3EB)                                   "teacher: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F3EB)                                   "teacher: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F3EB)                                   "teacher: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F3EB)                                   "teacher: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F3EB)                                   "teacher: dark skin tone")
-    ((#x1F468 #x200D #x1F3EB)                                         "man teacher")
-    ((#x1F468 #x1F3FB #x200D #x1F3EB)                                   "man teacher: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F3EB)                                   "man teacher: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F3EB)                                   "man teacher: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F3EB)                                   "man teacher: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F3EB)                                   "man teacher: dark skin tone")
-    ((#x1F469 #x200D #x1F3EB)                                         "woman teacher")
-    ((#x1F469 #x1F3FB #x200D #x1F3EB)                                   "woman teacher: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F3EB)                                   "woman teacher: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F3EB)                                   "woman teacher: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F3EB)                                   "woman teacher: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F3EB)                                   "woman teacher: dark skin tone")
-    ((#x1F9D1 #x200D #x2696 #xFE0F)                                     "judge")
-    ((#x1F9D1 #x1F3FB #x200D #x2696 #xFE0F)                               "judge: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2696 #xFE0F)                               "judge: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2696 #xFE0F)                               "judge: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2696 #xFE0F)                               "judge: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2696 #xFE0F)                               "judge: dark skin tone")
-    ((#x1F468 #x200D #x2696 #xFE0F)                                     "man judge")
-    ((#x1F468 #x1F3FB #x200D #x2696 #xFE0F)                               "man judge: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2696 #xFE0F)                               "man judge: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2696 #xFE0F)                               "man judge: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2696 #xFE0F)                               "man judge: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2696 #xFE0F)                               "man judge: dark skin tone")
-    ((#x1F469 #x200D #x2696 #xFE0F)                                     "woman judge")
-    ((#x1F469 #x1F3FB #x200D #x2696 #xFE0F)                               "woman judge: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2696 #xFE0F)                               "woman judge: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2696 #xFE0F)                               "woman judge: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2696 #xFE0F)                               "woman judge: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2696 #xFE0F)                               "woman judge: dark skin tone")
-    ((#x1F9D1 #x200D #x1F33E)                                         "farmer")
-    ((#x1F9D1 #x1F3FB #x200D #x1F33E)                                   "farmer: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F33E)                                   "farmer: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F33E)                                   "farmer: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F33E)                                   "farmer: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F33E)                                   "farmer: dark skin tone")
-    ((#x1F468 #x200D #x1F33E)                                         "man farmer")
-    ((#x1F468 #x1F3FB #x200D #x1F33E)                                   "man farmer: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F33E)                                   "man farmer: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F33E)                                   "man farmer: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F33E)                                   "man farmer: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F33E)                                   "man farmer: dark skin tone")
-    ((#x1F469 #x200D #x1F33E)                                         "woman farmer")
-    ((#x1F469 #x1F3FB #x200D #x1F33E)                                   "woman farmer: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F33E)                                   "woman farmer: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F33E)                                   "woman farmer: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F33E)                                   "woman farmer: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F33E)                                   "woman farmer: dark skin tone")
-    ((#x1F9D1 #x200D #x1F373)                                         "cook")
-    ((#x1F9D1 #x1F3FB #x200D #x1F373)                                   "cook: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F373)                                   "cook: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F373)                                   "cook: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F373)                                   "cook: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F373)                                   "cook: dark skin tone")
-    ((#x1F468 #x200D #x1F373)                                         "man cook")
-    ((#x1F468 #x1F3FB #x200D #x1F373)                                   "man cook: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F373)                                   "man cook: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F373)                                   "man cook: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F373)                                   "man cook: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F373)                                   "man cook: dark skin tone")
-    ((#x1F469 #x200D #x1F373)                                         "woman cook")
-    ((#x1F469 #x1F3FB #x200D #x1F373)                                   "woman cook: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F373)                                   "woman cook: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F373)                                   "woman cook: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F373)                                   "woman cook: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F373)                                   "woman cook: dark skin tone")
-    ((#x1F9D1 #x200D #x1F527)                                         "mechanic")
-    ((#x1F9D1 #x1F3FB #x200D #x1F527)                                   "mechanic: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F527)                                   "mechanic: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F527)                                   "mechanic: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F527)                                   "mechanic: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F527)                                   "mechanic: dark skin tone")
-    ((#x1F468 #x200D #x1F527)                                         "man mechanic")
-    ((#x1F468 #x1F3FB #x200D #x1F527)                                   "man mechanic: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F527)                                   "man mechanic: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F527)                                   "man mechanic: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F527)                                   "man mechanic: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F527)                                   "man mechanic: dark skin tone")
-    ((#x1F469 #x200D #x1F527)                                         "woman mechanic")
-    ((#x1F469 #x1F3FB #x200D #x1F527)                                   "woman mechanic: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F527)                                   "woman mechanic: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F527)                                   "woman mechanic: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F527)                                   "woman mechanic: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F527)                                   "woman mechanic: dark skin tone")
-    ((#x1F9D1 #x200D #x1F3ED)                                         "factory worker")
-    ((#x1F9D1 #x1F3FB #x200D #x1F3ED)                                   "factory worker: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F3ED)                                   "factory worker: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F3ED)                                   "factory worker: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F3ED)                                   "factory worker: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F3ED)                                   "factory worker: dark skin tone")
-    ((#x1F468 #x200D #x1F3ED)                                         "man factory worker")
-    ((#x1F468 #x1F3FB #x200D #x1F3ED)                                   "man factory worker: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F3ED)                                   "man factory worker: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F3ED)                                   "man factory worker: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F3ED)                                   "man factory worker: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F3ED)                                   "man factory worker: dark skin tone")
-    ((#x1F469 #x200D #x1F3ED)                                         "woman factory worker")
-    ((#x1F469 #x1F3FB #x200D #x1F3ED)                                   "woman factory worker: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F3ED)                                   "woman factory worker: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F3ED)                                   "woman factory worker: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F3ED)                                   "woman factory worker: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F3ED)                                   "woman factory worker: dark skin tone")
-    ((#x1F9D1 #x200D #x1F4BC)                                         "office worker")
-    ((#x1F9D1 #x1F3FB #x200D #x1F4BC)                                   "office worker: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F4BC)                                   "office worker: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F4BC)                                   "office worker: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F4BC)                                   "office worker: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F4BC)                                   "office worker: dark skin tone")
-    ((#x1F468 #x200D #x1F4BC)                                         "man office worker")
-    ((#x1F468 #x1F3FB #x200D #x1F4BC)                                   "man office worker: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F4BC)                                   "man office worker: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F4BC)                                   "man office worker: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F4BC)                                   "man office worker: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F4BC)                                   "man office worker: dark skin tone")
-    ((#x1F469 #x200D #x1F4BC)                                         "woman office worker")
-    ((#x1F469 #x1F3FB #x200D #x1F4BC)                                   "woman office worker: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F4BC)                                   "woman office worker: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F4BC)                                   "woman office worker: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F4BC)                                   "woman office worker: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F4BC)                                   "woman office worker: dark skin tone")
-    ((#x1F9D1 #x200D #x1F52C)                                         "scientist")
-    ((#x1F9D1 #x1F3FB #x200D #x1F52C)                                   "scientist: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F52C)                                   "scientist: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F52C)                                   "scientist: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F52C)                                   "scientist: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F52C)                                   "scientist: dark skin tone")
-    ((#x1F468 #x200D #x1F52C)                                         "man scientist")
-    ((#x1F468 #x1F3FB #x200D #x1F52C)                                   "man scientist: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F52C)                                   "man scientist: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F52C)                                   "man scientist: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F52C)                                   "man scientist: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F52C)                                   "man scientist: dark skin tone")
-    ((#x1F469 #x200D #x1F52C)                                         "woman scientist")
-    ((#x1F469 #x1F3FB #x200D #x1F52C)                                   "woman scientist: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F52C)                                   "woman scientist: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F52C)                                   "woman scientist: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F52C)                                   "woman scientist: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F52C)                                   "woman scientist: dark skin tone")
-    ((#x1F9D1 #x200D #x1F4BB)                                         "technologist")
-    ((#x1F9D1 #x1F3FB #x200D #x1F4BB)                                   "technologist: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F4BB)                                   "technologist: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F4BB)                                   "technologist: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F4BB)                                   "technologist: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F4BB)                                   "technologist: dark skin tone")
-    ((#x1F468 #x200D #x1F4BB)                                         "man technologist")
-    ((#x1F468 #x1F3FB #x200D #x1F4BB)                                   "man technologist: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F4BB)                                   "man technologist: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F4BB)                                   "man technologist: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F4BB)                                   "man technologist: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F4BB)                                   "man technologist: dark skin tone")
-    ((#x1F469 #x200D #x1F4BB)                                         "woman technologist")
-    ((#x1F469 #x1F3FB #x200D #x1F4BB)                                   "woman technologist: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F4BB)                                   "woman technologist: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F4BB)                                   "woman technologist: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F4BB)                                   "woman technologist: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F4BB)                                   "woman technologist: dark skin tone")
-    ((#x1F9D1 #x200D #x1F3A4)                                         "singer")
-    ((#x1F9D1 #x1F3FB #x200D #x1F3A4)                                   "singer: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F3A4)                                   "singer: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F3A4)                                   "singer: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F3A4)                                   "singer: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F3A4)                                   "singer: dark skin tone")
-    ((#x1F468 #x200D #x1F3A4)                                         "man singer")
-    ((#x1F468 #x1F3FB #x200D #x1F3A4)                                   "man singer: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F3A4)                                   "man singer: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F3A4)                                   "man singer: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F3A4)                                   "man singer: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F3A4)                                   "man singer: dark skin tone")
-    ((#x1F469 #x200D #x1F3A4)                                         "woman singer")
-    ((#x1F469 #x1F3FB #x200D #x1F3A4)                                   "woman singer: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F3A4)                                   "woman singer: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F3A4)                                   "woman singer: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F3A4)                                   "woman singer: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F3A4)                                   "woman singer: dark skin tone")
-    ((#x1F9D1 #x200D #x1F3A8)                                         "artist")
-    ((#x1F9D1 #x1F3FB #x200D #x1F3A8)                                   "artist: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F3A8)                                   "artist: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F3A8)                                   "artist: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F3A8)                                   "artist: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F3A8)                                   "artist: dark skin tone")
-    ((#x1F468 #x200D #x1F3A8)                                         "man artist")
-    ((#x1F468 #x1F3FB #x200D #x1F3A8)                                   "man artist: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F3A8)                                   "man artist: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F3A8)                                   "man artist: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F3A8)                                   "man artist: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F3A8)                                   "man artist: dark skin tone")
-    ((#x1F469 #x200D #x1F3A8)                                         "woman artist")
-    ((#x1F469 #x1F3FB #x200D #x1F3A8)                                   "woman artist: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F3A8)                                   "woman artist: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F3A8)                                   "woman artist: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F3A8)                                   "woman artist: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F3A8)                                   "woman artist: dark skin tone")
-    ((#x1F9D1 #x200D #x2708 #xFE0F)                                     "pilot")
-    ((#x1F9D1 #x1F3FB #x200D #x2708 #xFE0F)                               "pilot: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2708 #xFE0F)                               "pilot: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2708 #xFE0F)                               "pilot: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2708 #xFE0F)                               "pilot: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2708 #xFE0F)                               "pilot: dark skin tone")
-    ((#x1F468 #x200D #x2708 #xFE0F)                                     "man pilot")
-    ((#x1F468 #x1F3FB #x200D #x2708 #xFE0F)                               "man pilot: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2708 #xFE0F)                               "man pilot: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2708 #xFE0F)                               "man pilot: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2708 #xFE0F)                               "man pilot: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2708 #xFE0F)                               "man pilot: dark skin tone")
-    ((#x1F469 #x200D #x2708 #xFE0F)                                     "woman pilot")
-    ((#x1F469 #x1F3FB #x200D #x2708 #xFE0F)                               "woman pilot: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2708 #xFE0F)                               "woman pilot: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2708 #xFE0F)                               "woman pilot: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2708 #xFE0F)                               "woman pilot: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2708 #xFE0F)                               "woman pilot: dark skin tone")
-    ((#x1F9D1 #x200D #x1F680)                                         "astronaut")
-    ((#x1F9D1 #x1F3FB #x200D #x1F680)                                   "astronaut: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F680)                                   "astronaut: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F680)                                   "astronaut: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F680)                                   "astronaut: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F680)                                   "astronaut: dark skin tone")
-    ((#x1F468 #x200D #x1F680)                                         "man astronaut")
-    ((#x1F468 #x1F3FB #x200D #x1F680)                                   "man astronaut: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F680)                                   "man astronaut: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F680)                                   "man astronaut: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F680)                                   "man astronaut: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F680)                                   "man astronaut: dark skin tone")
-    ((#x1F469 #x200D #x1F680)                                         "woman astronaut")
-    ((#x1F469 #x1F3FB #x200D #x1F680)                                   "woman astronaut: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F680)                                   "woman astronaut: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F680)                                   "woman astronaut: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F680)                                   "woman astronaut: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F680)                                   "woman astronaut: dark skin tone")
-    ((#x1F9D1 #x200D #x1F692)                                         "firefighter")
-    ((#x1F9D1 #x1F3FB #x200D #x1F692)                                   "firefighter: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F692)                                   "firefighter: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F692)                                   "firefighter: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F692)                                   "firefighter: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F692)                                   "firefighter: dark skin tone")
-    ((#x1F468 #x200D #x1F692)                                         "man firefighter")
-    ((#x1F468 #x1F3FB #x200D #x1F692)                                   "man firefighter: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F692)                                   "man firefighter: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F692)                                   "man firefighter: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F692)                                   "man firefighter: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F692)                                   "man firefighter: dark skin tone")
-    ((#x1F469 #x200D #x1F692)                                         "woman firefighter")
-    ((#x1F469 #x1F3FB #x200D #x1F692)                                   "woman firefighter: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F692)                                   "woman firefighter: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F692)                                   "woman firefighter: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F692)                                   "woman firefighter: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F692)                                   "woman firefighter: dark skin tone")
-    ((#x1F46E)                                                    "police officer")
-    ((#x1F46E #x1F3FB)                                              "police officer: light skin tone")
-    ((#x1F46E #x1F3FC)                                              "police officer: medium-light skin tone")
-    ((#x1F46E #x1F3FD)                                              "police officer: medium skin tone")
-    ((#x1F46E #x1F3FE)                                              "police officer: medium-dark skin tone")
-    ((#x1F46E #x1F3FF)                                              "police officer: dark skin tone")
-    ((#x1F46E #x200D #x2642 #xFE0F)                                     "man police officer")
-    ((#x1F46E #x1F3FB #x200D #x2642 #xFE0F)                               "man police officer: light skin tone")
-    ((#x1F46E #x1F3FC #x200D #x2642 #xFE0F)                               "man police officer: medium-light skin tone")
-    ((#x1F46E #x1F3FD #x200D #x2642 #xFE0F)                               "man police officer: medium skin tone")
-    ((#x1F46E #x1F3FE #x200D #x2642 #xFE0F)                               "man police officer: medium-dark skin tone")
-    ((#x1F46E #x1F3FF #x200D #x2642 #xFE0F)                               "man police officer: dark skin tone")
-    ((#x1F46E #x200D #x2640 #xFE0F)                                     "woman police officer")
-    ((#x1F46E #x1F3FB #x200D #x2640 #xFE0F)                               "woman police officer: light skin tone")
-    ((#x1F46E #x1F3FC #x200D #x2640 #xFE0F)                               "woman police officer: medium-light skin tone")
-    ((#x1F46E #x1F3FD #x200D #x2640 #xFE0F)                               "woman police officer: medium skin tone")
-    ((#x1F46E #x1F3FE #x200D #x2640 #xFE0F)                               "woman police officer: medium-dark skin tone")
-    ((#x1F46E #x1F3FF #x200D #x2640 #xFE0F)                               "woman police officer: dark skin tone")
-    ((#x1F575 #xFE0F)                                               "detective")
-    ((#x1F575 #x1F3FB)                                              "detective: light skin tone")
-    ((#x1F575 #x1F3FC)                                              "detective: medium-light skin tone")
-    ((#x1F575 #x1F3FD)                                              "detective: medium skin tone")
-    ((#x1F575 #x1F3FE)                                              "detective: medium-dark skin tone")
-    ((#x1F575 #x1F3FF)                                              "detective: dark skin tone")
-    ((#x1F575 #xFE0F #x200D #x2642 #xFE0F)                                "man detective")
-    ((#x1F575 #x1F3FB #x200D #x2642 #xFE0F)                               "man detective: light skin tone")
-    ((#x1F575 #x1F3FC #x200D #x2642 #xFE0F)                               "man detective: medium-light skin tone")
-    ((#x1F575 #x1F3FD #x200D #x2642 #xFE0F)                               "man detective: medium skin tone")
-    ((#x1F575 #x1F3FE #x200D #x2642 #xFE0F)                               "man detective: medium-dark skin tone")
-    ((#x1F575 #x1F3FF #x200D #x2642 #xFE0F)                               "man detective: dark skin tone")
-    ((#x1F575 #xFE0F #x200D #x2640 #xFE0F)                                "woman detective")
-    ((#x1F575 #x1F3FB #x200D #x2640 #xFE0F)                               "woman detective: light skin tone")
-    ((#x1F575 #x1F3FC #x200D #x2640 #xFE0F)                               "woman detective: medium-light skin tone")
-    ((#x1F575 #x1F3FD #x200D #x2640 #xFE0F)                               "woman detective: medium skin tone")
-    ((#x1F575 #x1F3FE #x200D #x2640 #xFE0F)                               "woman detective: medium-dark skin tone")
-    ((#x1F575 #x1F3FF #x200D #x2640 #xFE0F)                               "woman detective: dark skin tone")
-    ((#x1F482)                                                    "guard")
-    ((#x1F482 #x1F3FB)                                              "guard: light skin tone")
-    ((#x1F482 #x1F3FC)                                              "guard: medium-light skin tone")
-    ((#x1F482 #x1F3FD)                                              "guard: medium skin tone")
-    ((#x1F482 #x1F3FE)                                              "guard: medium-dark skin tone")
-    ((#x1F482 #x1F3FF)                                              "guard: dark skin tone")
-    ((#x1F482 #x200D #x2642 #xFE0F)                                     "man guard")
-    ((#x1F482 #x1F3FB #x200D #x2642 #xFE0F)                               "man guard: light skin tone")
-    ((#x1F482 #x1F3FC #x200D #x2642 #xFE0F)                               "man guard: medium-light skin tone")
-    ((#x1F482 #x1F3FD #x200D #x2642 #xFE0F)                               "man guard: medium skin tone")
-    ((#x1F482 #x1F3FE #x200D #x2642 #xFE0F)                               "man guard: medium-dark skin tone")
-    ((#x1F482 #x1F3FF #x200D #x2642 #xFE0F)                               "man guard: dark skin tone")
-    ((#x1F482 #x200D #x2640 #xFE0F)                                     "woman guard")
-    ((#x1F482 #x1F3FB #x200D #x2640 #xFE0F)                               "woman guard: light skin tone")
-    ((#x1F482 #x1F3FC #x200D #x2640 #xFE0F)                               "woman guard: medium-light skin tone")
-    ((#x1F482 #x1F3FD #x200D #x2640 #xFE0F)                               "woman guard: medium skin tone")
-    ((#x1F482 #x1F3FE #x200D #x2640 #xFE0F)                               "woman guard: medium-dark skin tone")
-    ((#x1F482 #x1F3FF #x200D #x2640 #xFE0F)                               "woman guard: dark skin tone")
-    ((#x1F977)                                                    "ninja")
-    ((#x1F977 #x1F3FB)                                              "ninja: light skin tone")
-    ((#x1F977 #x1F3FC)                                              "ninja: medium-light skin tone")
-    ((#x1F977 #x1F3FD)                                              "ninja: medium skin tone")
-    ((#x1F977 #x1F3FE)                                              "ninja: medium-dark skin tone")
-    ((#x1F977 #x1F3FF)                                              "ninja: dark skin tone")
-    ((#x1F477)                                                    "construction worker")
-    ((#x1F477 #x1F3FB)                                              "construction worker: light skin tone")
-    ((#x1F477 #x1F3FC)                                              "construction worker: medium-light skin tone")
-    ((#x1F477 #x1F3FD)                                              "construction worker: medium skin tone")
-    ((#x1F477 #x1F3FE)                                              "construction worker: medium-dark skin tone")
-    ((#x1F477 #x1F3FF)                                              "construction worker: dark skin tone")
-    ((#x1F477 #x200D #x2642 #xFE0F)                                     "man construction worker")
-    ((#x1F477 #x1F3FB #x200D #x2642 #xFE0F)                               "man construction worker: light skin tone")
-    ((#x1F477 #x1F3FC #x200D #x2642 #xFE0F)                               "man construction worker: medium-light skin tone")
-    ((#x1F477 #x1F3FD #x200D #x2642 #xFE0F)                               "man construction worker: medium skin tone")
-    ((#x1F477 #x1F3FE #x200D #x2642 #xFE0F)                               "man construction worker: medium-dark skin tone")
-    ((#x1F477 #x1F3FF #x200D #x2642 #xFE0F)                               "man construction worker: dark skin tone")
-    ((#x1F477 #x200D #x2640 #xFE0F)                                     "woman construction worker")
-    ((#x1F477 #x1F3FB #x200D #x2640 #xFE0F)                               "woman construction worker: light skin tone")
-    ((#x1F477 #x1F3FC #x200D #x2640 #xFE0F)                               "woman construction worker: medium-light skin tone")
-    ((#x1F477 #x1F3FD #x200D #x2640 #xFE0F)                               "woman construction worker: medium skin tone")
-    ((#x1F477 #x1F3FE #x200D #x2640 #xFE0F)                               "woman construction worker: medium-dark skin tone")
-    ((#x1F477 #x1F3FF #x200D #x2640 #xFE0F)                               "woman construction worker: dark skin tone")
-    ((#x1FAC5)                                                    "person with crown")
-    ((#x1FAC5 #x1F3FB)                                              "person with crown: light skin tone")
-    ((#x1FAC5 #x1F3FC)                                              "person with crown: medium-light skin tone")
-    ((#x1FAC5 #x1F3FD)                                              "person with crown: medium skin tone")
-    ((#x1FAC5 #x1F3FE)                                              "person with crown: medium-dark skin tone")
-    ((#x1FAC5 #x1F3FF)                                              "person with crown: dark skin tone")
-    ((#x1F934)                                                    "prince")
-    ((#x1F934 #x1F3FB)                                              "prince: light skin tone")
-    ((#x1F934 #x1F3FC)                                              "prince: medium-light skin tone")
-    ((#x1F934 #x1F3FD)                                              "prince: medium skin tone")
-    ((#x1F934 #x1F3FE)                                              "prince: medium-dark skin tone")
-    ((#x1F934 #x1F3FF)                                              "prince: dark skin tone")
-    ((#x1F478)                                                    "princess")
-    ((#x1F478 #x1F3FB)                                              "princess: light skin tone")
-    ((#x1F478 #x1F3FC)                                              "princess: medium-light skin tone")
-    ((#x1F478 #x1F3FD)                                              "princess: medium skin tone")
-    ((#x1F478 #x1F3FE)                                              "princess: medium-dark skin tone")
-    ((#x1F478 #x1F3FF)                                              "princess: dark skin tone")
-    ((#x1F473)                                                    "person wearing turban")
-    ((#x1F473 #x1F3FB)                                              "person wearing turban: light skin tone")
-    ((#x1F473 #x1F3FC)                                              "person wearing turban: medium-light skin tone")
-    ((#x1F473 #x1F3FD)                                              "person wearing turban: medium skin tone")
-    ((#x1F473 #x1F3FE)                                              "person wearing turban: medium-dark skin tone")
-    ((#x1F473 #x1F3FF)                                              "person wearing turban: dark skin tone")
-    ((#x1F473 #x200D #x2642 #xFE0F)                                     "man wearing turban")
-    ((#x1F473 #x1F3FB #x200D #x2642 #xFE0F)                               "man wearing turban: light skin tone")
-    ((#x1F473 #x1F3FC #x200D #x2642 #xFE0F)                               "man wearing turban: medium-light skin tone")
-    ((#x1F473 #x1F3FD #x200D #x2642 #xFE0F)                               "man wearing turban: medium skin tone")
-    ((#x1F473 #x1F3FE #x200D #x2642 #xFE0F)                               "man wearing turban: medium-dark skin tone")
-    ((#x1F473 #x1F3FF #x200D #x2642 #xFE0F)                               "man wearing turban: dark skin tone")
-    ((#x1F473 #x200D #x2640 #xFE0F)                                     "woman wearing turban")
-    ((#x1F473 #x1F3FB #x200D #x2640 #xFE0F)                               "woman wearing turban: light skin tone")
-    ((#x1F473 #x1F3FC #x200D #x2640 #xFE0F)                               "woman wearing turban: medium-light skin tone")
-    ((#x1F473 #x1F3FD #x200D #x2640 #xFE0F)                               "woman wearing turban: medium skin tone")
-    ((#x1F473 #x1F3FE #x200D #x2640 #xFE0F)                               "woman wearing turban: medium-dark skin tone")
-    ((#x1F473 #x1F3FF #x200D #x2640 #xFE0F)                               "woman wearing turban: dark skin tone")
-    ((#x1F472)                                                    "person with skullcap")
-    ((#x1F472 #x1F3FB)                                              "person with skullcap: light skin tone")
-    ((#x1F472 #x1F3FC)                                              "person with skullcap: medium-light skin tone")
-    ((#x1F472 #x1F3FD)                                              "person with skullcap: medium skin tone")
-    ((#x1F472 #x1F3FE)                                              "person with skullcap: medium-dark skin tone")
-    ((#x1F472 #x1F3FF)                                              "person with skullcap: dark skin tone")
-    ((#x1F9D5)                                                    "woman with headscarf")
-    ((#x1F9D5 #x1F3FB)                                              "woman with headscarf: light skin tone")
-    ((#x1F9D5 #x1F3FC)                                              "woman with headscarf: medium-light skin tone")
-    ((#x1F9D5 #x1F3FD)                                              "woman with headscarf: medium skin tone")
-    ((#x1F9D5 #x1F3FE)                                              "woman with headscarf: medium-dark skin tone")
-    ((#x1F9D5 #x1F3FF)                                              "woman with headscarf: dark skin tone")
-    ((#x1F935)                                                    "person in tuxedo")
-    ((#x1F935 #x1F3FB)                                              "person in tuxedo: light skin tone")
-    ((#x1F935 #x1F3FC)                                              "person in tuxedo: medium-light skin tone")
-    ((#x1F935 #x1F3FD)                                              "person in tuxedo: medium skin tone")
-    ((#x1F935 #x1F3FE)                                              "person in tuxedo: medium-dark skin tone")
-    ((#x1F935 #x1F3FF)                                              "person in tuxedo: dark skin tone")
-    ((#x1F935 #x200D #x2642 #xFE0F)                                     "man in tuxedo")
-    ((#x1F935 #x1F3FB #x200D #x2642 #xFE0F)                               "man in tuxedo: light skin tone")
-    ((#x1F935 #x1F3FC #x200D #x2642 #xFE0F)                               "man in tuxedo: medium-light skin tone")
-    ((#x1F935 #x1F3FD #x200D #x2642 #xFE0F)                               "man in tuxedo: medium skin tone")
-    ((#x1F935 #x1F3FE #x200D #x2642 #xFE0F)                               "man in tuxedo: medium-dark skin tone")
-    ((#x1F935 #x1F3FF #x200D #x2642 #xFE0F)                               "man in tuxedo: dark skin tone")
-    ((#x1F935 #x200D #x2640 #xFE0F)                                     "woman in tuxedo")
-    ((#x1F935 #x1F3FB #x200D #x2640 #xFE0F)                               "woman in tuxedo: light skin tone")
-    ((#x1F935 #x1F3FC #x200D #x2640 #xFE0F)                               "woman in tuxedo: medium-light skin tone")
-    ((#x1F935 #x1F3FD #x200D #x2640 #xFE0F)                               "woman in tuxedo: medium skin tone")
-    ((#x1F935 #x1F3FE #x200D #x2640 #xFE0F)                               "woman in tuxedo: medium-dark skin tone")
-    ((#x1F935 #x1F3FF #x200D #x2640 #xFE0F)                               "woman in tuxedo: dark skin tone")
-    ((#x1F470)                                                    "person with veil")
-    ((#x1F470 #x1F3FB)                                              "person with veil: light skin tone")
-    ((#x1F470 #x1F3FC)                                              "person with veil: medium-light skin tone")
-    ((#x1F470 #x1F3FD)                                              "person with veil: medium skin tone")
-    ((#x1F470 #x1F3FE)                                              "person with veil: medium-dark skin tone")
-    ((#x1F470 #x1F3FF)                                              "person with veil: dark skin tone")
-    ((#x1F470 #x200D #x2642 #xFE0F)                                     "man with veil")
-    ((#x1F470 #x1F3FB #x200D #x2642 #xFE0F)                               "man with veil: light skin tone")
-    ((#x1F470 #x1F3FC #x200D #x2642 #xFE0F)                               "man with veil: medium-light skin tone")
-    ((#x1F470 #x1F3FD #x200D #x2642 #xFE0F)                               "man with veil: medium skin tone")
-    ((#x1F470 #x1F3FE #x200D #x2642 #xFE0F)                               "man with veil: medium-dark skin tone")
-    ((#x1F470 #x1F3FF #x200D #x2642 #xFE0F)                               "man with veil: dark skin tone")
-    ((#x1F470 #x200D #x2640 #xFE0F)                                     "woman with veil")
-    ((#x1F470 #x1F3FB #x200D #x2640 #xFE0F)                               "woman with veil: light skin tone")
-    ((#x1F470 #x1F3FC #x200D #x2640 #xFE0F)                               "woman with veil: medium-light skin tone")
-    ((#x1F470 #x1F3FD #x200D #x2640 #xFE0F)                               "woman with veil: medium skin tone")
-    ((#x1F470 #x1F3FE #x200D #x2640 #xFE0F)                               "woman with veil: medium-dark skin tone")
-    ((#x1F470 #x1F3FF #x200D #x2640 #xFE0F)                               "woman with veil: dark skin tone")
-    ((#x1F930)                                                    "pregnant woman")
-    ((#x1F930 #x1F3FB)                                              "pregnant woman: light skin tone")
-    ((#x1F930 #x1F3FC)                                              "pregnant woman: medium-light skin tone")
-    ((#x1F930 #x1F3FD)                                              "pregnant woman: medium skin tone")
-    ((#x1F930 #x1F3FE)                                              "pregnant woman: medium-dark skin tone")
-    ((#x1F930 #x1F3FF)                                              "pregnant woman: dark skin tone")
-    ((#x1FAC3)                                                    "pregnant man")
-    ((#x1FAC3 #x1F3FB)                                              "pregnant man: light skin tone")
-    ((#x1FAC3 #x1F3FC)                                              "pregnant man: medium-light skin tone")
-    ((#x1FAC3 #x1F3FD)                                              "pregnant man: medium skin tone")
-    ((#x1FAC3 #x1F3FE)                                              "pregnant man: medium-dark skin tone")
-    ((#x1FAC3 #x1F3FF)                                              "pregnant man: dark skin tone")
-    ((#x1FAC4)                                                    "pregnant person")
-    ((#x1FAC4 #x1F3FB)                                              "pregnant person: light skin tone")
-    ((#x1FAC4 #x1F3FC)                                              "pregnant person: medium-light skin tone")
-    ((#x1FAC4 #x1F3FD)                                              "pregnant person: medium skin tone")
-    ((#x1FAC4 #x1F3FE)                                              "pregnant person: medium-dark skin tone")
-    ((#x1FAC4 #x1F3FF)                                              "pregnant person: dark skin tone")
-    ((#x1F931)                                                    "breast-feeding")
-    ((#x1F931 #x1F3FB)                                              "breast-feeding: light skin tone")
-    ((#x1F931 #x1F3FC)                                              "breast-feeding: medium-light skin tone")
-    ((#x1F931 #x1F3FD)                                              "breast-feeding: medium skin tone")
-    ((#x1F931 #x1F3FE)                                              "breast-feeding: medium-dark skin tone")
-    ((#x1F931 #x1F3FF)                                              "breast-feeding: dark skin tone")
-    ((#x1F469 #x200D #x1F37C)                                         "woman feeding baby")
-    ((#x1F469 #x1F3FB #x200D #x1F37C)                                   "woman feeding baby: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F37C)                                   "woman feeding baby: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F37C)                                   "woman feeding baby: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F37C)                                   "woman feeding baby: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F37C)                                   "woman feeding baby: dark skin tone")
-    ((#x1F468 #x200D #x1F37C)                                         "man feeding baby")
-    ((#x1F468 #x1F3FB #x200D #x1F37C)                                   "man feeding baby: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F37C)                                   "man feeding baby: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F37C)                                   "man feeding baby: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F37C)                                   "man feeding baby: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F37C)                                   "man feeding baby: dark skin tone")
-    ((#x1F9D1 #x200D #x1F37C)                                         "person feeding baby")
-    ((#x1F9D1 #x1F3FB #x200D #x1F37C)                                   "person feeding baby: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F37C)                                   "person feeding baby: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F37C)                                   "person feeding baby: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F37C)                                   "person feeding baby: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F37C)                                   "person feeding baby: dark skin tone")
-    ((#x1F47C)                                                    "baby angel")
-    ((#x1F47C #x1F3FB)                                              "baby angel: light skin tone")
-    ((#x1F47C #x1F3FC)                                              "baby angel: medium-light skin tone")
-    ((#x1F47C #x1F3FD)                                              "baby angel: medium skin tone")
-    ((#x1F47C #x1F3FE)                                              "baby angel: medium-dark skin tone")
-    ((#x1F47C #x1F3FF)                                              "baby angel: dark skin tone")
-    ((#x1F385)                                                    "Santa Claus")
-    ((#x1F385 #x1F3FB)                                              "Santa Claus: light skin tone")
-    ((#x1F385 #x1F3FC)                                              "Santa Claus: medium-light skin tone")
-    ((#x1F385 #x1F3FD)                                              "Santa Claus: medium skin tone")
-    ((#x1F385 #x1F3FE)                                              "Santa Claus: medium-dark skin tone")
-    ((#x1F385 #x1F3FF)                                              "Santa Claus: dark skin tone")
-    ((#x1F936)                                                    "Mrs. Claus")
-    ((#x1F936 #x1F3FB)                                              "Mrs. Claus: light skin tone")
-    ((#x1F936 #x1F3FC)                                              "Mrs. Claus: medium-light skin tone")
-    ((#x1F936 #x1F3FD)                                              "Mrs. Claus: medium skin tone")
-    ((#x1F936 #x1F3FE)                                              "Mrs. Claus: medium-dark skin tone")
-    ((#x1F936 #x1F3FF)                                              "Mrs. Claus: dark skin tone")
-    ((#x1F9D1 #x200D #x1F384)                                         "Mx Claus")
-    ((#x1F9D1 #x1F3FB #x200D #x1F384)                                   "Mx Claus: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F384)                                   "Mx Claus: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F384)                                   "Mx Claus: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F384)                                   "Mx Claus: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F384)                                   "Mx Claus: dark skin tone")
-    ((#x1F9B8)                                                    "superhero")
-    ((#x1F9B8 #x1F3FB)                                              "superhero: light skin tone")
-    ((#x1F9B8 #x1F3FC)                                              "superhero: medium-light skin tone")
-    ((#x1F9B8 #x1F3FD)                                              "superhero: medium skin tone")
-    ((#x1F9B8 #x1F3FE)                                              "superhero: medium-dark skin tone")
-    ((#x1F9B8 #x1F3FF)                                              "superhero: dark skin tone")
-    ((#x1F9B8 #x200D #x2642 #xFE0F)                                     "man superhero")
-    ((#x1F9B8 #x1F3FB #x200D #x2642 #xFE0F)                               "man superhero: light skin tone")
-    ((#x1F9B8 #x1F3FC #x200D #x2642 #xFE0F)                               "man superhero: medium-light skin tone")
-    ((#x1F9B8 #x1F3FD #x200D #x2642 #xFE0F)                               "man superhero: medium skin tone")
-    ((#x1F9B8 #x1F3FE #x200D #x2642 #xFE0F)                               "man superhero: medium-dark skin tone")
-    ((#x1F9B8 #x1F3FF #x200D #x2642 #xFE0F)                               "man superhero: dark skin tone")
-    ((#x1F9B8 #x200D #x2640 #xFE0F)                                     "woman superhero")
-    ((#x1F9B8 #x1F3FB #x200D #x2640 #xFE0F)                               "woman superhero: light skin tone")
-    ((#x1F9B8 #x1F3FC #x200D #x2640 #xFE0F)                               "woman superhero: medium-light skin tone")
-    ((#x1F9B8 #x1F3FD #x200D #x2640 #xFE0F)                               "woman superhero: medium skin tone")
-    ((#x1F9B8 #x1F3FE #x200D #x2640 #xFE0F)                               "woman superhero: medium-dark skin tone")
-    ((#x1F9B8 #x1F3FF #x200D #x2640 #xFE0F)                               "woman superhero: dark skin tone")
-    ((#x1F9B9)                                                    "supervillain")
-    ((#x1F9B9 #x1F3FB)                                              "supervillain: light skin tone")
-    ((#x1F9B9 #x1F3FC)                                              "supervillain: medium-light skin tone")
-    ((#x1F9B9 #x1F3FD)                                              "supervillain: medium skin tone")
-    ((#x1F9B9 #x1F3FE)                                              "supervillain: medium-dark skin tone")
-    ((#x1F9B9 #x1F3FF)                                              "supervillain: dark skin tone")
-    ((#x1F9B9 #x200D #x2642 #xFE0F)                                     "man supervillain")
-    ((#x1F9B9 #x1F3FB #x200D #x2642 #xFE0F)                               "man supervillain: light skin tone")
-    ((#x1F9B9 #x1F3FC #x200D #x2642 #xFE0F)                               "man supervillain: medium-light skin tone")
-    ((#x1F9B9 #x1F3FD #x200D #x2642 #xFE0F)                               "man supervillain: medium skin tone")
-    ((#x1F9B9 #x1F3FE #x200D #x2642 #xFE0F)                               "man supervillain: medium-dark skin tone")
-    ((#x1F9B9 #x1F3FF #x200D #x2642 #xFE0F)                               "man supervillain: dark skin tone")
-    ((#x1F9B9 #x200D #x2640 #xFE0F)                                     "woman supervillain")
-    ((#x1F9B9 #x1F3FB #x200D #x2640 #xFE0F)                               "woman supervillain: light skin tone")
-    ((#x1F9B9 #x1F3FC #x200D #x2640 #xFE0F)                               "woman supervillain: medium-light skin tone")
-    ((#x1F9B9 #x1F3FD #x200D #x2640 #xFE0F)                               "woman supervillain: medium skin tone")
-    ((#x1F9B9 #x1F3FE #x200D #x2640 #xFE0F)                               "woman supervillain: medium-dark skin tone")
-    ((#x1F9B9 #x1F3FF #x200D #x2640 #xFE0F)                               "woman supervillain: dark skin tone")
-    ((#x1F9D9)                                                    "mage")
-    ((#x1F9D9 #x1F3FB)                                              "mage: light skin tone")
-    ((#x1F9D9 #x1F3FC)                                              "mage: medium-light skin tone")
-    ((#x1F9D9 #x1F3FD)                                              "mage: medium skin tone")
-    ((#x1F9D9 #x1F3FE)                                              "mage: medium-dark skin tone")
-    ((#x1F9D9 #x1F3FF)                                              "mage: dark skin tone")
-    ((#x1F9D9 #x200D #x2642 #xFE0F)                                     "man mage")
-    ((#x1F9D9 #x1F3FB #x200D #x2642 #xFE0F)                               "man mage: light skin tone")
-    ((#x1F9D9 #x1F3FC #x200D #x2642 #xFE0F)                               "man mage: medium-light skin tone")
-    ((#x1F9D9 #x1F3FD #x200D #x2642 #xFE0F)                               "man mage: medium skin tone")
-    ((#x1F9D9 #x1F3FE #x200D #x2642 #xFE0F)                               "man mage: medium-dark skin tone")
-    ((#x1F9D9 #x1F3FF #x200D #x2642 #xFE0F)                               "man mage: dark skin tone")
-    ((#x1F9D9 #x200D #x2640 #xFE0F)                                     "woman mage")
-    ((#x1F9D9 #x1F3FB #x200D #x2640 #xFE0F)                               "woman mage: light skin tone")
-    ((#x1F9D9 #x1F3FC #x200D #x2640 #xFE0F)                               "woman mage: medium-light skin tone")
-    ((#x1F9D9 #x1F3FD #x200D #x2640 #xFE0F)                               "woman mage: medium skin tone")
-    ((#x1F9D9 #x1F3FE #x200D #x2640 #xFE0F)                               "woman mage: medium-dark skin tone")
-    ((#x1F9D9 #x1F3FF #x200D #x2640 #xFE0F)                               "woman mage: dark skin tone")
-    ((#x1F9DA)                                                    "fairy")
-    ((#x1F9DA #x1F3FB)                                              "fairy: light skin tone")
-    ((#x1F9DA #x1F3FC)                                              "fairy: medium-light skin tone")
-    ((#x1F9DA #x1F3FD)                                              "fairy: medium skin tone")
-    ((#x1F9DA #x1F3FE)                                              "fairy: medium-dark skin tone")
-    ((#x1F9DA #x1F3FF)                                              "fairy: dark skin tone")
-    ((#x1F9DA #x200D #x2642 #xFE0F)                                     "man fairy")
-    ((#x1F9DA #x1F3FB #x200D #x2642 #xFE0F)                               "man fairy: light skin tone")
-    ((#x1F9DA #x1F3FC #x200D #x2642 #xFE0F)                               "man fairy: medium-light skin tone")
-    ((#x1F9DA #x1F3FD #x200D #x2642 #xFE0F)                               "man fairy: medium skin tone")
-    ((#x1F9DA #x1F3FE #x200D #x2642 #xFE0F)                               "man fairy: medium-dark skin tone")
-    ((#x1F9DA #x1F3FF #x200D #x2642 #xFE0F)                               "man fairy: dark skin tone")
-    ((#x1F9DA #x200D #x2640 #xFE0F)                                     "woman fairy")
-    ((#x1F9DA #x1F3FB #x200D #x2640 #xFE0F)                               "woman fairy: light skin tone")
-    ((#x1F9DA #x1F3FC #x200D #x2640 #xFE0F)                               "woman fairy: medium-light skin tone")
-    ((#x1F9DA #x1F3FD #x200D #x2640 #xFE0F)                               "woman fairy: medium skin tone")
-    ((#x1F9DA #x1F3FE #x200D #x2640 #xFE0F)                               "woman fairy: medium-dark skin tone")
-    ((#x1F9DA #x1F3FF #x200D #x2640 #xFE0F)                               "woman fairy: dark skin tone")
-    ((#x1F9DB)                                                    "vampire")
-    ((#x1F9DB #x1F3FB)                                              "vampire: light skin tone")
-    ((#x1F9DB #x1F3FC)                                              "vampire: medium-light skin tone")
-    ((#x1F9DB #x1F3FD)                                              "vampire: medium skin tone")
-    ((#x1F9DB #x1F3FE)                                              "vampire: medium-dark skin tone")
-    ((#x1F9DB #x1F3FF)                                              "vampire: dark skin tone")
-    ((#x1F9DB #x200D #x2642 #xFE0F)                                     "man vampire")
-    ((#x1F9DB #x1F3FB #x200D #x2642 #xFE0F)                               "man vampire: light skin tone")
-    ((#x1F9DB #x1F3FC #x200D #x2642 #xFE0F)                               "man vampire: medium-light skin tone")
-    ((#x1F9DB #x1F3FD #x200D #x2642 #xFE0F)                               "man vampire: medium skin tone")
-    ((#x1F9DB #x1F3FE #x200D #x2642 #xFE0F)                               "man vampire: medium-dark skin tone")
-    ((#x1F9DB #x1F3FF #x200D #x2642 #xFE0F)                               "man vampire: dark skin tone")
-    ((#x1F9DB #x200D #x2640 #xFE0F)                                     "woman vampire")
-    ((#x1F9DB #x1F3FB #x200D #x2640 #xFE0F)                               "woman vampire: light skin tone")
-    ((#x1F9DB #x1F3FC #x200D #x2640 #xFE0F)                               "woman vampire: medium-light skin tone")
-    ((#x1F9DB #x1F3FD #x200D #x2640 #xFE0F)                               "woman vampire: medium skin tone")
-    ((#x1F9DB #x1F3FE #x200D #x2640 #xFE0F)                               "woman vampire: medium-dark skin tone")
-    ((#x1F9DB #x1F3FF #x200D #x2640 #xFE0F)                               "woman vampire: dark skin tone")
-    ((#x1F9DC)                                                    "merperson")
-    ((#x1F9DC #x1F3FB)                                              "merperson: light skin tone")
-    ((#x1F9DC #x1F3FC)                                              "merperson: medium-light skin tone")
-    ((#x1F9DC #x1F3FD)                                              "merperson: medium skin tone")
-    ((#x1F9DC #x1F3FE)                                              "merperson: medium-dark skin tone")
-    ((#x1F9DC #x1F3FF)                                              "merperson: dark skin tone")
-    ((#x1F9DC #x200D #x2642 #xFE0F)                                     "merman")
-    ((#x1F9DC #x1F3FB #x200D #x2642 #xFE0F)                               "merman: light skin tone")
-    ((#x1F9DC #x1F3FC #x200D #x2642 #xFE0F)                               "merman: medium-light skin tone")
-    ((#x1F9DC #x1F3FD #x200D #x2642 #xFE0F)                               "merman: medium skin tone")
-    ((#x1F9DC #x1F3FE #x200D #x2642 #xFE0F)                               "merman: medium-dark skin tone")
-    ((#x1F9DC #x1F3FF #x200D #x2642 #xFE0F)                               "merman: dark skin tone")
-    ((#x1F9DC #x200D #x2640 #xFE0F)                                     "mermaid")
-    ((#x1F9DC #x1F3FB #x200D #x2640 #xFE0F)                               "mermaid: light skin tone")
-    ((#x1F9DC #x1F3FC #x200D #x2640 #xFE0F)                               "mermaid: medium-light skin tone")
-    ((#x1F9DC #x1F3FD #x200D #x2640 #xFE0F)                               "mermaid: medium skin tone")
-    ((#x1F9DC #x1F3FE #x200D #x2640 #xFE0F)                               "mermaid: medium-dark skin tone")
-    ((#x1F9DC #x1F3FF #x200D #x2640 #xFE0F)                               "mermaid: dark skin tone")
-    ((#x1F9DD)                                                    "elf")
-    ((#x1F9DD #x1F3FB)                                              "elf: light skin tone")
-    ((#x1F9DD #x1F3FC)                                              "elf: medium-light skin tone")
-    ((#x1F9DD #x1F3FD)                                              "elf: medium skin tone")
-    ((#x1F9DD #x1F3FE)                                              "elf: medium-dark skin tone")
-    ((#x1F9DD #x1F3FF)                                              "elf: dark skin tone")
-    ((#x1F9DD #x200D #x2642 #xFE0F)                                     "man elf")
-    ((#x1F9DD #x1F3FB #x200D #x2642 #xFE0F)                               "man elf: light skin tone")
-    ((#x1F9DD #x1F3FC #x200D #x2642 #xFE0F)                               "man elf: medium-light skin tone")
-    ((#x1F9DD #x1F3FD #x200D #x2642 #xFE0F)                               "man elf: medium skin tone")
-    ((#x1F9DD #x1F3FE #x200D #x2642 #xFE0F)                               "man elf: medium-dark skin tone")
-    ((#x1F9DD #x1F3FF #x200D #x2642 #xFE0F)                               "man elf: dark skin tone")
-    ((#x1F9DD #x200D #x2640 #xFE0F)                                     "woman elf")
-    ((#x1F9DD #x1F3FB #x200D #x2640 #xFE0F)                               "woman elf: light skin tone")
-    ((#x1F9DD #x1F3FC #x200D #x2640 #xFE0F)                               "woman elf: medium-light skin tone")
-    ((#x1F9DD #x1F3FD #x200D #x2640 #xFE0F)                               "woman elf: medium skin tone")
-    ((#x1F9DD #x1F3FE #x200D #x2640 #xFE0F)                               "woman elf: medium-dark skin tone")
-    ((#x1F9DD #x1F3FF #x200D #x2640 #xFE0F)                               "woman elf: dark skin tone")
-    ((#x1F9DE)                                                    "genie")
-    ((#x1F9DE #x200D #x2642 #xFE0F)                                     "man genie")
-    ((#x1F9DE #x200D #x2640 #xFE0F)                                     "woman genie")
-    ((#x1F9DF)                                                    "zombie")
-    ((#x1F9DF #x200D #x2642 #xFE0F)                                     "man zombie")
-    ((#x1F9DF #x200D #x2640 #xFE0F)                                     "woman zombie")
-    ((#x1F9CC)                                                    "troll")
-    ((#x1FAC8)                                                    "hairy creature")
-    ((#x1F486)                                                    "person getting massage")
-    ((#x1F486 #x1F3FB)                                              "person getting massage: light skin tone")
-    ((#x1F486 #x1F3FC)                                              "person getting massage: medium-light skin tone")
-    ((#x1F486 #x1F3FD)                                              "person getting massage: medium skin tone")
-    ((#x1F486 #x1F3FE)                                              "person getting massage: medium-dark skin tone")
-    ((#x1F486 #x1F3FF)                                              "person getting massage: dark skin tone")
-    ((#x1F486 #x200D #x2642 #xFE0F)                                     "man getting massage")
-    ((#x1F486 #x1F3FB #x200D #x2642 #xFE0F)                               "man getting massage: light skin tone")
-    ((#x1F486 #x1F3FC #x200D #x2642 #xFE0F)                               "man getting massage: medium-light skin tone")
-    ((#x1F486 #x1F3FD #x200D #x2642 #xFE0F)                               "man getting massage: medium skin tone")
-    ((#x1F486 #x1F3FE #x200D #x2642 #xFE0F)                               "man getting massage: medium-dark skin tone")
-    ((#x1F486 #x1F3FF #x200D #x2642 #xFE0F)                               "man getting massage: dark skin tone")
-    ((#x1F486 #x200D #x2640 #xFE0F)                                     "woman getting massage")
-    ((#x1F486 #x1F3FB #x200D #x2640 #xFE0F)                               "woman getting massage: light skin tone")
-    ((#x1F486 #x1F3FC #x200D #x2640 #xFE0F)                               "woman getting massage: medium-light skin tone")
-    ((#x1F486 #x1F3FD #x200D #x2640 #xFE0F)                               "woman getting massage: medium skin tone")
-    ((#x1F486 #x1F3FE #x200D #x2640 #xFE0F)                               "woman getting massage: medium-dark skin tone")
-    ((#x1F486 #x1F3FF #x200D #x2640 #xFE0F)                               "woman getting massage: dark skin tone")
-    ((#x1F487)                                                    "person getting haircut")
-    ((#x1F487 #x1F3FB)                                              "person getting haircut: light skin tone")
-    ((#x1F487 #x1F3FC)                                              "person getting haircut: medium-light skin tone")
-    ((#x1F487 #x1F3FD)                                              "person getting haircut: medium skin tone")
-    ((#x1F487 #x1F3FE)                                              "person getting haircut: medium-dark skin tone")
-    ((#x1F487 #x1F3FF)                                              "person getting haircut: dark skin tone")
-    ((#x1F487 #x200D #x2642 #xFE0F)                                     "man getting haircut")
-    ((#x1F487 #x1F3FB #x200D #x2642 #xFE0F)                               "man getting haircut: light skin tone")
-    ((#x1F487 #x1F3FC #x200D #x2642 #xFE0F)                               "man getting haircut: medium-light skin tone")
-    ((#x1F487 #x1F3FD #x200D #x2642 #xFE0F)                               "man getting haircut: medium skin tone")
-    ((#x1F487 #x1F3FE #x200D #x2642 #xFE0F)                               "man getting haircut: medium-dark skin tone")
-    ((#x1F487 #x1F3FF #x200D #x2642 #xFE0F)                               "man getting haircut: dark skin tone")
-    ((#x1F487 #x200D #x2640 #xFE0F)                                     "woman getting haircut")
-    ((#x1F487 #x1F3FB #x200D #x2640 #xFE0F)                               "woman getting haircut: light skin tone")
-    ((#x1F487 #x1F3FC #x200D #x2640 #xFE0F)                               "woman getting haircut: medium-light skin tone")
-    ((#x1F487 #x1F3FD #x200D #x2640 #xFE0F)                               "woman getting haircut: medium skin tone")
-    ((#x1F487 #x1F3FE #x200D #x2640 #xFE0F)                               "woman getting haircut: medium-dark skin tone")
-    ((#x1F487 #x1F3FF #x200D #x2640 #xFE0F)                               "woman getting haircut: dark skin tone")
-    ((#x1F6B6)                                                    "person walking")
-    ((#x1F6B6 #x1F3FB)                                              "person walking: light skin tone")
-    ((#x1F6B6 #x1F3FC)                                              "person walking: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD)                                              "person walking: medium skin tone")
-    ((#x1F6B6 #x1F3FE)                                              "person walking: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF)                                              "person walking: dark skin tone")
-    ((#x1F6B6 #x200D #x2642 #xFE0F)                                     "man walking")
-    ((#x1F6B6 #x1F3FB #x200D #x2642 #xFE0F)                               "man walking: light skin tone")
-    ((#x1F6B6 #x1F3FC #x200D #x2642 #xFE0F)                               "man walking: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD #x200D #x2642 #xFE0F)                               "man walking: medium skin tone")
-    ((#x1F6B6 #x1F3FE #x200D #x2642 #xFE0F)                               "man walking: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF #x200D #x2642 #xFE0F)                               "man walking: dark skin tone")
-    ((#x1F6B6 #x200D #x2640 #xFE0F)                                     "woman walking")
-    ((#x1F6B6 #x1F3FB #x200D #x2640 #xFE0F)                               "woman walking: light skin tone")
-    ((#x1F6B6 #x1F3FC #x200D #x2640 #xFE0F)                               "woman walking: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD #x200D #x2640 #xFE0F)                               "woman walking: medium skin tone")
-    ((#x1F6B6 #x1F3FE #x200D #x2640 #xFE0F)                               "woman walking: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF #x200D #x2640 #xFE0F)                               "woman walking: dark skin tone")
-    ((#x1F6B6 #x200D #x27A1 #xFE0F)                                     "person walking facing right")
-    ((#x1F6B6 #x1F3FB #x200D #x27A1 #xFE0F)                               "person walking facing right: light skin tone")
-    ((#x1F6B6 #x1F3FC #x200D #x27A1 #xFE0F)                               "person walking facing right: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD #x200D #x27A1 #xFE0F)                               "person walking facing right: medium skin tone")
-    ((#x1F6B6 #x1F3FE #x200D #x27A1 #xFE0F)                               "person walking facing right: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF #x200D #x27A1 #xFE0F)                               "person walking facing right: dark skin tone")
-    ((#x1F6B6 #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                      "woman walking facing right")
-    ((#x1F6B6 #x1F3FB #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman walking facing right: light skin tone")
-    ((#x1F6B6 #x1F3FC #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman walking facing right: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman walking facing right: medium skin tone")
-    ((#x1F6B6 #x1F3FE #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman walking facing right: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman walking facing right: dark skin tone")
-    ((#x1F6B6 #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                      "man walking facing right")
-    ((#x1F6B6 #x1F3FB #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man walking facing right: light skin tone")
-    ((#x1F6B6 #x1F3FC #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man walking facing right: medium-light skin tone")
-    ((#x1F6B6 #x1F3FD #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man walking facing right: medium skin tone")
-    ((#x1F6B6 #x1F3FE #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man walking facing right: medium-dark skin tone")
-    ((#x1F6B6 #x1F3FF #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man walking facing right: dark skin tone")
-    ((#x1F9CD)                                                    "person standing")
-    ((#x1F9CD #x1F3FB)                                              "person standing: light skin tone")
-    ((#x1F9CD #x1F3FC)                                              "person standing: medium-light skin tone")
-    ((#x1F9CD #x1F3FD)                                              "person standing: medium skin tone")
-    ((#x1F9CD #x1F3FE)                                              "person standing: medium-dark skin tone")
-    ((#x1F9CD #x1F3FF)                                              "person standing: dark skin tone")
-    ((#x1F9CD #x200D #x2642 #xFE0F)                                     "man standing")
-    ((#x1F9CD #x1F3FB #x200D #x2642 #xFE0F)                               "man standing: light skin tone")
-    ((#x1F9CD #x1F3FC #x200D #x2642 #xFE0F)                               "man standing: medium-light skin tone")
-    ((#x1F9CD #x1F3FD #x200D #x2642 #xFE0F)                               "man standing: medium skin tone")
-    ((#x1F9CD #x1F3FE #x200D #x2642 #xFE0F)                               "man standing: medium-dark skin tone")
-    ((#x1F9CD #x1F3FF #x200D #x2642 #xFE0F)                               "man standing: dark skin tone")
-    ((#x1F9CD #x200D #x2640 #xFE0F)                                     "woman standing")
-    ((#x1F9CD #x1F3FB #x200D #x2640 #xFE0F)                               "woman standing: light skin tone")
-    ((#x1F9CD #x1F3FC #x200D #x2640 #xFE0F)                               "woman standing: medium-light skin tone")
-    ((#x1F9CD #x1F3FD #x200D #x2640 #xFE0F)                               "woman standing: medium skin tone")
-    ((#x1F9CD #x1F3FE #x200D #x2640 #xFE0F)                               "woman standing: medium-dark skin tone")
-    ((#x1F9CD #x1F3FF #x200D #x2640 #xFE0F)                               "woman standing: dark skin tone")
-    ((#x1F9CE)                                                    "person kneeling")
-    ((#x1F9CE #x1F3FB)                                              "person kneeling: light skin tone")
-    ((#x1F9CE #x1F3FC)                                              "person kneeling: medium-light skin tone")
-    ((#x1F9CE #x1F3FD)                                              "person kneeling: medium skin tone")
-    ((#x1F9CE #x1F3FE)                                              "person kneeling: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF)                                              "person kneeling: dark skin tone")
-    ((#x1F9CE #x200D #x2642 #xFE0F)                                     "man kneeling")
-    ((#x1F9CE #x1F3FB #x200D #x2642 #xFE0F)                               "man kneeling: light skin tone")
-    ((#x1F9CE #x1F3FC #x200D #x2642 #xFE0F)                               "man kneeling: medium-light skin tone")
-    ((#x1F9CE #x1F3FD #x200D #x2642 #xFE0F)                               "man kneeling: medium skin tone")
-    ((#x1F9CE #x1F3FE #x200D #x2642 #xFE0F)                               "man kneeling: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF #x200D #x2642 #xFE0F)                               "man kneeling: dark skin tone")
-    ((#x1F9CE #x200D #x2640 #xFE0F)                                     "woman kneeling")
-    ((#x1F9CE #x1F3FB #x200D #x2640 #xFE0F)                               "woman kneeling: light skin tone")
-    ((#x1F9CE #x1F3FC #x200D #x2640 #xFE0F)                               "woman kneeling: medium-light skin tone")
-    ((#x1F9CE #x1F3FD #x200D #x2640 #xFE0F)                               "woman kneeling: medium skin tone")
-    ((#x1F9CE #x1F3FE #x200D #x2640 #xFE0F)                               "woman kneeling: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF #x200D #x2640 #xFE0F)                               "woman kneeling: dark skin tone")
-    ((#x1F9CE #x200D #x27A1 #xFE0F)                                     "person kneeling facing right")
-    ((#x1F9CE #x1F3FB #x200D #x27A1 #xFE0F)                               "person kneeling facing right: light skin tone")
-    ((#x1F9CE #x1F3FC #x200D #x27A1 #xFE0F)                               "person kneeling facing right: medium-light skin tone")
-    ((#x1F9CE #x1F3FD #x200D #x27A1 #xFE0F)                               "person kneeling facing right: medium skin tone")
-    ((#x1F9CE #x1F3FE #x200D #x27A1 #xFE0F)                               "person kneeling facing right: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF #x200D #x27A1 #xFE0F)                               "person kneeling facing right: dark skin tone")
-    ((#x1F9CE #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                      "woman kneeling facing right")
-    ((#x1F9CE #x1F3FB #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman kneeling facing right: light skin tone")
-    ((#x1F9CE #x1F3FC #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman kneeling facing right: medium-light skin tone")
-    ((#x1F9CE #x1F3FD #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman kneeling facing right: medium skin tone")
-    ((#x1F9CE #x1F3FE #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman kneeling facing right: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman kneeling facing right: dark skin tone")
-    ((#x1F9CE #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                      "man kneeling facing right")
-    ((#x1F9CE #x1F3FB #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man kneeling facing right: light skin tone")
-    ((#x1F9CE #x1F3FC #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man kneeling facing right: medium-light skin tone")
-    ((#x1F9CE #x1F3FD #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man kneeling facing right: medium skin tone")
-    ((#x1F9CE #x1F3FE #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man kneeling facing right: medium-dark skin tone")
-    ((#x1F9CE #x1F3FF #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man kneeling facing right: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9AF)                                         "person with white cane")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9AF)                                   "person with white cane: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9AF)                                   "person with white cane: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9AF)                                   "person with white cane: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9AF)                                   "person with white cane: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9AF)                                   "person with white cane: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9AF #x200D #x27A1 #xFE0F)                          "person with white cane facing right")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "person with white cane facing right: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "person with white cane facing right: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "person with white cane facing right: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "person with white cane facing right: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "person with white cane facing right: dark skin tone")
-    ((#x1F468 #x200D #x1F9AF)                                         "man with white cane")
-    ((#x1F468 #x1F3FB #x200D #x1F9AF)                                   "man with white cane: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9AF)                                   "man with white cane: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9AF)                                   "man with white cane: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9AF)                                   "man with white cane: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9AF)                                   "man with white cane: dark skin tone")
-    ((#x1F468 #x200D #x1F9AF #x200D #x27A1 #xFE0F)                          "man with white cane facing right")
-    ((#x1F468 #x1F3FB #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "man with white cane facing right: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "man with white cane facing right: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "man with white cane facing right: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "man with white cane facing right: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "man with white cane facing right: dark skin tone")
-    ((#x1F469 #x200D #x1F9AF)                                         "woman with white cane")
-    ((#x1F469 #x1F3FB #x200D #x1F9AF)                                   "woman with white cane: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9AF)                                   "woman with white cane: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9AF)                                   "woman with white cane: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9AF)                                   "woman with white cane: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9AF)                                   "woman with white cane: dark skin tone")
-    ((#x1F469 #x200D #x1F9AF #x200D #x27A1 #xFE0F)                          "woman with white cane facing right")
-    ((#x1F469 #x1F3FB #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "woman with white cane facing right: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "woman with white cane facing right: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "woman with white cane facing right: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "woman with white cane facing right: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9AF #x200D #x27A1 #xFE0F)                    "woman with white cane facing right: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9BC)                                         "person in motorized wheelchair")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9BC)                                   "person in motorized wheelchair: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9BC)                                   "person in motorized wheelchair: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9BC)                                   "person in motorized wheelchair: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9BC)                                   "person in motorized wheelchair: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9BC)                                   "person in motorized wheelchair: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9BC #x200D #x27A1 #xFE0F)                          "person in motorized wheelchair facing right")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "person in motorized wheelchair facing right: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "person in motorized wheelchair facing right: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "person in motorized wheelchair facing right: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "person in motorized wheelchair facing right: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "person in motorized wheelchair facing right: dark skin tone")
-    ((#x1F468 #x200D #x1F9BC)                                         "man in motorized wheelchair")
-    ((#x1F468 #x1F3FB #x200D #x1F9BC)                                   "man in motorized wheelchair: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9BC)                                   "man in motorized wheelchair: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9BC)                                   "man in motorized wheelchair: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9BC)                                   "man in motorized wheelchair: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9BC)                                   "man in motorized wheelchair: dark skin tone")
-    ((#x1F468 #x200D #x1F9BC #x200D #x27A1 #xFE0F)                          "man in motorized wheelchair facing right")
-    ((#x1F468 #x1F3FB #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "man in motorized wheelchair facing right: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "man in motorized wheelchair facing right: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "man in motorized wheelchair facing right: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "man in motorized wheelchair facing right: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "man in motorized wheelchair facing right: dark skin tone")
-    ((#x1F469 #x200D #x1F9BC)                                         "woman in motorized wheelchair")
-    ((#x1F469 #x1F3FB #x200D #x1F9BC)                                   "woman in motorized wheelchair: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9BC)                                   "woman in motorized wheelchair: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9BC)                                   "woman in motorized wheelchair: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9BC)                                   "woman in motorized wheelchair: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9BC)                                   "woman in motorized wheelchair: dark skin tone")
-    ((#x1F469 #x200D #x1F9BC #x200D #x27A1 #xFE0F)                          "woman in motorized wheelchair facing right")
-    ((#x1F469 #x1F3FB #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "woman in motorized wheelchair facing right: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "woman in motorized wheelchair facing right: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "woman in motorized wheelchair facing right: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "woman in motorized wheelchair facing right: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9BC #x200D #x27A1 #xFE0F)                    "woman in motorized wheelchair facing right: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9BD)                                         "person in manual wheelchair")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9BD)                                   "person in manual wheelchair: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9BD)                                   "person in manual wheelchair: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9BD)                                   "person in manual wheelchair: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9BD)                                   "person in manual wheelchair: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9BD)                                   "person in manual wheelchair: dark skin tone")
-    ((#x1F9D1 #x200D #x1F9BD #x200D #x27A1 #xFE0F)                          "person in manual wheelchair facing right")
-    ((#x1F9D1 #x1F3FB #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "person in manual wheelchair facing right: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "person in manual wheelchair facing right: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "person in manual wheelchair facing right: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "person in manual wheelchair facing right: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "person in manual wheelchair facing right: dark skin tone")
-    ((#x1F468 #x200D #x1F9BD)                                         "man in manual wheelchair")
-    ((#x1F468 #x1F3FB #x200D #x1F9BD)                                   "man in manual wheelchair: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9BD)                                   "man in manual wheelchair: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9BD)                                   "man in manual wheelchair: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9BD)                                   "man in manual wheelchair: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9BD)                                   "man in manual wheelchair: dark skin tone")
-    ((#x1F468 #x200D #x1F9BD #x200D #x27A1 #xFE0F)                          "man in manual wheelchair facing right")
-    ((#x1F468 #x1F3FB #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "man in manual wheelchair facing right: light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "man in manual wheelchair facing right: medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "man in manual wheelchair facing right: medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "man in manual wheelchair facing right: medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "man in manual wheelchair facing right: dark skin tone")
-    ((#x1F469 #x200D #x1F9BD)                                         "woman in manual wheelchair")
-    ((#x1F469 #x1F3FB #x200D #x1F9BD)                                   "woman in manual wheelchair: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9BD)                                   "woman in manual wheelchair: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9BD)                                   "woman in manual wheelchair: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9BD)                                   "woman in manual wheelchair: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9BD)                                   "woman in manual wheelchair: dark skin tone")
-    ((#x1F469 #x200D #x1F9BD #x200D #x27A1 #xFE0F)                          "woman in manual wheelchair facing right")
-    ((#x1F469 #x1F3FB #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "woman in manual wheelchair facing right: light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "woman in manual wheelchair facing right: medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "woman in manual wheelchair facing right: medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "woman in manual wheelchair facing right: medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F9BD #x200D #x27A1 #xFE0F)                    "woman in manual wheelchair facing right: dark skin tone")
-    ((#x1F3C3)                                                    "person running")
-    ((#x1F3C3 #x1F3FB)                                              "person running: light skin tone")
-    ((#x1F3C3 #x1F3FC)                                              "person running: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD)                                              "person running: medium skin tone")
-    ((#x1F3C3 #x1F3FE)                                              "person running: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF)                                              "person running: dark skin tone")
-    ((#x1F3C3 #x200D #x2642 #xFE0F)                                     "man running")
-    ((#x1F3C3 #x1F3FB #x200D #x2642 #xFE0F)                               "man running: light skin tone")
-    ((#x1F3C3 #x1F3FC #x200D #x2642 #xFE0F)                               "man running: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD #x200D #x2642 #xFE0F)                               "man running: medium skin tone")
-    ((#x1F3C3 #x1F3FE #x200D #x2642 #xFE0F)                               "man running: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF #x200D #x2642 #xFE0F)                               "man running: dark skin tone")
-    ((#x1F3C3 #x200D #x2640 #xFE0F)                                     "woman running")
-    ((#x1F3C3 #x1F3FB #x200D #x2640 #xFE0F)                               "woman running: light skin tone")
-    ((#x1F3C3 #x1F3FC #x200D #x2640 #xFE0F)                               "woman running: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD #x200D #x2640 #xFE0F)                               "woman running: medium skin tone")
-    ((#x1F3C3 #x1F3FE #x200D #x2640 #xFE0F)                               "woman running: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF #x200D #x2640 #xFE0F)                               "woman running: dark skin tone")
-    ((#x1F3C3 #x200D #x27A1 #xFE0F)                                     "person running facing right")
-    ((#x1F3C3 #x1F3FB #x200D #x27A1 #xFE0F)                               "person running facing right: light skin tone")
-    ((#x1F3C3 #x1F3FC #x200D #x27A1 #xFE0F)                               "person running facing right: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD #x200D #x27A1 #xFE0F)                               "person running facing right: medium skin tone")
-    ((#x1F3C3 #x1F3FE #x200D #x27A1 #xFE0F)                               "person running facing right: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF #x200D #x27A1 #xFE0F)                               "person running facing right: dark skin tone")
-    ((#x1F3C3 #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                      "woman running facing right")
-    ((#x1F3C3 #x1F3FB #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman running facing right: light skin tone")
-    ((#x1F3C3 #x1F3FC #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman running facing right: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman running facing right: medium skin tone")
-    ((#x1F3C3 #x1F3FE #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman running facing right: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF #x200D #x2640 #xFE0F #x200D #x27A1 #xFE0F)                "woman running facing right: dark skin tone")
-    ((#x1F3C3 #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                      "man running facing right")
-    ((#x1F3C3 #x1F3FB #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man running facing right: light skin tone")
-    ((#x1F3C3 #x1F3FC #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man running facing right: medium-light skin tone")
-    ((#x1F3C3 #x1F3FD #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man running facing right: medium skin tone")
-    ((#x1F3C3 #x1F3FE #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man running facing right: medium-dark skin tone")
-    ((#x1F3C3 #x1F3FF #x200D #x2642 #xFE0F #x200D #x27A1 #xFE0F)                "man running facing right: dark skin tone")
-    ((#x1F9D1 #x200D #x1FA70)                                         "ballet dancer")
-    ((#x1F9D1 #x1F3FB #x200D #x1FA70)                                   "ballet dancer: light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1FA70)                                   "ballet dancer: medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1FA70)                                   "ballet dancer: medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1FA70)                                   "ballet dancer: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1FA70)                                   "ballet dancer: dark skin tone")
-    ((#x1F483)                                                    "woman dancing")
-    ((#x1F483 #x1F3FB)                                              "woman dancing: light skin tone")
-    ((#x1F483 #x1F3FC)                                              "woman dancing: medium-light skin tone")
-    ((#x1F483 #x1F3FD)                                              "woman dancing: medium skin tone")
-    ((#x1F483 #x1F3FE)                                              "woman dancing: medium-dark skin tone")
-    ((#x1F483 #x1F3FF)                                              "woman dancing: dark skin tone")
-    ((#x1F57A)                                                    "man dancing")
-    ((#x1F57A #x1F3FB)                                              "man dancing: light skin tone")
-    ((#x1F57A #x1F3FC)                                              "man dancing: medium-light skin tone")
-    ((#x1F57A #x1F3FD)                                              "man dancing: medium skin tone")
-    ((#x1F57A #x1F3FE)                                              "man dancing: medium-dark skin tone")
-    ((#x1F57A #x1F3FF)                                              "man dancing: dark skin tone")
-    ((#x1F574 #xFE0F)                                               "person in suit levitating")
-    ((#x1F574 #x1F3FB)                                              "person in suit levitating: light skin tone")
-    ((#x1F574 #x1F3FC)                                              "person in suit levitating: medium-light skin tone")
-    ((#x1F574 #x1F3FD)                                              "person in suit levitating: medium skin tone")
-    ((#x1F574 #x1F3FE)                                              "person in suit levitating: medium-dark skin tone")
-    ((#x1F574 #x1F3FF)                                              "person in suit levitating: dark skin tone")
-    ((#x1F46F)                                                    "people with bunny ears")
-    ((#x1F46F #x1F3FB)                                              "people with bunny ears: light skin tone")
-    ((#x1F46F #x1F3FC)                                              "people with bunny ears: medium-light skin tone")
-    ((#x1F46F #x1F3FD)                                              "people with bunny ears: medium skin tone")
-    ((#x1F46F #x1F3FE)                                              "people with bunny ears: medium-dark skin tone")
-    ((#x1F46F #x1F3FF)                                              "people with bunny ears: dark skin tone")
-    ((#x1F46F #x200D #x2642 #xFE0F)                                     "men with bunny ears")
-    ((#x1F46F #x1F3FB #x200D #x2642 #xFE0F)                               "men with bunny ears: light skin tone")
-    ((#x1F46F #x1F3FC #x200D #x2642 #xFE0F)                               "men with bunny ears: medium-light skin tone")
-    ((#x1F46F #x1F3FD #x200D #x2642 #xFE0F)                               "men with bunny ears: medium skin tone")
-    ((#x1F46F #x1F3FE #x200D #x2642 #xFE0F)                               "men with bunny ears: medium-dark skin tone")
-    ((#x1F46F #x1F3FF #x200D #x2642 #xFE0F)                               "men with bunny ears: dark skin tone")
-    ((#x1F46F #x200D #x2640 #xFE0F)                                     "women with bunny ears")
-    ((#x1F46F #x1F3FB #x200D #x2640 #xFE0F)                               "women with bunny ears: light skin tone")
-    ((#x1F46F #x1F3FC #x200D #x2640 #xFE0F)                               "women with bunny ears: medium-light skin tone")
-    ((#x1F46F #x1F3FD #x200D #x2640 #xFE0F)                               "women with bunny ears: medium skin tone")
-    ((#x1F46F #x1F3FE #x200D #x2640 #xFE0F)                               "women with bunny ears: medium-dark skin tone")
-    ((#x1F46F #x1F3FF #x200D #x2640 #xFE0F)                               "women with bunny ears: dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F430 #x200D #x1F9D1 #x1F3FC)                  "people with bunny ears: light skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F430 #x200D #x1F9D1 #x1F3FD)                  "people with bunny ears: light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F430 #x200D #x1F9D1 #x1F3FE)                  "people with bunny ears: light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F430 #x200D #x1F9D1 #x1F3FF)                  "people with bunny ears: light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F430 #x200D #x1F9D1 #x1F3FB)                  "people with bunny ears: medium-light skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F430 #x200D #x1F9D1 #x1F3FD)                  "people with bunny ears: medium-light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F430 #x200D #x1F9D1 #x1F3FE)                  "people with bunny ears: medium-light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F430 #x200D #x1F9D1 #x1F3FF)                  "people with bunny ears: medium-light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F430 #x200D #x1F9D1 #x1F3FB)                  "people with bunny ears: medium skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F430 #x200D #x1F9D1 #x1F3FC)                  "people with bunny ears: medium skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F430 #x200D #x1F9D1 #x1F3FE)                  "people with bunny ears: medium skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F430 #x200D #x1F9D1 #x1F3FF)                  "people with bunny ears: medium skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F430 #x200D #x1F9D1 #x1F3FB)                  "people with bunny ears: medium-dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F430 #x200D #x1F9D1 #x1F3FC)                  "people with bunny ears: medium-dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F430 #x200D #x1F9D1 #x1F3FD)                  "people with bunny ears: medium-dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F430 #x200D #x1F9D1 #x1F3FF)                  "people with bunny ears: medium-dark skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F430 #x200D #x1F9D1 #x1F3FB)                  "people with bunny ears: dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F430 #x200D #x1F9D1 #x1F3FC)                  "people with bunny ears: dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F430 #x200D #x1F9D1 #x1F3FD)                  "people with bunny ears: dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F430 #x200D #x1F9D1 #x1F3FE)                  "people with bunny ears: dark skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F430 #x200D #x1F468 #x1F3FC)                  "men with bunny ears: light skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F430 #x200D #x1F468 #x1F3FD)                  "men with bunny ears: light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F430 #x200D #x1F468 #x1F3FE)                  "men with bunny ears: light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F430 #x200D #x1F468 #x1F3FF)                  "men with bunny ears: light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F430 #x200D #x1F468 #x1F3FB)                  "men with bunny ears: medium-light skin tone, light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F430 #x200D #x1F468 #x1F3FD)                  "men with bunny ears: medium-light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F430 #x200D #x1F468 #x1F3FE)                  "men with bunny ears: medium-light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F430 #x200D #x1F468 #x1F3FF)                  "men with bunny ears: medium-light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F430 #x200D #x1F468 #x1F3FB)                  "men with bunny ears: medium skin tone, light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F430 #x200D #x1F468 #x1F3FC)                  "men with bunny ears: medium skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F430 #x200D #x1F468 #x1F3FE)                  "men with bunny ears: medium skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F430 #x200D #x1F468 #x1F3FF)                  "men with bunny ears: medium skin tone, dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F430 #x200D #x1F468 #x1F3FB)                  "men with bunny ears: medium-dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F430 #x200D #x1F468 #x1F3FC)                  "men with bunny ears: medium-dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F430 #x200D #x1F468 #x1F3FD)                  "men with bunny ears: medium-dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F430 #x200D #x1F468 #x1F3FF)                  "men with bunny ears: medium-dark skin tone, dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F430 #x200D #x1F468 #x1F3FB)                  "men with bunny ears: dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F430 #x200D #x1F468 #x1F3FC)                  "men with bunny ears: dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F430 #x200D #x1F468 #x1F3FD)                  "men with bunny ears: dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F430 #x200D #x1F468 #x1F3FE)                  "men with bunny ears: dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F430 #x200D #x1F469 #x1F3FC)                  "women with bunny ears: light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F430 #x200D #x1F469 #x1F3FD)                  "women with bunny ears: light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F430 #x200D #x1F469 #x1F3FE)                  "women with bunny ears: light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F430 #x200D #x1F469 #x1F3FF)                  "women with bunny ears: light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F430 #x200D #x1F469 #x1F3FB)                  "women with bunny ears: medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F430 #x200D #x1F469 #x1F3FD)                  "women with bunny ears: medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F430 #x200D #x1F469 #x1F3FE)                  "women with bunny ears: medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F430 #x200D #x1F469 #x1F3FF)                  "women with bunny ears: medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F430 #x200D #x1F469 #x1F3FB)                  "women with bunny ears: medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F430 #x200D #x1F469 #x1F3FC)                  "women with bunny ears: medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F430 #x200D #x1F469 #x1F3FE)                  "women with bunny ears: medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F430 #x200D #x1F469 #x1F3FF)                  "women with bunny ears: medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F430 #x200D #x1F469 #x1F3FB)                  "women with bunny ears: medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F430 #x200D #x1F469 #x1F3FC)                  "women with bunny ears: medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F430 #x200D #x1F469 #x1F3FD)                  "women with bunny ears: medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F430 #x200D #x1F469 #x1F3FF)                  "women with bunny ears: medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F430 #x200D #x1F469 #x1F3FB)                  "women with bunny ears: dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F430 #x200D #x1F469 #x1F3FC)                  "women with bunny ears: dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F430 #x200D #x1F469 #x1F3FD)                  "women with bunny ears: dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F430 #x200D #x1F469 #x1F3FE)                  "women with bunny ears: dark skin tone, medium-dark skin tone")
-    ((#x1F9D6)                                                    "person in steamy room")
-    ((#x1F9D6 #x1F3FB)                                              "person in steamy room: light skin tone")
-    ((#x1F9D6 #x1F3FC)                                              "person in steamy room: medium-light skin tone")
-    ((#x1F9D6 #x1F3FD)                                              "person in steamy room: medium skin tone")
-    ((#x1F9D6 #x1F3FE)                                              "person in steamy room: medium-dark skin tone")
-    ((#x1F9D6 #x1F3FF)                                              "person in steamy room: dark skin tone")
-    ((#x1F9D6 #x200D #x2642 #xFE0F)                                     "man in steamy room")
-    ((#x1F9D6 #x1F3FB #x200D #x2642 #xFE0F)                               "man in steamy room: light skin tone")
-    ((#x1F9D6 #x1F3FC #x200D #x2642 #xFE0F)                               "man in steamy room: medium-light skin tone")
-    ((#x1F9D6 #x1F3FD #x200D #x2642 #xFE0F)                               "man in steamy room: medium skin tone")
-    ((#x1F9D6 #x1F3FE #x200D #x2642 #xFE0F)                               "man in steamy room: medium-dark skin tone")
-    ((#x1F9D6 #x1F3FF #x200D #x2642 #xFE0F)                               "man in steamy room: dark skin tone")
-    ((#x1F9D6 #x200D #x2640 #xFE0F)                                     "woman in steamy room")
-    ((#x1F9D6 #x1F3FB #x200D #x2640 #xFE0F)                               "woman in steamy room: light skin tone")
-    ((#x1F9D6 #x1F3FC #x200D #x2640 #xFE0F)                               "woman in steamy room: medium-light skin tone")
-    ((#x1F9D6 #x1F3FD #x200D #x2640 #xFE0F)                               "woman in steamy room: medium skin tone")
-    ((#x1F9D6 #x1F3FE #x200D #x2640 #xFE0F)                               "woman in steamy room: medium-dark skin tone")
-    ((#x1F9D6 #x1F3FF #x200D #x2640 #xFE0F)                               "woman in steamy room: dark skin tone")
-    ((#x1F9D7)                                                    "person climbing")
-    ((#x1F9D7 #x1F3FB)                                              "person climbing: light skin tone")
-    ((#x1F9D7 #x1F3FC)                                              "person climbing: medium-light skin tone")
-    ((#x1F9D7 #x1F3FD)                                              "person climbing: medium skin tone")
-    ((#x1F9D7 #x1F3FE)                                              "person climbing: medium-dark skin tone")
-    ((#x1F9D7 #x1F3FF)                                              "person climbing: dark skin tone")
-    ((#x1F9D7 #x200D #x2642 #xFE0F)                                     "man climbing")
-    ((#x1F9D7 #x1F3FB #x200D #x2642 #xFE0F)                               "man climbing: light skin tone")
-    ((#x1F9D7 #x1F3FC #x200D #x2642 #xFE0F)                               "man climbing: medium-light skin tone")
-    ((#x1F9D7 #x1F3FD #x200D #x2642 #xFE0F)                               "man climbing: medium skin tone")
-    ((#x1F9D7 #x1F3FE #x200D #x2642 #xFE0F)                               "man climbing: medium-dark skin tone")
-    ((#x1F9D7 #x1F3FF #x200D #x2642 #xFE0F)                               "man climbing: dark skin tone")
-    ((#x1F9D7 #x200D #x2640 #xFE0F)                                     "woman climbing")
-    ((#x1F9D7 #x1F3FB #x200D #x2640 #xFE0F)                               "woman climbing: light skin tone")
-    ((#x1F9D7 #x1F3FC #x200D #x2640 #xFE0F)                               "woman climbing: medium-light skin tone")
-    ((#x1F9D7 #x1F3FD #x200D #x2640 #xFE0F)                               "woman climbing: medium skin tone")
-    ((#x1F9D7 #x1F3FE #x200D #x2640 #xFE0F)                               "woman climbing: medium-dark skin tone")
-    ((#x1F9D7 #x1F3FF #x200D #x2640 #xFE0F)                               "woman climbing: dark skin tone")
-    ((#x1F93A)                                                    "person fencing")
-    ((#x1F3C7)                                                    "horse racing")
-    ((#x1F3C7 #x1F3FB)                                              "horse racing: light skin tone")
-    ((#x1F3C7 #x1F3FC)                                              "horse racing: medium-light skin tone")
-    ((#x1F3C7 #x1F3FD)                                              "horse racing: medium skin tone")
-    ((#x1F3C7 #x1F3FE)                                              "horse racing: medium-dark skin tone")
-    ((#x1F3C7 #x1F3FF)                                              "horse racing: dark skin tone")
-    ((#x26F7 #xFE0F)                                                "skier")
-    ((#x1F3C2)                                                    "snowboarder")
-    ((#x1F3C2 #x1F3FB)                                              "snowboarder: light skin tone")
-    ((#x1F3C2 #x1F3FC)                                              "snowboarder: medium-light skin tone")
-    ((#x1F3C2 #x1F3FD)                                              "snowboarder: medium skin tone")
-    ((#x1F3C2 #x1F3FE)                                              "snowboarder: medium-dark skin tone")
-    ((#x1F3C2 #x1F3FF)                                              "snowboarder: dark skin tone")
-    ((#x1F3CC #xFE0F)                                               "person golfing")
-    ((#x1F3CC #x1F3FB)                                              "person golfing: light skin tone")
-    ((#x1F3CC #x1F3FC)                                              "person golfing: medium-light skin tone")
-    ((#x1F3CC #x1F3FD)                                              "person golfing: medium skin tone")
-    ((#x1F3CC #x1F3FE)                                              "person golfing: medium-dark skin tone")
-    ((#x1F3CC #x1F3FF)                                              "person golfing: dark skin tone")
-    ((#x1F3CC #xFE0F #x200D #x2642 #xFE0F)                                "man golfing")
-    ((#x1F3CC #x1F3FB #x200D #x2642 #xFE0F)                               "man golfing: light skin tone")
-    ((#x1F3CC #x1F3FC #x200D #x2642 #xFE0F)                               "man golfing: medium-light skin tone")
-    ((#x1F3CC #x1F3FD #x200D #x2642 #xFE0F)                               "man golfing: medium skin tone")
-    ((#x1F3CC #x1F3FE #x200D #x2642 #xFE0F)                               "man golfing: medium-dark skin tone")
-    ((#x1F3CC #x1F3FF #x200D #x2642 #xFE0F)                               "man golfing: dark skin tone")
-    ((#x1F3CC #xFE0F #x200D #x2640 #xFE0F)                                "woman golfing")
-    ((#x1F3CC #x1F3FB #x200D #x2640 #xFE0F)                               "woman golfing: light skin tone")
-    ((#x1F3CC #x1F3FC #x200D #x2640 #xFE0F)                               "woman golfing: medium-light skin tone")
-    ((#x1F3CC #x1F3FD #x200D #x2640 #xFE0F)                               "woman golfing: medium skin tone")
-    ((#x1F3CC #x1F3FE #x200D #x2640 #xFE0F)                               "woman golfing: medium-dark skin tone")
-    ((#x1F3CC #x1F3FF #x200D #x2640 #xFE0F)                               "woman golfing: dark skin tone")
-    ((#x1F3C4)                                                    "person surfing")
-    ((#x1F3C4 #x1F3FB)                                              "person surfing: light skin tone")
-    ((#x1F3C4 #x1F3FC)                                              "person surfing: medium-light skin tone")
-    ((#x1F3C4 #x1F3FD)                                              "person surfing: medium skin tone")
-    ((#x1F3C4 #x1F3FE)                                              "person surfing: medium-dark skin tone")
-    ((#x1F3C4 #x1F3FF)                                              "person surfing: dark skin tone")
-    ((#x1F3C4 #x200D #x2642 #xFE0F)                                     "man surfing")
-    ((#x1F3C4 #x1F3FB #x200D #x2642 #xFE0F)                               "man surfing: light skin tone")
-    ((#x1F3C4 #x1F3FC #x200D #x2642 #xFE0F)                               "man surfing: medium-light skin tone")
-    ((#x1F3C4 #x1F3FD #x200D #x2642 #xFE0F)                               "man surfing: medium skin tone")
-    ((#x1F3C4 #x1F3FE #x200D #x2642 #xFE0F)                               "man surfing: medium-dark skin tone")
-    ((#x1F3C4 #x1F3FF #x200D #x2642 #xFE0F)                               "man surfing: dark skin tone")
-    ((#x1F3C4 #x200D #x2640 #xFE0F)                                     "woman surfing")
-    ((#x1F3C4 #x1F3FB #x200D #x2640 #xFE0F)                               "woman surfing: light skin tone")
-    ((#x1F3C4 #x1F3FC #x200D #x2640 #xFE0F)                               "woman surfing: medium-light skin tone")
-    ((#x1F3C4 #x1F3FD #x200D #x2640 #xFE0F)                               "woman surfing: medium skin tone")
-    ((#x1F3C4 #x1F3FE #x200D #x2640 #xFE0F)                               "woman surfing: medium-dark skin tone")
-    ((#x1F3C4 #x1F3FF #x200D #x2640 #xFE0F)                               "woman surfing: dark skin tone")
-    ((#x1F6A3)                                                    "person rowing boat")
-    ((#x1F6A3 #x1F3FB)                                              "person rowing boat: light skin tone")
-    ((#x1F6A3 #x1F3FC)                                              "person rowing boat: medium-light skin tone")
-    ((#x1F6A3 #x1F3FD)                                              "person rowing boat: medium skin tone")
-    ((#x1F6A3 #x1F3FE)                                              "person rowing boat: medium-dark skin tone")
-    ((#x1F6A3 #x1F3FF)                                              "person rowing boat: dark skin tone")
-    ((#x1F6A3 #x200D #x2642 #xFE0F)                                     "man rowing boat")
-    ((#x1F6A3 #x1F3FB #x200D #x2642 #xFE0F)                               "man rowing boat: light skin tone")
-    ((#x1F6A3 #x1F3FC #x200D #x2642 #xFE0F)                               "man rowing boat: medium-light skin tone")
-    ((#x1F6A3 #x1F3FD #x200D #x2642 #xFE0F)                               "man rowing boat: medium skin tone")
-    ((#x1F6A3 #x1F3FE #x200D #x2642 #xFE0F)                               "man rowing boat: medium-dark skin tone")
-    ((#x1F6A3 #x1F3FF #x200D #x2642 #xFE0F)                               "man rowing boat: dark skin tone")
-    ((#x1F6A3 #x200D #x2640 #xFE0F)                                     "woman rowing boat")
-    ((#x1F6A3 #x1F3FB #x200D #x2640 #xFE0F)                               "woman rowing boat: light skin tone")
-    ((#x1F6A3 #x1F3FC #x200D #x2640 #xFE0F)                               "woman rowing boat: medium-light skin tone")
-    ((#x1F6A3 #x1F3FD #x200D #x2640 #xFE0F)                               "woman rowing boat: medium skin tone")
-    ((#x1F6A3 #x1F3FE #x200D #x2640 #xFE0F)                               "woman rowing boat: medium-dark skin tone")
-    ((#x1F6A3 #x1F3FF #x200D #x2640 #xFE0F)                               "woman rowing boat: dark skin tone")
-    ((#x1F3CA)                                                    "person swimming")
-    ((#x1F3CA #x1F3FB)                                              "person swimming: light skin tone")
-    ((#x1F3CA #x1F3FC)                                              "person swimming: medium-light skin tone")
-    ((#x1F3CA #x1F3FD)                                              "person swimming: medium skin tone")
-    ((#x1F3CA #x1F3FE)                                              "person swimming: medium-dark skin tone")
-    ((#x1F3CA #x1F3FF)                                              "person swimming: dark skin tone")
-    ((#x1F3CA #x200D #x2642 #xFE0F)                                     "man swimming")
-    ((#x1F3CA #x1F3FB #x200D #x2642 #xFE0F)                               "man swimming: light skin tone")
-    ((#x1F3CA #x1F3FC #x200D #x2642 #xFE0F)                               "man swimming: medium-light skin tone")
-    ((#x1F3CA #x1F3FD #x200D #x2642 #xFE0F)                               "man swimming: medium skin tone")
-    ((#x1F3CA #x1F3FE #x200D #x2642 #xFE0F)                               "man swimming: medium-dark skin tone")
-    ((#x1F3CA #x1F3FF #x200D #x2642 #xFE0F)                               "man swimming: dark skin tone")
-    ((#x1F3CA #x200D #x2640 #xFE0F)                                     "woman swimming")
-    ((#x1F3CA #x1F3FB #x200D #x2640 #xFE0F)                               "woman swimming: light skin tone")
-    ((#x1F3CA #x1F3FC #x200D #x2640 #xFE0F)                               "woman swimming: medium-light skin tone")
-    ((#x1F3CA #x1F3FD #x200D #x2640 #xFE0F)                               "woman swimming: medium skin tone")
-    ((#x1F3CA #x1F3FE #x200D #x2640 #xFE0F)                               "woman swimming: medium-dark skin tone")
-    ((#x1F3CA #x1F3FF #x200D #x2640 #xFE0F)                               "woman swimming: dark skin tone")
-    ((#x26F9 #xFE0F)                                                "person bouncing ball")
-    ((#x26F9 #x1F3FB)                                               "person bouncing ball: light skin tone")
-    ((#x26F9 #x1F3FC)                                               "person bouncing ball: medium-light skin tone")
-    ((#x26F9 #x1F3FD)                                               "person bouncing ball: medium skin tone")
-    ((#x26F9 #x1F3FE)                                               "person bouncing ball: medium-dark skin tone")
-    ((#x26F9 #x1F3FF)                                               "person bouncing ball: dark skin tone")
-    ((#x26F9 #xFE0F #x200D #x2642 #xFE0F)                                 "man bouncing ball")
-    ((#x26F9 #x1F3FB #x200D #x2642 #xFE0F)                                "man bouncing ball: light skin tone")
-    ((#x26F9 #x1F3FC #x200D #x2642 #xFE0F)                                "man bouncing ball: medium-light skin tone")
-    ((#x26F9 #x1F3FD #x200D #x2642 #xFE0F)                                "man bouncing ball: medium skin tone")
-    ((#x26F9 #x1F3FE #x200D #x2642 #xFE0F)                                "man bouncing ball: medium-dark skin tone")
-    ((#x26F9 #x1F3FF #x200D #x2642 #xFE0F)                                "man bouncing ball: dark skin tone")
-    ((#x26F9 #xFE0F #x200D #x2640 #xFE0F)                                 "woman bouncing ball")
-    ((#x26F9 #x1F3FB #x200D #x2640 #xFE0F)                                "woman bouncing ball: light skin tone")
-    ((#x26F9 #x1F3FC #x200D #x2640 #xFE0F)                                "woman bouncing ball: medium-light skin tone")
-    ((#x26F9 #x1F3FD #x200D #x2640 #xFE0F)                                "woman bouncing ball: medium skin tone")
-    ((#x26F9 #x1F3FE #x200D #x2640 #xFE0F)                                "woman bouncing ball: medium-dark skin tone")
-    ((#x26F9 #x1F3FF #x200D #x2640 #xFE0F)                                "woman bouncing ball: dark skin tone")
-    ((#x1F3CB #xFE0F)                                               "person lifting weights")
-    ((#x1F3CB #x1F3FB)                                              "person lifting weights: light skin tone")
-    ((#x1F3CB #x1F3FC)                                              "person lifting weights: medium-light skin tone")
-    ((#x1F3CB #x1F3FD)                                              "person lifting weights: medium skin tone")
-    ((#x1F3CB #x1F3FE)                                              "person lifting weights: medium-dark skin tone")
-    ((#x1F3CB #x1F3FF)                                              "person lifting weights: dark skin tone")
-    ((#x1F3CB #xFE0F #x200D #x2642 #xFE0F)                                "man lifting weights")
-    ((#x1F3CB #x1F3FB #x200D #x2642 #xFE0F)                               "man lifting weights: light skin tone")
-    ((#x1F3CB #x1F3FC #x200D #x2642 #xFE0F)                               "man lifting weights: medium-light skin tone")
-    ((#x1F3CB #x1F3FD #x200D #x2642 #xFE0F)                               "man lifting weights: medium skin tone")
-    ((#x1F3CB #x1F3FE #x200D #x2642 #xFE0F)                               "man lifting weights: medium-dark skin tone")
-    ((#x1F3CB #x1F3FF #x200D #x2642 #xFE0F)                               "man lifting weights: dark skin tone")
-    ((#x1F3CB #xFE0F #x200D #x2640 #xFE0F)                                "woman lifting weights")
-    ((#x1F3CB #x1F3FB #x200D #x2640 #xFE0F)                               "woman lifting weights: light skin tone")
-    ((#x1F3CB #x1F3FC #x200D #x2640 #xFE0F)                               "woman lifting weights: medium-light skin tone")
-    ((#x1F3CB #x1F3FD #x200D #x2640 #xFE0F)                               "woman lifting weights: medium skin tone")
-    ((#x1F3CB #x1F3FE #x200D #x2640 #xFE0F)                               "woman lifting weights: medium-dark skin tone")
-    ((#x1F3CB #x1F3FF #x200D #x2640 #xFE0F)                               "woman lifting weights: dark skin tone")
-    ((#x1F6B4)                                                    "person biking")
-    ((#x1F6B4 #x1F3FB)                                              "person biking: light skin tone")
-    ((#x1F6B4 #x1F3FC)                                              "person biking: medium-light skin tone")
-    ((#x1F6B4 #x1F3FD)                                              "person biking: medium skin tone")
-    ((#x1F6B4 #x1F3FE)                                              "person biking: medium-dark skin tone")
-    ((#x1F6B4 #x1F3FF)                                              "person biking: dark skin tone")
-    ((#x1F6B4 #x200D #x2642 #xFE0F)                                     "man biking")
-    ((#x1F6B4 #x1F3FB #x200D #x2642 #xFE0F)                               "man biking: light skin tone")
-    ((#x1F6B4 #x1F3FC #x200D #x2642 #xFE0F)                               "man biking: medium-light skin tone")
-    ((#x1F6B4 #x1F3FD #x200D #x2642 #xFE0F)                               "man biking: medium skin tone")
-    ((#x1F6B4 #x1F3FE #x200D #x2642 #xFE0F)                               "man biking: medium-dark skin tone")
-    ((#x1F6B4 #x1F3FF #x200D #x2642 #xFE0F)                               "man biking: dark skin tone")
-    ((#x1F6B4 #x200D #x2640 #xFE0F)                                     "woman biking")
-    ((#x1F6B4 #x1F3FB #x200D #x2640 #xFE0F)                               "woman biking: light skin tone")
-    ((#x1F6B4 #x1F3FC #x200D #x2640 #xFE0F)                               "woman biking: medium-light skin tone")
-    ((#x1F6B4 #x1F3FD #x200D #x2640 #xFE0F)                               "woman biking: medium skin tone")
-    ((#x1F6B4 #x1F3FE #x200D #x2640 #xFE0F)                               "woman biking: medium-dark skin tone")
-    ((#x1F6B4 #x1F3FF #x200D #x2640 #xFE0F)                               "woman biking: dark skin tone")
-    ((#x1F6B5)                                                    "person mountain biking")
-    ((#x1F6B5 #x1F3FB)                                              "person mountain biking: light skin tone")
-    ((#x1F6B5 #x1F3FC)                                              "person mountain biking: medium-light skin tone")
-    ((#x1F6B5 #x1F3FD)                                              "person mountain biking: medium skin tone")
-    ((#x1F6B5 #x1F3FE)                                              "person mountain biking: medium-dark skin tone")
-    ((#x1F6B5 #x1F3FF)                                              "person mountain biking: dark skin tone")
-    ((#x1F6B5 #x200D #x2642 #xFE0F)                                     "man mountain biking")
-    ((#x1F6B5 #x1F3FB #x200D #x2642 #xFE0F)                               "man mountain biking: light skin tone")
-    ((#x1F6B5 #x1F3FC #x200D #x2642 #xFE0F)                               "man mountain biking: medium-light skin tone")
-    ((#x1F6B5 #x1F3FD #x200D #x2642 #xFE0F)                               "man mountain biking: medium skin tone")
-    ((#x1F6B5 #x1F3FE #x200D #x2642 #xFE0F)                               "man mountain biking: medium-dark skin tone")
-    ((#x1F6B5 #x1F3FF #x200D #x2642 #xFE0F)                               "man mountain biking: dark skin tone")
-    ((#x1F6B5 #x200D #x2640 #xFE0F)                                     "woman mountain biking")
-    ((#x1F6B5 #x1F3FB #x200D #x2640 #xFE0F)                               "woman mountain biking: light skin tone")
-    ((#x1F6B5 #x1F3FC #x200D #x2640 #xFE0F)                               "woman mountain biking: medium-light skin tone")
-    ((#x1F6B5 #x1F3FD #x200D #x2640 #xFE0F)                               "woman mountain biking: medium skin tone")
-    ((#x1F6B5 #x1F3FE #x200D #x2640 #xFE0F)                               "woman mountain biking: medium-dark skin tone")
-    ((#x1F6B5 #x1F3FF #x200D #x2640 #xFE0F)                               "woman mountain biking: dark skin tone")
-    ((#x1F938)                                                    "person cartwheeling")
-    ((#x1F938 #x1F3FB)                                              "person cartwheeling: light skin tone")
-    ((#x1F938 #x1F3FC)                                              "person cartwheeling: medium-light skin tone")
-    ((#x1F938 #x1F3FD)                                              "person cartwheeling: medium skin tone")
-    ((#x1F938 #x1F3FE)                                              "person cartwheeling: medium-dark skin tone")
-    ((#x1F938 #x1F3FF)                                              "person cartwheeling: dark skin tone")
-    ((#x1F938 #x200D #x2642 #xFE0F)                                     "man cartwheeling")
-    ((#x1F938 #x1F3FB #x200D #x2642 #xFE0F)                               "man cartwheeling: light skin tone")
-    ((#x1F938 #x1F3FC #x200D #x2642 #xFE0F)                               "man cartwheeling: medium-light skin tone")
-    ((#x1F938 #x1F3FD #x200D #x2642 #xFE0F)                               "man cartwheeling: medium skin tone")
-    ((#x1F938 #x1F3FE #x200D #x2642 #xFE0F)                               "man cartwheeling: medium-dark skin tone")
-    ((#x1F938 #x1F3FF #x200D #x2642 #xFE0F)                               "man cartwheeling: dark skin tone")
-    ((#x1F938 #x200D #x2640 #xFE0F)                                     "woman cartwheeling")
-    ((#x1F938 #x1F3FB #x200D #x2640 #xFE0F)                               "woman cartwheeling: light skin tone")
-    ((#x1F938 #x1F3FC #x200D #x2640 #xFE0F)                               "woman cartwheeling: medium-light skin tone")
-    ((#x1F938 #x1F3FD #x200D #x2640 #xFE0F)                               "woman cartwheeling: medium skin tone")
-    ((#x1F938 #x1F3FE #x200D #x2640 #xFE0F)                               "woman cartwheeling: medium-dark skin tone")
-    ((#x1F938 #x1F3FF #x200D #x2640 #xFE0F)                               "woman cartwheeling: dark skin tone")
-    ((#x1F93C)                                                    "people wrestling")
-    ((#x1F93C #x1F3FB)                                              "people wrestling: light skin tone")
-    ((#x1F93C #x1F3FC)                                              "people wrestling: medium-light skin tone")
-    ((#x1F93C #x1F3FD)                                              "people wrestling: medium skin tone")
-    ((#x1F93C #x1F3FE)                                              "people wrestling: medium-dark skin tone")
-    ((#x1F93C #x1F3FF)                                              "people wrestling: dark skin tone")
-    ((#x1F93C #x200D #x2642 #xFE0F)                                     "men wrestling")
-    ((#x1F93C #x1F3FB #x200D #x2642 #xFE0F)                               "men wrestling: light skin tone")
-    ((#x1F93C #x1F3FC #x200D #x2642 #xFE0F)                               "men wrestling: medium-light skin tone")
-    ((#x1F93C #x1F3FD #x200D #x2642 #xFE0F)                               "men wrestling: medium skin tone")
-    ((#x1F93C #x1F3FE #x200D #x2642 #xFE0F)                               "men wrestling: medium-dark skin tone")
-    ((#x1F93C #x1F3FF #x200D #x2642 #xFE0F)                               "men wrestling: dark skin tone")
-    ((#x1F93C #x200D #x2640 #xFE0F)                                     "women wrestling")
-    ((#x1F93C #x1F3FB #x200D #x2640 #xFE0F)                               "women wrestling: light skin tone")
-    ((#x1F93C #x1F3FC #x200D #x2640 #xFE0F)                               "women wrestling: medium-light skin tone")
-    ((#x1F93C #x1F3FD #x200D #x2640 #xFE0F)                               "women wrestling: medium skin tone")
-    ((#x1F93C #x1F3FE #x200D #x2640 #xFE0F)                               "women wrestling: medium-dark skin tone")
-    ((#x1F93C #x1F3FF #x200D #x2640 #xFE0F)                               "women wrestling: dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1FAEF #x200D #x1F9D1 #x1F3FC)                  "people wrestling: light skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1FAEF #x200D #x1F9D1 #x1F3FD)                  "people wrestling: light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1FAEF #x200D #x1F9D1 #x1F3FE)                  "people wrestling: light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1FAEF #x200D #x1F9D1 #x1F3FF)                  "people wrestling: light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1FAEF #x200D #x1F9D1 #x1F3FB)                  "people wrestling: medium-light skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1FAEF #x200D #x1F9D1 #x1F3FD)                  "people wrestling: medium-light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1FAEF #x200D #x1F9D1 #x1F3FE)                  "people wrestling: medium-light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1FAEF #x200D #x1F9D1 #x1F3FF)                  "people wrestling: medium-light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1FAEF #x200D #x1F9D1 #x1F3FB)                  "people wrestling: medium skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1FAEF #x200D #x1F9D1 #x1F3FC)                  "people wrestling: medium skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1FAEF #x200D #x1F9D1 #x1F3FE)                  "people wrestling: medium skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1FAEF #x200D #x1F9D1 #x1F3FF)                  "people wrestling: medium skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1FAEF #x200D #x1F9D1 #x1F3FB)                  "people wrestling: medium-dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1FAEF #x200D #x1F9D1 #x1F3FC)                  "people wrestling: medium-dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1FAEF #x200D #x1F9D1 #x1F3FD)                  "people wrestling: medium-dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1FAEF #x200D #x1F9D1 #x1F3FF)                  "people wrestling: medium-dark skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1FAEF #x200D #x1F9D1 #x1F3FB)                  "people wrestling: dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1FAEF #x200D #x1F9D1 #x1F3FC)                  "people wrestling: dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1FAEF #x200D #x1F9D1 #x1F3FD)                  "people wrestling: dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1FAEF #x200D #x1F9D1 #x1F3FE)                  "people wrestling: dark skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1FAEF #x200D #x1F468 #x1F3FC)                  "men wrestling: light skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1FAEF #x200D #x1F468 #x1F3FD)                  "men wrestling: light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1FAEF #x200D #x1F468 #x1F3FE)                  "men wrestling: light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1FAEF #x200D #x1F468 #x1F3FF)                  "men wrestling: light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1FAEF #x200D #x1F468 #x1F3FB)                  "men wrestling: medium-light skin tone, light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1FAEF #x200D #x1F468 #x1F3FD)                  "men wrestling: medium-light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1FAEF #x200D #x1F468 #x1F3FE)                  "men wrestling: medium-light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1FAEF #x200D #x1F468 #x1F3FF)                  "men wrestling: medium-light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1FAEF #x200D #x1F468 #x1F3FB)                  "men wrestling: medium skin tone, light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1FAEF #x200D #x1F468 #x1F3FC)                  "men wrestling: medium skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1FAEF #x200D #x1F468 #x1F3FE)                  "men wrestling: medium skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1FAEF #x200D #x1F468 #x1F3FF)                  "men wrestling: medium skin tone, dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1FAEF #x200D #x1F468 #x1F3FB)                  "men wrestling: medium-dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1FAEF #x200D #x1F468 #x1F3FC)                  "men wrestling: medium-dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1FAEF #x200D #x1F468 #x1F3FD)                  "men wrestling: medium-dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1FAEF #x200D #x1F468 #x1F3FF)                  "men wrestling: medium-dark skin tone, dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1FAEF #x200D #x1F468 #x1F3FB)                  "men wrestling: dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1FAEF #x200D #x1F468 #x1F3FC)                  "men wrestling: dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1FAEF #x200D #x1F468 #x1F3FD)                  "men wrestling: dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1FAEF #x200D #x1F468 #x1F3FE)                  "men wrestling: dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1FAEF #x200D #x1F469 #x1F3FC)                  "women wrestling: light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1FAEF #x200D #x1F469 #x1F3FD)                  "women wrestling: light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1FAEF #x200D #x1F469 #x1F3FE)                  "women wrestling: light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1FAEF #x200D #x1F469 #x1F3FF)                  "women wrestling: light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1FAEF #x200D #x1F469 #x1F3FB)                  "women wrestling: medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1FAEF #x200D #x1F469 #x1F3FD)                  "women wrestling: medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1FAEF #x200D #x1F469 #x1F3FE)                  "women wrestling: medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1FAEF #x200D #x1F469 #x1F3FF)                  "women wrestling: medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1FAEF #x200D #x1F469 #x1F3FB)                  "women wrestling: medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1FAEF #x200D #x1F469 #x1F3FC)                  "women wrestling: medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1FAEF #x200D #x1F469 #x1F3FE)                  "women wrestling: medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1FAEF #x200D #x1F469 #x1F3FF)                  "women wrestling: medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1FAEF #x200D #x1F469 #x1F3FB)                  "women wrestling: medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1FAEF #x200D #x1F469 #x1F3FC)                  "women wrestling: medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1FAEF #x200D #x1F469 #x1F3FD)                  "women wrestling: medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1FAEF #x200D #x1F469 #x1F3FF)                  "women wrestling: medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1FAEF #x200D #x1F469 #x1F3FB)                  "women wrestling: dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1FAEF #x200D #x1F469 #x1F3FC)                  "women wrestling: dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1FAEF #x200D #x1F469 #x1F3FD)                  "women wrestling: dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1FAEF #x200D #x1F469 #x1F3FE)                  "women wrestling: dark skin tone, medium-dark skin tone")
-    ((#x1F93D)                                                    "person playing water polo")
-    ((#x1F93D #x1F3FB)                                              "person playing water polo: light skin tone")
-    ((#x1F93D #x1F3FC)                                              "person playing water polo: medium-light skin tone")
-    ((#x1F93D #x1F3FD)                                              "person playing water polo: medium skin tone")
-    ((#x1F93D #x1F3FE)                                              "person playing water polo: medium-dark skin tone")
-    ((#x1F93D #x1F3FF)                                              "person playing water polo: dark skin tone")
-    ((#x1F93D #x200D #x2642 #xFE0F)                                     "man playing water polo")
-    ((#x1F93D #x1F3FB #x200D #x2642 #xFE0F)                               "man playing water polo: light skin tone")
-    ((#x1F93D #x1F3FC #x200D #x2642 #xFE0F)                               "man playing water polo: medium-light skin tone")
-    ((#x1F93D #x1F3FD #x200D #x2642 #xFE0F)                               "man playing water polo: medium skin tone")
-    ((#x1F93D #x1F3FE #x200D #x2642 #xFE0F)                               "man playing water polo: medium-dark skin tone")
-    ((#x1F93D #x1F3FF #x200D #x2642 #xFE0F)                               "man playing water polo: dark skin tone")
-    ((#x1F93D #x200D #x2640 #xFE0F)                                     "woman playing water polo")
-    ((#x1F93D #x1F3FB #x200D #x2640 #xFE0F)                               "woman playing water polo: light skin tone")
-    ((#x1F93D #x1F3FC #x200D #x2640 #xFE0F)                               "woman playing water polo: medium-light skin tone")
-    ((#x1F93D #x1F3FD #x200D #x2640 #xFE0F)                               "woman playing water polo: medium skin tone")
-    ((#x1F93D #x1F3FE #x200D #x2640 #xFE0F)                               "woman playing water polo: medium-dark skin tone")
-    ((#x1F93D #x1F3FF #x200D #x2640 #xFE0F)                               "woman playing water polo: dark skin tone")
-    ((#x1F93E)                                                    "person playing handball")
-    ((#x1F93E #x1F3FB)                                              "person playing handball: light skin tone")
-    ((#x1F93E #x1F3FC)                                              "person playing handball: medium-light skin tone")
-    ((#x1F93E #x1F3FD)                                              "person playing handball: medium skin tone")
-    ((#x1F93E #x1F3FE)                                              "person playing handball: medium-dark skin tone")
-    ((#x1F93E #x1F3FF)                                              "person playing handball: dark skin tone")
-    ((#x1F93E #x200D #x2642 #xFE0F)                                     "man playing handball")
-    ((#x1F93E #x1F3FB #x200D #x2642 #xFE0F)                               "man playing handball: light skin tone")
-    ((#x1F93E #x1F3FC #x200D #x2642 #xFE0F)                               "man playing handball: medium-light skin tone")
-    ((#x1F93E #x1F3FD #x200D #x2642 #xFE0F)                               "man playing handball: medium skin tone")
-    ((#x1F93E #x1F3FE #x200D #x2642 #xFE0F)                               "man playing handball: medium-dark skin tone")
-    ((#x1F93E #x1F3FF #x200D #x2642 #xFE0F)                               "man playing handball: dark skin tone")
-    ((#x1F93E #x200D #x2640 #xFE0F)                                     "woman playing handball")
-    ((#x1F93E #x1F3FB #x200D #x2640 #xFE0F)                               "woman playing handball: light skin tone")
-    ((#x1F93E #x1F3FC #x200D #x2640 #xFE0F)                               "woman playing handball: medium-light skin tone")
-    ((#x1F93E #x1F3FD #x200D #x2640 #xFE0F)                               "woman playing handball: medium skin tone")
-    ((#x1F93E #x1F3FE #x200D #x2640 #xFE0F)                               "woman playing handball: medium-dark skin tone")
-    ((#x1F93E #x1F3FF #x200D #x2640 #xFE0F)                               "woman playing handball: dark skin tone")
-    ((#x1F939)                                                    "person juggling")
-    ((#x1F939 #x1F3FB)                                              "person juggling: light skin tone")
-    ((#x1F939 #x1F3FC)                                              "person juggling: medium-light skin tone")
-    ((#x1F939 #x1F3FD)                                              "person juggling: medium skin tone")
-    ((#x1F939 #x1F3FE)                                              "person juggling: medium-dark skin tone")
-    ((#x1F939 #x1F3FF)                                              "person juggling: dark skin tone")
-    ((#x1F939 #x200D #x2642 #xFE0F)                                     "man juggling")
-    ((#x1F939 #x1F3FB #x200D #x2642 #xFE0F)                               "man juggling: light skin tone")
-    ((#x1F939 #x1F3FC #x200D #x2642 #xFE0F)                               "man juggling: medium-light skin tone")
-    ((#x1F939 #x1F3FD #x200D #x2642 #xFE0F)                               "man juggling: medium skin tone")
-    ((#x1F939 #x1F3FE #x200D #x2642 #xFE0F)                               "man juggling: medium-dark skin tone")
-    ((#x1F939 #x1F3FF #x200D #x2642 #xFE0F)                               "man juggling: dark skin tone")
-    ((#x1F939 #x200D #x2640 #xFE0F)                                     "woman juggling")
-    ((#x1F939 #x1F3FB #x200D #x2640 #xFE0F)                               "woman juggling: light skin tone")
-    ((#x1F939 #x1F3FC #x200D #x2640 #xFE0F)                               "woman juggling: medium-light skin tone")
-    ((#x1F939 #x1F3FD #x200D #x2640 #xFE0F)                               "woman juggling: medium skin tone")
-    ((#x1F939 #x1F3FE #x200D #x2640 #xFE0F)                               "woman juggling: medium-dark skin tone")
-    ((#x1F939 #x1F3FF #x200D #x2640 #xFE0F)                               "woman juggling: dark skin tone")
-    ((#x1F9D8)                                                    "person in lotus position")
-    ((#x1F9D8 #x1F3FB)                                              "person in lotus position: light skin tone")
-    ((#x1F9D8 #x1F3FC)                                              "person in lotus position: medium-light skin tone")
-    ((#x1F9D8 #x1F3FD)                                              "person in lotus position: medium skin tone")
-    ((#x1F9D8 #x1F3FE)                                              "person in lotus position: medium-dark skin tone")
-    ((#x1F9D8 #x1F3FF)                                              "person in lotus position: dark skin tone")
-    ((#x1F9D8 #x200D #x2642 #xFE0F)                                     "man in lotus position")
-    ((#x1F9D8 #x1F3FB #x200D #x2642 #xFE0F)                               "man in lotus position: light skin tone")
-    ((#x1F9D8 #x1F3FC #x200D #x2642 #xFE0F)                               "man in lotus position: medium-light skin tone")
-    ((#x1F9D8 #x1F3FD #x200D #x2642 #xFE0F)                               "man in lotus position: medium skin tone")
-    ((#x1F9D8 #x1F3FE #x200D #x2642 #xFE0F)                               "man in lotus position: medium-dark skin tone")
-    ((#x1F9D8 #x1F3FF #x200D #x2642 #xFE0F)                               "man in lotus position: dark skin tone")
-    ((#x1F9D8 #x200D #x2640 #xFE0F)                                     "woman in lotus position")
-    ((#x1F9D8 #x1F3FB #x200D #x2640 #xFE0F)                               "woman in lotus position: light skin tone")
-    ((#x1F9D8 #x1F3FC #x200D #x2640 #xFE0F)                               "woman in lotus position: medium-light skin tone")
-    ((#x1F9D8 #x1F3FD #x200D #x2640 #xFE0F)                               "woman in lotus position: medium skin tone")
-    ((#x1F9D8 #x1F3FE #x200D #x2640 #xFE0F)                               "woman in lotus position: medium-dark skin tone")
-    ((#x1F9D8 #x1F3FF #x200D #x2640 #xFE0F)                               "woman in lotus position: dark skin tone")
-    ((#x1F6C0)                                                    "person taking bath")
-    ((#x1F6C0 #x1F3FB)                                              "person taking bath: light skin tone")
-    ((#x1F6C0 #x1F3FC)                                              "person taking bath: medium-light skin tone")
-    ((#x1F6C0 #x1F3FD)                                              "person taking bath: medium skin tone")
-    ((#x1F6C0 #x1F3FE)                                              "person taking bath: medium-dark skin tone")
-    ((#x1F6C0 #x1F3FF)                                              "person taking bath: dark skin tone")
-    ((#x1F6CC)                                                    "person in bed")
-    ((#x1F6CC #x1F3FB)                                              "person in bed: light skin tone")
-    ((#x1F6CC #x1F3FC)                                              "person in bed: medium-light skin tone")
-    ((#x1F6CC #x1F3FD)                                              "person in bed: medium skin tone")
-    ((#x1F6CC #x1F3FE)                                              "person in bed: medium-dark skin tone")
-    ((#x1F6CC #x1F3FF)                                              "person in bed: dark skin tone")
-    ((#x1F9D1 #x200D #x1F91D #x200D #x1F9D1)                              "people holding hands")
-    ((#x1F9D1 #x1F3FB #x200D #x1F91D #x200D #x1F9D1 #x1F3FB)                  "people holding hands: light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F91D #x200D #x1F9D1 #x1F3FC)                  "people holding hands: light skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F91D #x200D #x1F9D1 #x1F3FD)                  "people holding hands: light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F91D #x200D #x1F9D1 #x1F3FE)                  "people holding hands: light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x1F91D #x200D #x1F9D1 #x1F3FF)                  "people holding hands: light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F91D #x200D #x1F9D1 #x1F3FB)                  "people holding hands: medium-light skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F91D #x200D #x1F9D1 #x1F3FC)                  "people holding hands: medium-light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F91D #x200D #x1F9D1 #x1F3FD)                  "people holding hands: medium-light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F91D #x200D #x1F9D1 #x1F3FE)                  "people holding hands: medium-light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x1F91D #x200D #x1F9D1 #x1F3FF)                  "people holding hands: medium-light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F91D #x200D #x1F9D1 #x1F3FB)                  "people holding hands: medium skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F91D #x200D #x1F9D1 #x1F3FC)                  "people holding hands: medium skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F91D #x200D #x1F9D1 #x1F3FD)                  "people holding hands: medium skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F91D #x200D #x1F9D1 #x1F3FE)                  "people holding hands: medium skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x1F91D #x200D #x1F9D1 #x1F3FF)                  "people holding hands: medium skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F91D #x200D #x1F9D1 #x1F3FB)                  "people holding hands: medium-dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F91D #x200D #x1F9D1 #x1F3FC)                  "people holding hands: medium-dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F91D #x200D #x1F9D1 #x1F3FD)                  "people holding hands: medium-dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F91D #x200D #x1F9D1 #x1F3FE)                  "people holding hands: medium-dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x1F91D #x200D #x1F9D1 #x1F3FF)                  "people holding hands: medium-dark skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F91D #x200D #x1F9D1 #x1F3FB)                  "people holding hands: dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F91D #x200D #x1F9D1 #x1F3FC)                  "people holding hands: dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F91D #x200D #x1F9D1 #x1F3FD)                  "people holding hands: dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F91D #x200D #x1F9D1 #x1F3FE)                  "people holding hands: dark skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x1F91D #x200D #x1F9D1 #x1F3FF)                  "people holding hands: dark skin tone")
-    ((#x1F46D)                                                    "women holding hands")
-    ((#x1F46D #x1F3FB)                                              "women holding hands: light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F469 #x1F3FC)                  "women holding hands: light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F469 #x1F3FD)                  "women holding hands: light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F469 #x1F3FE)                  "women holding hands: light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F469 #x1F3FF)                  "women holding hands: light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F469 #x1F3FB)                  "women holding hands: medium-light skin tone, light skin tone")
-    ((#x1F46D #x1F3FC)                                              "women holding hands: medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F469 #x1F3FD)                  "women holding hands: medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F469 #x1F3FE)                  "women holding hands: medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F469 #x1F3FF)                  "women holding hands: medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F469 #x1F3FB)                  "women holding hands: medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F469 #x1F3FC)                  "women holding hands: medium skin tone, medium-light skin tone")
-    ((#x1F46D #x1F3FD)                                              "women holding hands: medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F469 #x1F3FE)                  "women holding hands: medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F469 #x1F3FF)                  "women holding hands: medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F469 #x1F3FB)                  "women holding hands: medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F469 #x1F3FC)                  "women holding hands: medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F469 #x1F3FD)                  "women holding hands: medium-dark skin tone, medium skin tone")
-    ((#x1F46D #x1F3FE)                                              "women holding hands: medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F469 #x1F3FF)                  "women holding hands: medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F469 #x1F3FB)                  "women holding hands: dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F469 #x1F3FC)                  "women holding hands: dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F469 #x1F3FD)                  "women holding hands: dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F469 #x1F3FE)                  "women holding hands: dark skin tone, medium-dark skin tone")
-    ((#x1F46D #x1F3FF)                                              "women holding hands: dark skin tone")
-    ((#x1F46B)                                                    "woman and man holding hands")
-    ((#x1F46B #x1F3FB)                                              "woman and man holding hands: light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "woman and man holding hands: light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "woman and man holding hands: light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "woman and man holding hands: light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "woman and man holding hands: light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "woman and man holding hands: medium-light skin tone, light skin tone")
-    ((#x1F46B #x1F3FC)                                              "woman and man holding hands: medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "woman and man holding hands: medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "woman and man holding hands: medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "woman and man holding hands: medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "woman and man holding hands: medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "woman and man holding hands: medium skin tone, medium-light skin tone")
-    ((#x1F46B #x1F3FD)                                              "woman and man holding hands: medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "woman and man holding hands: medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "woman and man holding hands: medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "woman and man holding hands: medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "woman and man holding hands: medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "woman and man holding hands: medium-dark skin tone, medium skin tone")
-    ((#x1F46B #x1F3FE)                                              "woman and man holding hands: medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "woman and man holding hands: medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "woman and man holding hands: dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "woman and man holding hands: dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "woman and man holding hands: dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "woman and man holding hands: dark skin tone, medium-dark skin tone")
-    ((#x1F46B #x1F3FF)                                              "woman and man holding hands: dark skin tone")
-    ((#x1F46C)                                                    "men holding hands")
-    ((#x1F46C #x1F3FB)                                              "men holding hands: light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "men holding hands: light skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "men holding hands: light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "men holding hands: light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "men holding hands: light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "men holding hands: medium-light skin tone, light skin tone")
-    ((#x1F46C #x1F3FC)                                              "men holding hands: medium-light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "men holding hands: medium-light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "men holding hands: medium-light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "men holding hands: medium-light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "men holding hands: medium skin tone, light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "men holding hands: medium skin tone, medium-light skin tone")
-    ((#x1F46C #x1F3FD)                                              "men holding hands: medium skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "men holding hands: medium skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "men holding hands: medium skin tone, dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "men holding hands: medium-dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "men holding hands: medium-dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "men holding hands: medium-dark skin tone, medium skin tone")
-    ((#x1F46C #x1F3FE)                                              "men holding hands: medium-dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x1F91D #x200D #x1F468 #x1F3FF)                  "men holding hands: medium-dark skin tone, dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FB)                  "men holding hands: dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FC)                  "men holding hands: dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FD)                  "men holding hands: dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FF #x200D #x1F91D #x200D #x1F468 #x1F3FE)                  "men holding hands: dark skin tone, medium-dark skin tone")
-    ((#x1F46C #x1F3FF)                                              "men holding hands: dark skin tone")
-    ((#x1F48F)                                                    "kiss")
-    ((#x1F48F #x1F3FB)                                              "kiss: light skin tone")
-    ((#x1F48F #x1F3FC)                                              "kiss: medium-light skin tone")
-    ((#x1F48F #x1F3FD)                                              "kiss: medium skin tone")
-    ((#x1F48F #x1F3FE)                                              "kiss: medium-dark skin tone")
-    ((#x1F48F #x1F3FF)                                              "kiss: dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FC)   "kiss: person, person, light skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FD)   "kiss: person, person, light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FE)   "kiss: person, person, light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FF)   "kiss: person, person, light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FB)   "kiss: person, person, medium-light skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FD)   "kiss: person, person, medium-light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FE)   "kiss: person, person, medium-light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FF)   "kiss: person, person, medium-light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FB)   "kiss: person, person, medium skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FC)   "kiss: person, person, medium skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FE)   "kiss: person, person, medium skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FF)   "kiss: person, person, medium skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FB)   "kiss: person, person, medium-dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FC)   "kiss: person, person, medium-dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FD)   "kiss: person, person, medium-dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FF)   "kiss: person, person, medium-dark skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FB)   "kiss: person, person, dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FC)   "kiss: person, person, dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FD)   "kiss: person, person, dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F9D1 #x1F3FE)   "kiss: person, person, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468)               "kiss: woman, man")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: woman, man, light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: woman, man, light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: woman, man, light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: woman, man, light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: woman, man, light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: woman, man, medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: woman, man, medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: woman, man, medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: woman, man, medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: woman, man, medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: woman, man, medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: woman, man, medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: woman, man, medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: woman, man, medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: woman, man, medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: woman, man, medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: woman, man, medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: woman, man, medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: woman, man, medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: woman, man, medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: woman, man, dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: woman, man, dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: woman, man, dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: woman, man, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: woman, man, dark skin tone")
-    ((#x1F468 #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468)               "kiss: man, man")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: man, man, light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: man, man, light skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: man, man, light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: man, man, light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: man, man, light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: man, man, medium-light skin tone, light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: man, man, medium-light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: man, man, medium-light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: man, man, medium-light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: man, man, medium-light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: man, man, medium skin tone, light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: man, man, medium skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: man, man, medium skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: man, man, medium skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: man, man, medium skin tone, dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: man, man, medium-dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: man, man, medium-dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: man, man, medium-dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: man, man, medium-dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: man, man, medium-dark skin tone, dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FB)   "kiss: man, man, dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FC)   "kiss: man, man, dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FD)   "kiss: man, man, dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FE)   "kiss: man, man, dark skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F468 #x1F3FF)   "kiss: man, man, dark skin tone")
-    ((#x1F469 #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469)               "kiss: woman, woman")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FB)   "kiss: woman, woman, light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FC)   "kiss: woman, woman, light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FD)   "kiss: woman, woman, light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FE)   "kiss: woman, woman, light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FF)   "kiss: woman, woman, light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FB)   "kiss: woman, woman, medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FC)   "kiss: woman, woman, medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FD)   "kiss: woman, woman, medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FE)   "kiss: woman, woman, medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FF)   "kiss: woman, woman, medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FB)   "kiss: woman, woman, medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FC)   "kiss: woman, woman, medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FD)   "kiss: woman, woman, medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FE)   "kiss: woman, woman, medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FF)   "kiss: woman, woman, medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FB)   "kiss: woman, woman, medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FC)   "kiss: woman, woman, medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FD)   "kiss: woman, woman, medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FE)   "kiss: woman, woman, medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FF)   "kiss: woman, woman, medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FB)   "kiss: woman, woman, dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FC)   "kiss: woman, woman, dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FD)   "kiss: woman, woman, dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FE)   "kiss: woman, woman, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F48B #x200D #x1F469 #x1F3FF)   "kiss: woman, woman, dark skin tone")
-    ((#x1F491)                                                    "couple with heart")
-    ((#x1F491 #x1F3FB)                                              "couple with heart: light skin tone")
-    ((#x1F491 #x1F3FC)                                              "couple with heart: medium-light skin tone")
-    ((#x1F491 #x1F3FD)                                              "couple with heart: medium skin tone")
-    ((#x1F491 #x1F3FE)                                              "couple with heart: medium-dark skin tone")
-    ((#x1F491 #x1F3FF)                                              "couple with heart: dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FC)              "couple with heart: person, person, light skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FD)              "couple with heart: person, person, light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FE)              "couple with heart: person, person, light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FF)              "couple with heart: person, person, light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FB)              "couple with heart: person, person, medium-light skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FD)              "couple with heart: person, person, medium-light skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FE)              "couple with heart: person, person, medium-light skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FF)              "couple with heart: person, person, medium-light skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FB)              "couple with heart: person, person, medium skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FC)              "couple with heart: person, person, medium skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FE)              "couple with heart: person, person, medium skin tone, medium-dark skin tone")
-    ((#x1F9D1 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FF)              "couple with heart: person, person, medium skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FB)              "couple with heart: person, person, medium-dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FC)              "couple with heart: person, person, medium-dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FD)              "couple with heart: person, person, medium-dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FF)              "couple with heart: person, person, medium-dark skin tone, dark skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FB)              "couple with heart: person, person, dark skin tone, light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FC)              "couple with heart: person, person, dark skin tone, medium-light skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FD)              "couple with heart: person, person, dark skin tone, medium skin tone")
-    ((#x1F9D1 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F9D1 #x1F3FE)              "couple with heart: person, person, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x200D #x2764 #xFE0F #x200D #x1F468)                          "couple with heart: woman, man")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: woman, man, light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: woman, man, light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: woman, man, light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: woman, man, light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: woman, man, light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: woman, man, medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: woman, man, medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: woman, man, medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: woman, man, medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: woman, man, medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: woman, man, medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: woman, man, medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: woman, man, medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: woman, man, medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: woman, man, medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: woman, man, medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: woman, man, medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: woman, man, medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: woman, man, medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: woman, man, medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: woman, man, dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: woman, man, dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: woman, man, dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: woman, man, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: woman, man, dark skin tone")
-    ((#x1F468 #x200D #x2764 #xFE0F #x200D #x1F468)                          "couple with heart: man, man")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: man, man, light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: man, man, light skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: man, man, light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: man, man, light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: man, man, light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: man, man, medium-light skin tone, light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: man, man, medium-light skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: man, man, medium-light skin tone, medium skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: man, man, medium-light skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: man, man, medium-light skin tone, dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: man, man, medium skin tone, light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: man, man, medium skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: man, man, medium skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: man, man, medium skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: man, man, medium skin tone, dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: man, man, medium-dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: man, man, medium-dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: man, man, medium-dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: man, man, medium-dark skin tone")
-    ((#x1F468 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: man, man, medium-dark skin tone, dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FB)              "couple with heart: man, man, dark skin tone, light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FC)              "couple with heart: man, man, dark skin tone, medium-light skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FD)              "couple with heart: man, man, dark skin tone, medium skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FE)              "couple with heart: man, man, dark skin tone, medium-dark skin tone")
-    ((#x1F468 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F468 #x1F3FF)              "couple with heart: man, man, dark skin tone")
-    ((#x1F469 #x200D #x2764 #xFE0F #x200D #x1F469)                          "couple with heart: woman, woman")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FB)              "couple with heart: woman, woman, light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FC)              "couple with heart: woman, woman, light skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FD)              "couple with heart: woman, woman, light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FE)              "couple with heart: woman, woman, light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FB #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FF)              "couple with heart: woman, woman, light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FB)              "couple with heart: woman, woman, medium-light skin tone, light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FC)              "couple with heart: woman, woman, medium-light skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FD)              "couple with heart: woman, woman, medium-light skin tone, medium skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FE)              "couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FC #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FF)              "couple with heart: woman, woman, medium-light skin tone, dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FB)              "couple with heart: woman, woman, medium skin tone, light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FC)              "couple with heart: woman, woman, medium skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FD)              "couple with heart: woman, woman, medium skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FE)              "couple with heart: woman, woman, medium skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FD #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FF)              "couple with heart: woman, woman, medium skin tone, dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FB)              "couple with heart: woman, woman, medium-dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FC)              "couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FD)              "couple with heart: woman, woman, medium-dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FE)              "couple with heart: woman, woman, medium-dark skin tone")
-    ((#x1F469 #x1F3FE #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FF)              "couple with heart: woman, woman, medium-dark skin tone, dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FB)              "couple with heart: woman, woman, dark skin tone, light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FC)              "couple with heart: woman, woman, dark skin tone, medium-light skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FD)              "couple with heart: woman, woman, dark skin tone, medium skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FE)              "couple with heart: woman, woman, dark skin tone, medium-dark skin tone")
-    ((#x1F469 #x1F3FF #x200D #x2764 #xFE0F #x200D #x1F469 #x1F3FF)              "couple with heart: woman, woman, dark skin tone")
-    ((#x1F468 #x200D #x1F469 #x200D #x1F466)                              "family: man, woman, boy")
-    ((#x1F468 #x200D #x1F469 #x200D #x1F467)                              "family: man, woman, girl")
-    ((#x1F468 #x200D #x1F469 #x200D #x1F467 #x200D #x1F466)                   "family: man, woman, girl, boy")
-    ((#x1F468 #x200D #x1F469 #x200D #x1F466 #x200D #x1F466)                   "family: man, woman, boy, boy")
-    ((#x1F468 #x200D #x1F469 #x200D #x1F467 #x200D #x1F467)                   "family: man, woman, girl, girl")
-    ((#x1F468 #x200D #x1F468 #x200D #x1F466)                              "family: man, man, boy")
-    ((#x1F468 #x200D #x1F468 #x200D #x1F467)                              "family: man, man, girl")
-    ((#x1F468 #x200D #x1F468 #x200D #x1F467 #x200D #x1F466)                   "family: man, man, girl, boy")
-    ((#x1F468 #x200D #x1F468 #x200D #x1F466 #x200D #x1F466)                   "family: man, man, boy, boy")
-    ((#x1F468 #x200D #x1F468 #x200D #x1F467 #x200D #x1F467)                   "family: man, man, girl, girl")
-    ((#x1F469 #x200D #x1F469 #x200D #x1F466)                              "family: woman, woman, boy")
-    ((#x1F469 #x200D #x1F469 #x200D #x1F467)                              "family: woman, woman, girl")
-    ((#x1F469 #x200D #x1F469 #x200D #x1F467 #x200D #x1F466)                   "family: woman, woman, girl, boy")
-    ((#x1F469 #x200D #x1F469 #x200D #x1F466 #x200D #x1F466)                   "family: woman, woman, boy, boy")
-    ((#x1F469 #x200D #x1F469 #x200D #x1F467 #x200D #x1F467)                   "family: woman, woman, girl, girl")
-    ((#x1F468 #x200D #x1F466)                                         "family: man, boy")
-    ((#x1F468 #x200D #x1F466 #x200D #x1F466)                              "family: man, boy, boy")
-    ((#x1F468 #x200D #x1F467)                                         "family: man, girl")
-    ((#x1F468 #x200D #x1F467 #x200D #x1F466)                              "family: man, girl, boy")
-    ((#x1F468 #x200D #x1F467 #x200D #x1F467)                              "family: man, girl, girl")
-    ((#x1F469 #x200D #x1F466)                                         "family: woman, boy")
-    ((#x1F469 #x200D #x1F466 #x200D #x1F466)                              "family: woman, boy, boy")
-    ((#x1F469 #x200D #x1F467)                                         "family: woman, girl")
-    ((#x1F469 #x200D #x1F467 #x200D #x1F466)                              "family: woman, girl, boy")
-    ((#x1F469 #x200D #x1F467 #x200D #x1F467)                              "family: woman, girl, girl")
-    ((#x1F5E3 #xFE0F)                                               "speaking head")
-    ((#x1F464)                                                    "bust in silhouette")
-    ((#x1F465)                                                    "busts in silhouette")
-    ((#x1FAC2)                                                    "people hugging")
-    ((#x1F46A)                                                    "family")
-    ((#x1F9D1 #x200D #x1F9D1 #x200D #x1F9D2)                              "family: adult, adult, child")
-    ((#x1F9D1 #x200D #x1F9D1 #x200D #x1F9D2 #x200D #x1F9D2)                   "family: adult, adult, child, child")
-    ((#x1F9D1 #x200D #x1F9D2)                                         "family: adult, child")
-    ((#x1F9D1 #x200D #x1F9D2 #x200D #x1F9D2)                              "family: adult, child, child")
-    ((#x1F463)                                                    "footprints")
-    ((#x1FAC6)                                                    "fingerprint")
-    ((#x1F435)                                                    "monkey face")
-    ((#x1F412)                                                    "monkey")
-    ((#x1F98D)                                                    "gorilla")
-    ((#x1F9A7)                                                    "orangutan")
-    ((#x1F436)                                                    "dog face")
-    ((#x1F415)                                                    "dog")
-    ((#x1F9AE)                                                    "guide dog")
-    ((#x1F415 #x200D #x1F9BA)                                         "service dog")
-    ((#x1F429)                                                    "poodle")
-    ((#x1F43A)                                                    "wolf")
-    ((#x1F98A)                                                    "fox")
-    ((#x1F99D)                                                    "raccoon")
-    ((#x1F431)                                                    "cat face")
-    ((#x1F408)                                                    "cat")
-    ((#x1F408 #x200D #x2B1B)                                          "black cat")
-    ((#x1F981)                                                    "lion")
-    ((#x1F42F)                                                    "tiger face")
-    ((#x1F405)                                                    "tiger")
-    ((#x1F406)                                                    "leopard")
-    ((#x1F434)                                                    "horse face")
-    ((#x1FACE)                                                    "moose")
-    ((#x1FACF)                                                    "donkey")
-    ((#x1F40E)                                                    "horse")
-    ((#x1F984)                                                    "unicorn")
-    ((#x1F993)                                                    "zebra")
-    ((#x1F98C)                                                    "deer")
-    ((#x1F9AC)                                                    "bison")
-    ((#x1F42E)                                                    "cow face")
-    ((#x1F402)                                                    "ox")
-    ((#x1F403)                                                    "water buffalo")
-    ((#x1F404)                                                    "cow")
-    ((#x1F437)                                                    "pig face")
-    ((#x1F416)                                                    "pig")
-    ((#x1F417)                                                    "boar")
-    ((#x1F43D)                                                    "pig nose")
-    ((#x1F40F)                                                    "ram")
-    ((#x1F411)                                                    "ewe")
-    ((#x1F410)                                                    "goat")
-    ((#x1F42A)                                                    "camel")
-    ((#x1F42B)                                                    "two-hump camel")
-    ((#x1F999)                                                    "llama")
-    ((#x1F992)                                                    "giraffe")
-    ((#x1F418)                                                    "elephant")
-    ((#x1F9A3)                                                    "mammoth")
-    ((#x1F98F)                                                    "rhinoceros")
-    ((#x1F99B)                                                    "hippopotamus")
-    ((#x1F42D)                                                    "mouse face")
-    ((#x1F401)                                                    "mouse")
-    ((#x1F400)                                                    "rat")
-    ((#x1F439)                                                    "hamster")
-    ((#x1F430)                                                    "rabbit face")
-    ((#x1F407)                                                    "rabbit")
-    ((#x1F43F #xFE0F)                                               "chipmunk")
-    ((#x1F9AB)                                                    "beaver")
-    ((#x1F994)                                                    "hedgehog")
-    ((#x1F987)                                                    "bat")
-    ((#x1F43B)                                                    "bear")
-    ((#x1F43B #x200D #x2744 #xFE0F)                                     "polar bear")
-    ((#x1F428)                                                    "koala")
-    ((#x1F43C)                                                    "panda")
-    ((#x1F9A5)                                                    "sloth")
-    ((#x1F9A6)                                                    "otter")
-    ((#x1F9A8)                                                    "skunk")
-    ((#x1F998)                                                    "kangaroo")
-    ((#x1F9A1)                                                    "badger")
-    ((#x1F43E)                                                    "paw prints")
-    ((#x1F983)                                                    "turkey")
-    ((#x1F414)                                                    "chicken")
-    ((#x1F413)                                                    "rooster")
-    ((#x1F423)                                                    "hatching chick")
-    ((#x1F424)                                                    "baby chick")
-    ((#x1F425)                                                    "front-facing baby chick")
-    ((#x1F426)                                                    "bird")
-    ((#x1F427)                                                    "penguin")
-    ((#x1F54A #xFE0F)                                               "dove")
-    ((#x1F985)                                                    "eagle")
-    ((#x1F986)                                                    "duck")
-    ((#x1F9A2)                                                    "swan")
-    ((#x1F989)                                                    "owl")
-    ((#x1F9A4)                                                    "dodo")
-    ((#x1FAB6)                                                    "feather")
-    ((#x1F9A9)                                                    "flamingo")
-    ((#x1F99A)                                                    "peacock")
-    ((#x1F99C)                                                    "parrot")
-    ((#x1FABD)                                                    "wing")
-    ((#x1F426 #x200D #x2B1B)                                          "black bird")
-    ((#x1FABF)                                                    "goose")
-    ((#x1F426 #x200D #x1F525)                                         "phoenix")
-    ((#x1F438)                                                    "frog")
-    ((#x1F40A)                                                    "crocodile")
-    ((#x1F422)                                                    "turtle")
-    ((#x1F98E)                                                    "lizard")
-    ((#x1F40D)                                                    "snake")
-    ((#x1F432)                                                    "dragon face")
-    ((#x1F409)                                                    "dragon")
-    ((#x1F995)                                                    "sauropod")
-    ((#x1F996)                                                    "T-Rex")
-    ((#x1F433)                                                    "spouting whale")
-    ((#x1F40B)                                                    "whale")
-    ((#x1F42C)                                                    "dolphin")
-    ((#x1FACD)                                                    "orca")
-    ((#x1F9AD)                                                    "seal")
-    ((#x1F41F)                                                    "fish")
-    ((#x1F420)                                                    "tropical fish")
-    ((#x1F421)                                                    "blowfish")
-    ((#x1F988)                                                    "shark")
-    ((#x1F419)                                                    "octopus")
-    ((#x1F41A)                                                    "spiral shell")
-    ((#x1FAB8)                                                    "coral")
-    ((#x1FABC)                                                    "jellyfish")
-    ((#x1F980)                                                    "crab")
-    ((#x1F99E)                                                    "lobster")
-    ((#x1F990)                                                    "shrimp")
-    ((#x1F991)                                                    "squid")
-    ((#x1F9AA)                                                    "oyster")
-    ((#x1F40C)                                                    "snail")
-    ((#x1F98B)                                                    "butterfly")
-    ((#x1F41B)                                                    "bug")
-    ((#x1F41C)                                                    "ant")
-    ((#x1F41D)                                                    "honeybee")
-    ((#x1FAB2)                                                    "beetle")
-    ((#x1F41E)                                                    "lady beetle")
-    ((#x1F997)                                                    "cricket")
-    ((#x1FAB3)                                                    "cockroach")
-    ((#x1F577 #xFE0F)                                               "spider")
-    ((#x1F578 #xFE0F)                                               "spider web")
-    ((#x1F982)                                                    "scorpion")
-    ((#x1F99F)                                                    "mosquito")
-    ((#x1FAB0)                                                    "fly")
-    ((#x1FAB1)                                                    "worm")
-    ((#x1F9A0)                                                    "microbe")
-    ((#x1F490)                                                    "bouquet")
-    ((#x1F338)                                                    "cherry blossom")
-    ((#x1F4AE)                                                    "white flower")
-    ((#x1FAB7)                                                    "lotus")
-    ((#x1F3F5 #xFE0F)                                               "rosette")
-    ((#x1F339)                                                    "rose")
-    ((#x1F940)                                                    "wilted flower")
-    ((#x1F33A)                                                    "hibiscus")
-    ((#x1F33B)                                                    "sunflower")
-    ((#x1F33C)                                                    "blossom")
-    ((#x1F337)                                                    "tulip")
-    ((#x1FABB)                                                    "hyacinth")
-    ((#x1F331)                                                    "seedling")
-    ((#x1FAB4)                                                    "potted plant")
-    ((#x1F332)                                                    "evergreen tree")
-    ((#x1F333)                                                    "deciduous tree")
-    ((#x1F334)                                                    "palm tree")
-    ((#x1F335)                                                    "cactus")
-    ((#x1F33E)                                                    "sheaf of rice")
-    ((#x1F33F)                                                    "herb")
-    ((#x2618 #xFE0F)                                                "shamrock")
-    ((#x1F340)                                                    "four leaf clover")
-    ((#x1F341)                                                    "maple leaf")
-    ((#x1F342)                                                    "fallen leaf")
-    ((#x1F343)                                                    "leaf fluttering in wind")
-    ((#x1FAB9)                                                    "empty nest")
-    ((#x1FABA)                                                    "nest with eggs")
-    ((#x1F344)                                                    "mushroom")
-    ((#x1FABE)                                                    "leafless tree")
-    ((#x1F347)                                                    "grapes")
-    ((#x1F348)                                                    "melon")
-    ((#x1F349)                                                    "watermelon")
-    ((#x1F34A)                                                    "tangerine")
-    ((#x1F34B)                                                    "lemon")
-    ((#x1F34B #x200D #x1F7E9)                                         "lime")
-    ((#x1F34C)                                                    "banana")
-    ((#x1F34D)                                                    "pineapple")
-    ((#x1F96D)                                                    "mango")
-    ((#x1F34E)                                                    "red apple")
-    ((#x1F34F)                                                    "green apple")
-    ((#x1F350)                                                    "pear")
-    ((#x1F351)                                                    "peach")
-    ((#x1F352)                                                    "cherries")
-    ((#x1F353)                                                    "strawberry")
-    ((#x1FAD0)                                                    "blueberries")
-    ((#x1F95D)                                                    "kiwi fruit")
-    ((#x1F345)                                                    "tomato")
-    ((#x1FAD2)                                                    "olive")
-    ((#x1F965)                                                    "coconut")
-    ((#x1F951)                                                    "avocado")
-    ((#x1F346)                                                    "eggplant")
-    ((#x1F954)                                                    "potato")
-    ((#x1F955)                                                    "carrot")
-    ((#x1F33D)                                                    "ear of corn")
-    ((#x1F336 #xFE0F)                                               "hot pepper")
-    ((#x1FAD1)                                                    "bell pepper")
-    ((#x1F952)                                                    "cucumber")
-    ((#x1F96C)                                                    "leafy green")
-    ((#x1F966)                                                    "broccoli")
-    ((#x1F9C4)                                                    "garlic")
-    ((#x1F9C5)                                                    "onion")
-    ((#x1F95C)                                                    "peanuts")
-    ((#x1FAD8)                                                    "beans")
-    ((#x1F330)                                                    "chestnut")
-    ((#x1FADA)                                                    "ginger root")
-    ((#x1FADB)                                                    "pea pod")
-    ((#x1F344 #x200D #x1F7EB)                                         "brown mushroom")
-    ((#x1FADC)                                                    "root vegetable")
-    ((#x1F35E)                                                    "bread")
-    ((#x1F950)                                                    "croissant")
-    ((#x1F956)                                                    "baguette bread")
-    ((#x1FAD3)                                                    "flatbread")
-    ((#x1F968)                                                    "pretzel")
-    ((#x1F96F)                                                    "bagel")
-    ((#x1F95E)                                                    "pancakes")
-    ((#x1F9C7)                                                    "waffle")
-    ((#x1F9C0)                                                    "cheese wedge")
-    ((#x1F356)                                                    "meat on bone")
-    ((#x1F357)                                                    "poultry leg")
-    ((#x1F969)                                                    "cut of meat")
-    ((#x1F953)                                                    "bacon")
-    ((#x1F354)                                                    "hamburger")
-    ((#x1F35F)                                                    "french fries")
-    ((#x1F355)                                                    "pizza")
-    ((#x1F32D)                                                    "hot dog")
-    ((#x1F96A)                                                    "sandwich")
-    ((#x1F32E)                                                    "taco")
-    ((#x1F32F)                                                    "burrito")
-    ((#x1FAD4)                                                    "tamale")
-    ((#x1F959)                                                    "stuffed flatbread")
-    ((#x1F9C6)                                                    "falafel")
-    ((#x1F95A)                                                    "egg")
-    ((#x1F373)                                                    "cooking")
-    ((#x1F958)                                                    "shallow pan of food")
-    ((#x1F372)                                                    "pot of food")
-    ((#x1FAD5)                                                    "fondue")
-    ((#x1F963)                                                    "bowl with spoon")
-    ((#x1F957)                                                    "green salad")
-    ((#x1F37F)                                                    "popcorn")
-    ((#x1F9C8)                                                    "butter")
-    ((#x1F9C2)                                                    "salt")
-    ((#x1F96B)                                                    "canned food")
-    ((#x1F371)                                                    "bento box")
-    ((#x1F358)                                                    "rice cracker")
-    ((#x1F359)                                                    "rice ball")
-    ((#x1F35A)                                                    "cooked rice")
-    ((#x1F35B)                                                    "curry rice")
-    ((#x1F35C)                                                    "steaming bowl")
-    ((#x1F35D)                                                    "spaghetti")
-    ((#x1F360)                                                    "roasted sweet potato")
-    ((#x1F362)                                                    "oden")
-    ((#x1F363)                                                    "sushi")
-    ((#x1F364)                                                    "fried shrimp")
-    ((#x1F365)                                                    "fish cake with swirl")
-    ((#x1F96E)                                                    "moon cake")
-    ((#x1F361)                                                    "dango")
-    ((#x1F95F)                                                    "dumpling")
-    ((#x1F960)                                                    "fortune cookie")
-    ((#x1F961)                                                    "takeout box")
-    ((#x1F366)                                                    "soft ice cream")
-    ((#x1F367)                                                    "shaved ice")
-    ((#x1F368)                                                    "ice cream")
-    ((#x1F369)                                                    "doughnut")
-    ((#x1F36A)                                                    "cookie")
-    ((#x1F382)                                                    "birthday cake")
-    ((#x1F370)                                                    "shortcake")
-    ((#x1F9C1)                                                    "cupcake")
-    ((#x1F967)                                                    "pie")
-    ((#x1F36B)                                                    "chocolate bar")
-    ((#x1F36C)                                                    "candy")
-    ((#x1F36D)                                                    "lollipop")
-    ((#x1F36E)                                                    "custard")
-    ((#x1F36F)                                                    "honey pot")
-    ((#x1F37C)                                                    "baby bottle")
-    ((#x1F95B)                                                    "glass of milk")
-    ((#x2615)                                                     "hot beverage")
-    ((#x1FAD6)                                                    "teapot")
-    ((#x1F375)                                                    "teacup without handle")
-    ((#x1F376)                                                    "sake")
-    ((#x1F37E)                                                    "bottle with popping cork")
-    ((#x1F377)                                                    "wine glass")
-    ((#x1F378)                                                    "cocktail glass")
-    ((#x1F379)                                                    "tropical drink")
-    ((#x1F37A)                                                    "beer mug")
-    ((#x1F37B)                                                    "clinking beer mugs")
-    ((#x1F942)                                                    "clinking glasses")
-    ((#x1F943)                                                    "tumbler glass")
-    ((#x1FAD7)                                                    "pouring liquid")
-    ((#x1F964)                                                    "cup with straw")
-    ((#x1F9CB)                                                    "bubble tea")
-    ((#x1F9C3)                                                    "beverage box")
-    ((#x1F9C9)                                                    "mate")
-    ((#x1F9CA)                                                    "ice")
-    ((#x1F962)                                                    "chopsticks")
-    ((#x1F37D #xFE0F)                                               "fork and knife with plate")
-    ((#x1F374)                                                    "fork and knife")
-    ((#x1F944)                                                    "spoon")
-    ((#x1F52A)                                                    "kitchen knife")
-    ((#x1FAD9)                                                    "jar")
-    ((#x1F3FA)                                                    "amphora")
-    ((#x1F30D)                                                    "globe showing Europe-Africa")
-    ((#x1F30E)                                                    "globe showing Americas")
-    ((#x1F30F)                                                    "globe showing Asia-Australia")
-    ((#x1F310)                                                    "globe with meridians")
-    ((#x1F5FA #xFE0F)                                               "world map")
-    ((#x1F5FE)                                                    "map of Japan")
-    ((#x1F9ED)                                                    "compass")
-    ((#x1F3D4 #xFE0F)                                               "snow-capped mountain")
-    ((#x26F0 #xFE0F)                                                "mountain")
-    ((#x1F6D8)                                                    "landslide")
-    ((#x1F30B)                                                    "volcano")
-    ((#x1F5FB)                                                    "mount fuji")
-    ((#x1F3D5 #xFE0F)                                               "camping")
-    ((#x1F3D6 #xFE0F)                                               "beach with umbrella")
-    ((#x1F3DC #xFE0F)                                               "desert")
-    ((#x1F3DD #xFE0F)                                               "desert island")
-    ((#x1F3DE #xFE0F)                                               "national park")
-    ((#x1F3DF #xFE0F)                                               "stadium")
-    ((#x1F3DB #xFE0F)                                               "classical building")
-    ((#x1F3D7 #xFE0F)                                               "building construction")
-    ((#x1F9F1)                                                    "brick")
-    ((#x1FAA8)                                                    "rock")
-    ((#x1FAB5)                                                    "wood")
-    ((#x1F6D6)                                                    "hut")
-    ((#x1F3D8 #xFE0F)                                               "houses")
-    ((#x1F3DA #xFE0F)                                               "derelict house")
-    ((#x1F3E0)                                                    "house")
-    ((#x1F3E1)                                                    "house with garden")
-    ((#x1F3E2)                                                    "office building")
-    ((#x1F3E3)                                                    "Japanese post office")
-    ((#x1F3E4)                                                    "post office")
-    ((#x1F3E5)                                                    "hospital")
-    ((#x1F3E6)                                                    "bank")
-    ((#x1F3E8)                                                    "hotel")
-    ((#x1F3E9)                                                    "love hotel")
-    ((#x1F3EA)                                                    "convenience store")
-    ((#x1F3EB)                                                    "school")
-    ((#x1F3EC)                                                    "department store")
-    ((#x1F3ED)                                                    "factory")
-    ((#x1F3EF)                                                    "Japanese castle")
-    ((#x1F3F0)                                                    "castle")
-    ((#x1F492)                                                    "wedding")
-    ((#x1F5FC)                                                    "Tokyo tower")
-    ((#x1F5FD)                                                    "Statue of Liberty")
-    ((#x26EA)                                                     "church")
-    ((#x1F54C)                                                    "mosque")
-    ((#x1F6D5)                                                    "hindu temple")
-    ((#x1F54D)                                                    "synagogue")
-    ((#x26E9 #xFE0F)                                                "shinto shrine")
-    ((#x1F54B)                                                    "kaaba")
-    ((#x26F2)                                                     "fountain")
-    ((#x26FA)                                                     "tent")
-    ((#x1F301)                                                    "foggy")
-    ((#x1F303)                                                    "night with stars")
-    ((#x1F3D9 #xFE0F)                                               "cityscape")
-    ((#x1F304)                                                    "sunrise over mountains")
-    ((#x1F305)                                                    "sunrise")
-    ((#x1F306)                                                    "cityscape at dusk")
-    ((#x1F307)                                                    "sunset")
-    ((#x1F309)                                                    "bridge at night")
-    ((#x2668 #xFE0F)                                                "hot springs")
-    ((#x1F3A0)                                                    "carousel horse")
-    ((#x1F6DD)                                                    "playground slide")
-    ((#x1F3A1)                                                    "ferris wheel")
-    ((#x1F3A2)                                                    "roller coaster")
-    ((#x1F488)                                                    "barber pole")
-    ((#x1F3AA)                                                    "circus tent")
-    ((#x1F682)                                                    "locomotive")
-    ((#x1F683)                                                    "railway car")
-    ((#x1F684)                                                    "high-speed train")
-    ((#x1F685)                                                    "bullet train")
-    ((#x1F686)                                                    "train")
-    ((#x1F687)                                                    "metro")
-    ((#x1F688)                                                    "light rail")
-    ((#x1F689)                                                    "station")
-    ((#x1F68A)                                                    "tram")
-    ((#x1F69D)                                                    "monorail")
-    ((#x1F69E)                                                    "mountain railway")
-    ((#x1F68B)                                                    "tram car")
-    ((#x1F68C)                                                    "bus")
-    ((#x1F68D)                                                    "oncoming bus")
-    ((#x1F68E)                                                    "trolleybus")
-    ((#x1F690)                                                    "minibus")
-    ((#x1F691)                                                    "ambulance")
-    ((#x1F692)                                                    "fire engine")
-    ((#x1F693)                                                    "police car")
-    ((#x1F694)                                                    "oncoming police car")
-    ((#x1F695)                                                    "taxi")
-    ((#x1F696)                                                    "oncoming taxi")
-    ((#x1F697)                                                    "automobile")
-    ((#x1F698)                                                    "oncoming automobile")
-    ((#x1F699)                                                    "sport utility vehicle")
-    ((#x1F6FB)                                                    "pickup truck")
-    ((#x1F69A)                                                    "delivery truck")
-    ((#x1F69B)                                                    "articulated lorry")
-    ((#x1F69C)                                                    "tractor")
-    ((#x1F3CE #xFE0F)                                               "racing car")
-    ((#x1F3CD #xFE0F)                                               "motorcycle")
-    ((#x1F6F5)                                                    "motor scooter")
-    ((#x1F9BD)                                                    "manual wheelchair")
-    ((#x1F9BC)                                                    "motorized wheelchair")
-    ((#x1F6FA)                                                    "auto rickshaw")
-    ((#x1F6B2)                                                    "bicycle")
-    ((#x1F6F4)                                                    "kick scooter")
-    ((#x1F6F9)                                                    "skateboard")
-    ((#x1F6FC)                                                    "roller skate")
-    ((#x1F68F)                                                    "bus stop")
-    ((#x1F6E3 #xFE0F)                                               "motorway")
-    ((#x1F6E4 #xFE0F)                                               "railway track")
-    ((#x1F6E2 #xFE0F)                                               "oil drum")
-    ((#x26FD)                                                     "fuel pump")
-    ((#x1F6DE)                                                    "wheel")
-    ((#x1F6A8)                                                    "police car light")
-    ((#x1F6A5)                                                    "horizontal traffic light")
-    ((#x1F6A6)                                                    "vertical traffic light")
-    ((#x1F6D1)                                                    "stop sign")
-    ((#x1F6A7)                                                    "construction")
-    ((#x2693)                                                     "anchor")
-    ((#x1F6DF)                                                    "ring buoy")
-    ((#x26F5)                                                     "sailboat")
-    ((#x1F6F6)                                                    "canoe")
-    ((#x1F6A4)                                                    "speedboat")
-    ((#x1F6F3 #xFE0F)                                               "passenger ship")
-    ((#x26F4 #xFE0F)                                                "ferry")
-    ((#x1F6E5 #xFE0F)                                               "motor boat")
-    ((#x1F6A2)                                                    "ship")
-    ((#x2708 #xFE0F)                                                "airplane")
-    ((#x1F6E9 #xFE0F)                                               "small airplane")
-    ((#x1F6EB)                                                    "airplane departure")
-    ((#x1F6EC)                                                    "airplane arrival")
-    ((#x1FA82)                                                    "parachute")
-    ((#x1F4BA)                                                    "seat")
-    ((#x1F681)                                                    "helicopter")
-    ((#x1F69F)                                                    "suspension railway")
-    ((#x1F6A0)                                                    "mountain cableway")
-    ((#x1F6A1)                                                    "aerial tramway")
-    ((#x1F6F0 #xFE0F)                                               "satellite")
-    ((#x1F680)                                                    "rocket")
-    ((#x1F6F8)                                                    "flying saucer")
-    ((#x1F6CE #xFE0F)                                               "bellhop bell")
-    ((#x1F9F3)                                                    "luggage")
-    ((#x231B)                                                     "hourglass done")
-    ((#x23F3)                                                     "hourglass not done")
-    ((#x231A)                                                     "watch")
-    ((#x23F0)                                                     "alarm clock")
-    ((#x23F1 #xFE0F)                                                "stopwatch")
-    ((#x23F2 #xFE0F)                                                "timer clock")
-    ((#x1F570 #xFE0F)                                               "mantelpiece clock")
-    ((#x1F55B)                                                    "twelve o’clock")
-    ((#x1F567)                                                    "twelve-thirty")
-    ((#x1F550)                                                    "one o’clock")
-    ((#x1F55C)                                                    "one-thirty")
-    ((#x1F551)                                                    "two o’clock")
-    ((#x1F55D)                                                    "two-thirty")
-    ((#x1F552)                                                    "three o’clock")
-    ((#x1F55E)                                                    "three-thirty")
-    ((#x1F553)                                                    "four o’clock")
-    ((#x1F55F)                                                    "four-thirty")
-    ((#x1F554)                                                    "five o’clock")
-    ((#x1F560)                                                    "five-thirty")
-    ((#x1F555)                                                    "six o’clock")
-    ((#x1F561)                                                    "six-thirty")
-    ((#x1F556)                                                    "seven o’clock")
-    ((#x1F562)                                                    "seven-thirty")
-    ((#x1F557)                                                    "eight o’clock")
-    ((#x1F563)                                                    "eight-thirty")
-    ((#x1F558)                                                    "nine o’clock")
-    ((#x1F564)                                                    "nine-thirty")
-    ((#x1F559)                                                    "ten o’clock")
-    ((#x1F565)                                                    "ten-thirty")
-    ((#x1F55A)                                                    "eleven o’clock")
-    ((#x1F566)                                                    "eleven-thirty")
-    ((#x1F311)                                                    "new moon")
-    ((#x1F312)                                                    "waxing crescent moon")
-    ((#x1F313)                                                    "first quarter moon")
-    ((#x1F314)                                                    "waxing gibbous moon")
-    ((#x1F315)                                                    "full moon")
-    ((#x1F316)                                                    "waning gibbous moon")
-    ((#x1F317)                                                    "last quarter moon")
-    ((#x1F318)                                                    "waning crescent moon")
-    ((#x1F319)                                                    "crescent moon")
-    ((#x1F31A)                                                    "new moon face")
-    ((#x1F31B)                                                    "first quarter moon face")
-    ((#x1F31C)                                                    "last quarter moon face")
-    ((#x1F321 #xFE0F)                                               "thermometer")
-    ((#x2600 #xFE0F)                                                "sun")
-    ((#x1F31D)                                                    "full moon face")
-    ((#x1F31E)                                                    "sun with face")
-    ((#x1FA90)                                                    "ringed planet")
-    ((#x2B50)                                                     "star")
-    ((#x1F31F)                                                    "glowing star")
-    ((#x1F320)                                                    "shooting star")
-    ((#x1F30C)                                                    "milky way")
-    ((#x2601 #xFE0F)                                                "cloud")
-    ((#x26C5)                                                     "sun behind cloud")
-    ((#x26C8 #xFE0F)                                                "cloud with lightning and rain")
-    ((#x1F324 #xFE0F)                                               "sun behind small cloud")
-    ((#x1F325 #xFE0F)                                               "sun behind large cloud")
-    ((#x1F326 #xFE0F)                                               "sun behind rain cloud")
-    ((#x1F327 #xFE0F)                                               "cloud with rain")
-    ((#x1F328 #xFE0F)                                               "cloud with snow")
-    ((#x1F329 #xFE0F)                                               "cloud with lightning")
-    ((#x1F32A #xFE0F)                                               "tornado")
-    ((#x1F32B #xFE0F)                                               "fog")
-    ((#x1F32C #xFE0F)                                               "wind face")
-    ((#x1F300)                                                    "cyclone")
-    ((#x1F308)                                                    "rainbow")
-    ((#x1F302)                                                    "closed umbrella")
-    ((#x2602 #xFE0F)                                                "umbrella")
-    ((#x2614)                                                     "umbrella with rain drops")
-    ((#x26F1 #xFE0F)                                                "umbrella on ground")
-    ((#x26A1)                                                     "high voltage")
-    ((#x2744 #xFE0F)                                                "snowflake")
-    ((#x2603 #xFE0F)                                                "snowman")
-    ((#x26C4)                                                     "snowman without snow")
-    ((#x2604 #xFE0F)                                                "comet")
-    ((#x1F525)                                                    "fire")
-    ((#x1F4A7)                                                    "droplet")
-    ((#x1F30A)                                                    "water wave")
-    ((#x1F383)                                                    "jack-o-lantern")
-    ((#x1F384)                                                    "Christmas tree")
-    ((#x1F386)                                                    "fireworks")
-    ((#x1F387)                                                    "sparkler")
-    ((#x1F9E8)                                                    "firecracker")
-    ((#x2728)                                                     "sparkles")
-    ((#x1F388)                                                    "balloon")
-    ((#x1F389)                                                    "party popper")
-    ((#x1F38A)                                                    "confetti ball")
-    ((#x1F38B)                                                    "tanabata tree")
-    ((#x1F38D)                                                    "pine decoration")
-    ((#x1F38E)                                                    "Japanese dolls")
-    ((#x1F38F)                                                    "carp streamer")
-    ((#x1F390)                                                    "wind chime")
-    ((#x1F391)                                                    "moon viewing ceremony")
-    ((#x1F9E7)                                                    "red envelope")
-    ((#x1F380)                                                    "ribbon")
-    ((#x1F381)                                                    "wrapped gift")
-    ((#x1F397 #xFE0F)                                               "reminder ribbon")
-    ((#x1F39F #xFE0F)                                               "admission tickets")
-    ((#x1F3AB)                                                    "ticket")
-    ((#x1F396 #xFE0F)                                               "military medal")
-    ((#x1F3C6)                                                    "trophy")
-    ((#x1F3C5)                                                    "sports medal")
-    ((#x1F947)                                                    "1st place medal")
-    ((#x1F948)                                                    "2nd place medal")
-    ((#x1F949)                                                    "3rd place medal")
-    ((#x26BD)                                                     "soccer ball")
-    ((#x26BE)                                                     "baseball")
-    ((#x1F94E)                                                    "softball")
-    ((#x1F3C0)                                                    "basketball")
-    ((#x1F3D0)                                                    "volleyball")
-    ((#x1F3C8)                                                    "american football")
-    ((#x1F3C9)                                                    "rugby football")
-    ((#x1F3BE)                                                    "tennis")
-    ((#x1F94F)                                                    "flying disc")
-    ((#x1F3B3)                                                    "bowling")
-    ((#x1F3CF)                                                    "cricket game")
-    ((#x1F3D1)                                                    "field hockey")
-    ((#x1F3D2)                                                    "ice hockey")
-    ((#x1F94D)                                                    "lacrosse")
-    ((#x1F3D3)                                                    "ping pong")
-    ((#x1F3F8)                                                    "badminton")
-    ((#x1F94A)                                                    "boxing glove")
-    ((#x1F94B)                                                    "martial arts uniform")
-    ((#x1F945)                                                    "goal net")
-    ((#x26F3)                                                     "flag in hole")
-    ((#x26F8 #xFE0F)                                                "ice skate")
-    ((#x1F3A3)                                                    "fishing pole")
-    ((#x1F93F)                                                    "diving mask")
-    ((#x1F3BD)                                                    "running shirt")
-    ((#x1F3BF)                                                    "skis")
-    ((#x1F6F7)                                                    "sled")
-    ((#x1F94C)                                                    "curling stone")
-    ((#x1F3AF)                                                    "bullseye")
-    ((#x1FA80)                                                    "yo-yo")
-    ((#x1FA81)                                                    "kite")
-    ((#x1F52B)                                                    "water pistol")
-    ((#x1F3B1)                                                    "pool 8 ball")
-    ((#x1F52E)                                                    "crystal ball")
-    ((#x1FA84)                                                    "magic wand")
-    ((#x1F3AE)                                                    "video game")
-    ((#x1F579 #xFE0F)                                               "joystick")
-    ((#x1F3B0)                                                    "slot machine")
-    ((#x1F3B2)                                                    "game die")
-    ((#x1F9E9)                                                    "puzzle piece")
-    ((#x1F9F8)                                                    "teddy bear")
-    ((#x1FA85)                                                    "piñata")
-    ((#x1FAA9)                                                    "mirror ball")
-    ((#x1FA86)                                                    "nesting dolls")
-    ((#x2660 #xFE0F)                                                "spade suit")
-    ((#x2665 #xFE0F)                                                "heart suit")
-    ((#x2666 #xFE0F)                                                "diamond suit")
-    ((#x2663 #xFE0F)                                                "club suit")
-    ((#x265F #xFE0F)                                                "chess pawn")
-    ((#x1F0CF)                                                    "joker")
-    ((#x1F004)                                                    "mahjong red dragon")
-    ((#x1F3B4)                                                    "flower playing cards")
-    ((#x1F3AD)                                                    "performing arts")
-    ((#x1F5BC #xFE0F)                                               "framed picture")
-    ((#x1F3A8)                                                    "artist palette")
-    ((#x1F9F5)                                                    "thread")
-    ((#x1FAA1)                                                    "sewing needle")
-    ((#x1F9F6)                                                    "yarn")
-    ((#x1FAA2)                                                    "knot")
-    ((#x1F453)                                                    "glasses")
-    ((#x1F576 #xFE0F)                                               "sunglasses")
-    ((#x1F97D)                                                    "goggles")
-    ((#x1F97C)                                                    "lab coat")
-    ((#x1F9BA)                                                    "safety vest")
-    ((#x1F454)                                                    "necktie")
-    ((#x1F455)                                                    "t-shirt")
-    ((#x1F456)                                                    "jeans")
-    ((#x1F9E3)                                                    "scarf")
-    ((#x1F9E4)                                                    "gloves")
-    ((#x1F9E5)                                                    "coat")
-    ((#x1F9E6)                                                    "socks")
-    ((#x1F457)                                                    "dress")
-    ((#x1F458)                                                    "kimono")
-    ((#x1F97B)                                                    "sari")
-    ((#x1FA71)                                                    "one-piece swimsuit")
-    ((#x1FA72)                                                    "briefs")
-    ((#x1FA73)                                                    "shorts")
-    ((#x1F459)                                                    "bikini")
-    ((#x1F45A)                                                    "woman’s clothes")
-    ((#x1FAAD)                                                    "folding hand fan")
-    ((#x1F45B)                                                    "purse")
-    ((#x1F45C)                                                    "handbag")
-    ((#x1F45D)                                                    "clutch bag")
-    ((#x1F6CD #xFE0F)                                               "shopping bags")
-    ((#x1F392)                                                    "backpack")
-    ((#x1FA74)                                                    "thong sandal")
-    ((#x1F45E)                                                    "man’s shoe")
-    ((#x1F45F)                                                    "running shoe")
-    ((#x1F97E)                                                    "hiking boot")
-    ((#x1F97F)                                                    "flat shoe")
-    ((#x1F460)                                                    "high-heeled shoe")
-    ((#x1F461)                                                    "woman’s sandal")
-    ((#x1FA70)                                                    "ballet shoes")
-    ((#x1F462)                                                    "woman’s boot")
-    ((#x1FAAE)                                                    "hair pick")
-    ((#x1F451)                                                    "crown")
-    ((#x1F452)                                                    "woman’s hat")
-    ((#x1F3A9)                                                    "top hat")
-    ((#x1F393)                                                    "graduation cap")
-    ((#x1F9E2)                                                    "billed cap")
-    ((#x1FA96)                                                    "military helmet")
-    ((#x26D1 #xFE0F)                                                "rescue worker’s helmet")
-    ((#x1F4FF)                                                    "prayer beads")
-    ((#x1F484)                                                    "lipstick")
-    ((#x1F48D)                                                    "ring")
-    ((#x1F48E)                                                    "gem stone")
-    ((#x1F507)                                                    "muted speaker")
-    ((#x1F508)                                                    "speaker low volume")
-    ((#x1F509)                                                    "speaker medium volume")
-    ((#x1F50A)                                                    "speaker high volume")
-    ((#x1F4E2)                                                    "loudspeaker")
-    ((#x1F4E3)                                                    "megaphone")
-    ((#x1F4EF)                                                    "postal horn")
-    ((#x1F514)                                                    "bell")
-    ((#x1F515)                                                    "bell with slash")
-    ((#x1F3BC)                                                    "musical score")
-    ((#x1F3B5)                                                    "musical note")
-    ((#x1F3B6)                                                    "musical notes")
-    ((#x1F399 #xFE0F)                                               "studio microphone")
-    ((#x1F39A #xFE0F)                                               "level slider")
-    ((#x1F39B #xFE0F)                                               "control knobs")
-    ((#x1F3A4)                                                    "microphone")
-    ((#x1F3A7)                                                    "headphone")
-    ((#x1F4FB)                                                    "radio")
-    ((#x1F3B7)                                                    "saxophone")
-    ((#x1F3BA)                                                    "trumpet")
-    ((#x1FA8A)                                                    "trombone")
-    ((#x1FA97)                                                    "accordion")
-    ((#x1F3B8)                                                    "guitar")
-    ((#x1F3B9)                                                    "musical keyboard")
-    ((#x1F3BB)                                                    "violin")
-    ((#x1FA95)                                                    "banjo")
-    ((#x1F941)                                                    "drum")
-    ((#x1FA98)                                                    "long drum")
-    ((#x1FA87)                                                    "maracas")
-    ((#x1FA88)                                                    "flute")
-    ((#x1FA89)                                                    "harp")
-    ((#x1F4F1)                                                    "mobile phone")
-    ((#x1F4F2)                                                    "mobile phone with arrow")
-    ((#x260E #xFE0F)                                                "telephone")
-    ((#x1F4DE)                                                    "telephone receiver")
-    ((#x1F4DF)                                                    "pager")
-    ((#x1F4E0)                                                    "fax machine")
-    ((#x1F50B)                                                    "battery")
-    ((#x1FAAB)                                                    "low battery")
-    ((#x1F50C)                                                    "electric plug")
-    ((#x1F4BB)                                                    "laptop")
-    ((#x1F5A5 #xFE0F)                                               "desktop computer")
-    ((#x1F5A8 #xFE0F)                                               "printer")
-    ((#x2328 #xFE0F)                                                "keyboard")
-    ((#x1F5B1 #xFE0F)                                               "computer mouse")
-    ((#x1F5B2 #xFE0F)                                               "trackball")
-    ((#x1F4BD)                                                    "computer disk")
-    ((#x1F4BE)                                                    "floppy disk")
-    ((#x1F4BF)                                                    "optical disk")
-    ((#x1F4C0)                                                    "dvd")
-    ((#x1F9EE)                                                    "abacus")
-    ((#x1F3A5)                                                    "movie camera")
-    ((#x1F39E #xFE0F)                                               "film frames")
-    ((#x1F4FD #xFE0F)                                               "film projector")
-    ((#x1F3AC)                                                    "clapper board")
-    ((#x1F4FA)                                                    "television")
-    ((#x1F4F7)                                                    "camera")
-    ((#x1F4F8)                                                    "camera with flash")
-    ((#x1F4F9)                                                    "video camera")
-    ((#x1F4FC)                                                    "videocassette")
-    ((#x1F50D)                                                    "magnifying glass tilted left")
-    ((#x1F50E)                                                    "magnifying glass tilted right")
-    ((#x1F56F #xFE0F)                                               "candle")
-    ((#x1F4A1)                                                    "light bulb")
-    ((#x1F526)                                                    "flashlight")
-    ((#x1F3EE)                                                    "red paper lantern")
-    ((#x1FA94)                                                    "diya lamp")
-    ((#x1F4D4)                                                    "notebook with decorative cover")
-    ((#x1F4D5)                                                    "closed book")
-    ((#x1F4D6)                                                    "open book")
-    ((#x1F4D7)                                                    "green book")
-    ((#x1F4D8)                                                    "blue book")
-    ((#x1F4D9)                                                    "orange book")
-    ((#x1F4DA)                                                    "books")
-    ((#x1F4D3)                                                    "notebook")
-    ((#x1F4D2)                                                    "ledger")
-    ((#x1F4C3)                                                    "page with curl")
-    ((#x1F4DC)                                                    "scroll")
-    ((#x1F4C4)                                                    "page facing up")
-    ((#x1F4F0)                                                    "newspaper")
-    ((#x1F5DE #xFE0F)                                               "rolled-up newspaper")
-    ((#x1F4D1)                                                    "bookmark tabs")
-    ((#x1F516)                                                    "bookmark")
-    ((#x1F3F7 #xFE0F)                                               "label")
-    ((#x1FA99)                                                    "coin")
-    ((#x1F4B0)                                                    "money bag")
-    ((#x1FA8E)                                                    "treasure chest")
-    ((#x1F4B4)                                                    "yen banknote")
-    ((#x1F4B5)                                                    "dollar banknote")
-    ((#x1F4B6)                                                    "euro banknote")
-    ((#x1F4B7)                                                    "pound banknote")
-    ((#x1F4B8)                                                    "money with wings")
-    ((#x1F4B3)                                                    "credit card")
-    ((#x1F9FE)                                                    "receipt")
-    ((#x1F4B9)                                                    "chart increasing with yen")
-    ((#x2709 #xFE0F)                                                "envelope")
-    ((#x1F4E7)                                                    "e-mail")
-    ((#x1F4E8)                                                    "incoming envelope")
-    ((#x1F4E9)                                                    "envelope with arrow")
-    ((#x1F4E4)                                                    "outbox tray")
-    ((#x1F4E5)                                                    "inbox tray")
-    ((#x1F4E6)                                                    "package")
-    ((#x1F4EB)                                                    "closed mailbox with raised flag")
-    ((#x1F4EA)                                                    "closed mailbox with lowered flag")
-    ((#x1F4EC)                                                    "open mailbox with raised flag")
-    ((#x1F4ED)                                                    "open mailbox with lowered flag")
-    ((#x1F4EE)                                                    "postbox")
-    ((#x1F5F3 #xFE0F)                                               "ballot box with ballot")
-    ((#x270F #xFE0F)                                                "pencil")
-    ((#x2712 #xFE0F)                                                "black nib")
-    ((#x1F58B #xFE0F)                                               "fountain pen")
-    ((#x1F58A #xFE0F)                                               "pen")
-    ((#x1F58C #xFE0F)                                               "paintbrush")
-    ((#x1F58D #xFE0F)                                               "crayon")
-    ((#x1F4DD)                                                    "memo")
-    ((#x1F4BC)                                                    "briefcase")
-    ((#x1F4C1)                                                    "file folder")
-    ((#x1F4C2)                                                    "open file folder")
-    ((#x1F5C2 #xFE0F)                                               "card index dividers")
-    ((#x1F4C5)                                                    "calendar")
-    ((#x1F4C6)                                                    "tear-off calendar")
-    ((#x1F5D2 #xFE0F)                                               "spiral notepad")
-    ((#x1F5D3 #xFE0F)                                               "spiral calendar")
-    ((#x1F4C7)                                                    "card index")
-    ((#x1F4C8)                                                    "chart increasing")
-    ((#x1F4C9)                                                    "chart decreasing")
-    ((#x1F4CA)                                                    "bar chart")
-    ((#x1F4CB)                                                    "clipboard")
-    ((#x1F4CC)                                                    "pushpin")
-    ((#x1F4CD)                                                    "round pushpin")
-    ((#x1F4CE)                                                    "paperclip")
-    ((#x1F587 #xFE0F)                                               "linked paperclips")
-    ((#x1F4CF)                                                    "straight ruler")
-    ((#x1F4D0)                                                    "triangular ruler")
-    ((#x2702 #xFE0F)                                                "scissors")
-    ((#x1F5C3 #xFE0F)                                               "card file box")
-    ((#x1F5C4 #xFE0F)                                               "file cabinet")
-    ((#x1F5D1 #xFE0F)                                               "wastebasket")
-    ((#x1F512)                                                    "locked")
-    ((#x1F513)                                                    "unlocked")
-    ((#x1F50F)                                                    "locked with pen")
-    ((#x1F510)                                                    "locked with key")
-    ((#x1F511)                                                    "key")
-    ((#x1F5DD #xFE0F)                                               "old key")
-    ((#x1F528)                                                    "hammer")
-    ((#x1FA93)                                                    "axe")
-    ((#x26CF #xFE0F)                                                "pick")
-    ((#x2692 #xFE0F)                                                "hammer and pick")
-    ((#x1F6E0 #xFE0F)                                               "hammer and wrench")
-    ((#x1F5E1 #xFE0F)                                               "dagger")
-    ((#x2694 #xFE0F)                                                "crossed swords")
-    ((#x1F4A3)                                                    "bomb")
-    ((#x1FA83)                                                    "boomerang")
-    ((#x1F3F9)                                                    "bow and arrow")
-    ((#x1F6E1 #xFE0F)                                               "shield")
-    ((#x1FA9A)                                                    "carpentry saw")
-    ((#x1F527)                                                    "wrench")
-    ((#x1FA9B)                                                    "screwdriver")
-    ((#x1F529)                                                    "nut and bolt")
-    ((#x2699 #xFE0F)                                                "gear")
-    ((#x1F5DC #xFE0F)                                               "clamp")
-    ((#x2696 #xFE0F)                                                "balance scale")
-    ((#x1F9AF)                                                    "white cane")
-    ((#x1F517)                                                    "link")
-    ((#x26D3 #xFE0F #x200D #x1F4A5)                                     "broken chain")
-    ((#x26D3 #xFE0F)                                                "chains")
-    ((#x1FA9D)                                                    "hook")
-    ((#x1F9F0)                                                    "toolbox")
-    ((#x1F9F2)                                                    "magnet")
-    ((#x1FA9C)                                                    "ladder")
-    ((#x1FA8F)                                                    "shovel")
-    ((#x2697 #xFE0F)                                                "alembic")
-    ((#x1F9EA)                                                    "test tube")
-    ((#x1F9EB)                                                    "petri dish")
-    ((#x1F9EC)                                                    "dna")
-    ((#x1F52C)                                                    "microscope")
-    ((#x1F52D)                                                    "telescope")
-    ((#x1F4E1)                                                    "satellite antenna")
-    ((#x1F489)                                                    "syringe")
-    ((#x1FA78)                                                    "drop of blood")
-    ((#x1F48A)                                                    "pill")
-    ((#x1FA79)                                                    "adhesive bandage")
-    ((#x1FA7C)                                                    "crutch")
-    ((#x1FA7A)                                                    "stethoscope")
-    ((#x1FA7B)                                                    "x-ray")
-    ((#x1F6AA)                                                    "door")
-    ((#x1F6D7)                                                    "elevator")
-    ((#x1FA9E)                                                    "mirror")
-    ((#x1FA9F)                                                    "window")
-    ((#x1F6CF #xFE0F)                                               "bed")
-    ((#x1F6CB #xFE0F)                                               "couch and lamp")
-    ((#x1FA91)                                                    "chair")
-    ((#x1F6BD)                                                    "toilet")
-    ((#x1FAA0)                                                    "plunger")
-    ((#x1F6BF)                                                    "shower")
-    ((#x1F6C1)                                                    "bathtub")
-    ((#x1FAA4)                                                    "mouse trap")
-    ((#x1FA92)                                                    "razor")
-    ((#x1F9F4)                                                    "lotion bottle")
-    ((#x1F9F7)                                                    "safety pin")
-    ((#x1F9F9)                                                    "broom")
-    ((#x1F9FA)                                                    "basket")
-    ((#x1F9FB)                                                    "roll of paper")
-    ((#x1FAA3)                                                    "bucket")
-    ((#x1F9FC)                                                    "soap")
-    ((#x1FAE7)                                                    "bubbles")
-    ((#x1FAA5)                                                    "toothbrush")
-    ((#x1F9FD)                                                    "sponge")
-    ((#x1F9EF)                                                    "fire extinguisher")
-    ((#x1F6D2)                                                    "shopping cart")
-    ((#x1F6AC)                                                    "cigarette")
-    ((#x26B0 #xFE0F)                                                "coffin")
-    ((#x1FAA6)                                                    "headstone")
-    ((#x26B1 #xFE0F)                                                "funeral urn")
-    ((#x1F9FF)                                                    "nazar amulet")
-    ((#x1FAAC)                                                    "hamsa")
-    ((#x1F5FF)                                                    "moai")
-    ((#x1FAA7)                                                    "placard")
-    ((#x1FAAA)                                                    "identification card")
-    ((#x1F3E7)                                                    "ATM sign")
-    ((#x1F6AE)                                                    "litter in bin sign")
-    ((#x1F6B0)                                                    "potable water")
-    ((#x267F)                                                     "wheelchair symbol")
-    ((#x1F6B9)                                                    "men’s room")
-    ((#x1F6BA)                                                    "women’s room")
-    ((#x1F6BB)                                                    "restroom")
-    ((#x1F6BC)                                                    "baby symbol")
-    ((#x1F6BE)                                                    "water closet")
-    ((#x1F6C2)                                                    "passport control")
-    ((#x1F6C3)                                                    "customs")
-    ((#x1F6C4)                                                    "baggage claim")
-    ((#x1F6C5)                                                    "left luggage")
-    ((#x26A0 #xFE0F)                                                "warning")
-    ((#x1F6B8)                                                    "children crossing")
-    ((#x26D4)                                                     "no entry")
-    ((#x1F6AB)                                                    "prohibited")
-    ((#x1F6B3)                                                    "no bicycles")
-    ((#x1F6AD)                                                    "no smoking")
-    ((#x1F6AF)                                                    "no littering")
-    ((#x1F6B1)                                                    "non-potable water")
-    ((#x1F6B7)                                                    "no pedestrians")
-    (( #x1F4F5)                                                    "no mobile phones")
-    ((#x1F51E)                                                    "no one under eighteen")
-    ((#x2622 #xFE0F)                                                "radioactive")
-    ((#x2623 #xFE0F)                                                "biohazard")
-    ((#x2B06 #xFE0F)                                                "up arrow")
-    ((#x2197 #xFE0F)                                                "up-right arrow")
-    ((#x27A1 #xFE0F)                                                "right arrow")
-    ((#x2198 #xFE0F)                                                "down-right arrow")
-    ((#x2B07 #xFE0F)                                                "down arrow")
-    ((#x2199 #xFE0F)                                                "down-left arrow")
-    ((#x2B05 #xFE0F)                                                "left arrow")
-    ((#x2196 #xFE0F)                                                "up-left arrow")
-    ((#x2195 #xFE0F)                                                "up-down arrow")
-    ((#x2194 #xFE0F)                                                "left-right arrow")
-    ((#x21A9 #xFE0F)                                                "right arrow curving left")
-    ((#x21AA #xFE0F)                                                "left arrow curving right")
-    ((#x2934 #xFE0F)                                                "right arrow curving up")
-    ((#x2935 #xFE0F)                                                "right arrow curving down")
-    ((#x1F503)                                                    "clockwise vertical arrows")
-    ((#x1F504)                                                    "counterclockwise arrows button")
-    ((#x1F519)                                                    "BACK arrow")
-    ((#x1F51A)                                                    "END arrow")
-    ((#x1F51B)                                                    "ON! arrow")
-    ((#x1F51C)                                                    "SOON arrow")
-    ((#x1F51D)                                                    "TOP arrow")
-    ((#x1F6D0)                                                    "place of worship")
-    ((#x269B #xFE0F)                                                "atom symbol")
-    ((#x1F549 #xFE0F)                                               "om")
-    ((#x2721 #xFE0F)                                                "star of David")
-    ((#x2638 #xFE0F)                                                "wheel of dharma")
-    ((#x262F #xFE0F)                                                "yin yang")
-    ((#x271D #xFE0F)                                                "latin cross")
-    ((#x2626 #xFE0F)                                                "orthodox cross")
-    ((#x262A #xFE0F)                                                "star and crescent")
-    ((#x262E #xFE0F)                                                "peace symbol")
-    ((#x1F54E)                                                    "menorah")
-    ((#x1F52F)                                                    "dotted six-pointed star")
-    ((#x1FAAF)                                                    "khanda")
-    ((#x2648)                                                     "Aries")
-    ((#x2649)                                                     "Taurus")
-    ((#x264A)                                                     "Gemini")
-    ((#x264B)                                                     "Cancer")
-    ((#x264C)                                                     "Leo")
-    ((#x264D)                                                     "Virgo")
-    ((#x264E)                                                     "Libra")
-    ((#x264F)                                                     "Scorpio")
-    ((#x2650)                                                     "Sagittarius")
-    ((#x2651)                                                     "Capricorn")
-    ((#x2652)                                                     "Aquarius")
-    ((#x2653)                                                     "Pisces")
-    ((#x26CE)                                                     "Ophiuchus")
-    ((#x1F500)                                                    "shuffle tracks button")
-    ((#x1F501)                                                    "repeat button")
-    ((#x1F502)                                                    "repeat single button")
-    ((#x25B6 #xFE0F)                                                "play button")
-    ((#x23E9)                                                     "fast-forward button")
-    ((#x23ED #xFE0F)                                                "next track button")
-    ((#x23EF #xFE0F)                                                "play or pause button")
-    ((#x25C0 #xFE0F)                                                "reverse button")
-    ((#x23EA)                                                     "fast reverse button")
-    ((#x23EE #xFE0F)                                                "last track button")
-    ((#x1F53C)                                                    "upwards button")
-    ((#x23EB)                                                     "fast up button")
-    ((#x1F53D)                                                    "downwards button")
-    ((#x23EC)                                                     "fast down button")
-    ((#x23F8 #xFE0F)                                                "pause button")
-    ((#x23F9 #xFE0F)                                                "stop button")
-    ((#x23FA #xFE0F)                                                "record button")
-    ((#x23CF #xFE0F)                                                "eject button")
-    ((#x1F3A6)                                                    "cinema")
-    ((#x1F505)                                                    "dim button")
-    ((#x1F506)                                                    "bright button")
-    ((#x1F4F6)                                                    "antenna bars")
-    ((#x1F6DC)                                                    "wireless")
-    ((#x1F4F3)                                                    "vibration mode")
-    ((#x1F4F4)                                                    "mobile phone off")
-    ((#x2640 #xFE0F)                                                "female sign")
-    ((#x2642 #xFE0F)                                                "male sign")
-    ((#x26A7 #xFE0F)                                                "transgender symbol")
-    ((#x2716 #xFE0F)                                                "multiply")
-    ((#x2795)                                                     "plus")
-    ((#x2796)                                                     "minus")
-    ((#x2797)                                                     "divide")
-    ((#x1F7F0)                                                    "heavy equals sign")
-    ((#x267E #xFE0F)                                                "infinity")
-    ((#x203C #xFE0F)                                                "double exclamation mark")
-    ((#x2049 #xFE0F)                                                "exclamation question mark")
-    ((#x2753)                                                     "red question mark")
-    ((#x2754)                                                     "white question mark")
-    ((#x2755)                                                     "white exclamation mark")
-    ((#x2757)                                                     "red exclamation mark")
-    ((#x3030 #xFE0F)                                                "wavy dash")
-    ((#x1F4B1)                                                    "currency exchange")
-    ((#x1F4B2)                                                    "heavy dollar sign")
-    ((#x2695 #xFE0F)                                                "medical symbol")
-    ((#x267B #xFE0F)                                                "recycling symbol")
-    ((#x269C #xFE0F)                                                "fleur-de-lis")
-    ((#x1F531)                                                    "trident emblem")
-    ((#x1F4DB)                                                    "name badge")
-    ((#x1F530)                                                    "Japanese symbol for beginner")
-    ((#x2B55)                                                     "hollow red circle")
-    ((#x2705)                                                     "check mark button")
-    ((#x2611 #xFE0F)                                                "check box with check")
-    ((#x2714 #xFE0F)                                                "check mark")
-    ((#x274C)                                                     "cross mark")
-    ((#x274E)                                                     "cross mark button")
-    ((#x27B0)                                                     "curly loop")
-    ((#x27BF)                                                     "double curly loop")
-    ((#x303D #xFE0F)                                                "part alternation mark")
-    ((#x2733 #xFE0F)                                                "eight-spoked asterisk")
-    ((#x2734 #xFE0F)                                                "eight-pointed star")
-    ((#x2747 #xFE0F)                                                "sparkle")
-    ((#x00A9 #xFE0F)                                                "copyright")
-    ((#x00AE #xFE0F)                                                "registered")
-    ((#x2122 #xFE0F)                                                "trade mark")
-    ((#x1FADF)                                                    "splatter")
-    ((#x0023 #xFE0F #x20E3)                                           "keycap: #")
-    ((#x002A #xFE0F #x20E3)                                           "keycap: *")
-    ((#x0030 #xFE0F #x20E3)                                           "keycap: 0")
-    ((#x0031 #xFE0F #x20E3)                                           "keycap: 1")
-    ((#x0032 #xFE0F #x20E3)                                           "keycap: 2")
-    ((#x0033 #xFE0F #x20E3)                                           "keycap: 3")
-    ((#x0034 #xFE0F #x20E3)                                           "keycap: 4")
-    ((#x0035 #xFE0F #x20E3)                                           "keycap: 5")
-    ((#x0036 #xFE0F #x20E3)                                           "keycap: 6")
-    ((#x0037 #xFE0F #x20E3)                                           "keycap: 7")
-    ((#x0038 #xFE0F #x20E3)                                           "keycap: 8")
-    ((#x0039 #xFE0F #x20E3)                                           "keycap: 9")
-    ((#x1F51F)                                                    "keycap: 10")
-    ((#x1F520)                                                    "input latin uppercase")
-    ((#x1F521)                                                    "input latin lowercase")
-    ((#x1F522)                                                    "input numbers")
-    ((#x1F523)                                                    "input symbols")
-    ((#x1F524)                                                    "input latin letters")
-    ((#x1F170 #xFE0F)                                               "A button (blood type)")
-    ((#x1F18E)                                                    "AB button (blood type)")
-    ((#x1F171 #xFE0F)                                               "B button (blood type)")
-    ((#x1F191)                                                    "CL button")
-    ((#x1F192)                                                    "COOL button")
-    ((#x1F193)                                                    "FREE button")
-    ((#x2139 #xFE0F)                                                "information")
-    ((#x1F194)                                                    "ID button")
-    ((#x24C2 #xFE0F)                                                "circled M")
-    ((#x1F195)                                                    "NEW button")
-    ((#x1F196)                                                    "NG button")
-    ((#x1F17E #xFE0F)                                               "O button (blood type)")
-    ((#x1F197)                                                    "OK button")
-    ((#x1F17F #xFE0F)                                               "P button")
-    ((#x1F198)                                                    "SOS button")
-    ((#x1F199)                                                    "UP! button")
-    ((#x1F19A)                                                    "VS button")
-    ((#x1F201)                                                    "Japanese “here” button")
-    ((#x1F202 #xFE0F)                                               "Japanese “service charge” button")
-    ((#x1F237 #xFE0F)                                               "Japanese “monthly amount” button")
-    ((#x1F236)                                                    "Japanese “not free of charge” button")
-    ((#x1F22F)                                                    "Japanese “reserved” button")
-    ((#x1F250)                                                    "Japanese “bargain” button")
-    ((#x1F239)                                                    "Japanese “discount” button")
-    ((#x1F21A)                                                    "Japanese “free of charge” button")
-    ((#x1F232)                                                    "Japanese “prohibited” button")
-    ((#x1F251)                                                    "Japanese “acceptable” button")
-    ((#x1F238)                                                    "Japanese “application” button")
-    ((#x1F234)                                                    "Japanese “passing grade” button")
-    ((#x1F233)                                                    "Japanese “vacancy” button")
-    ((#x3297 #xFE0F)                                                "Japanese “congratulations” button")
-    ((#x3299 #xFE0F)                                                "Japanese “secret” button")
-    ((#x1F23A)                                                    "Japanese “open for business” button")
-    ((#x1F235)                                                    "Japanese “no vacancy” button")
-    ((#x1F534)                                                    "red circle")
-    ((#x1F7E0)                                                    "orange circle")
-    ((#x1F7E1)                                                    "yellow circle")
-    ((#x1F7E2)                                                    "green circle")
-    ((#x1F535)                                                    "blue circle")
-    ((#x1F7E3)                                                    "purple circle")
-    ((#x1F7E4)                                                    "brown circle")
-    ((#x26AB)                                                     "black circle")
-    ((#x26AA)                                                     "white circle")
-    ((#x1F7E5)                                                    "red square")
-    ((#x1F7E7)                                                    "orange square")
-    ((#x1F7E8)                                                    "yellow square")
-    ((#x1F7E9)                                                    "green square")
-    ((#x1F7E6)                                                    "blue square")
-    ((#x1F7EA)                                                    "purple square")
-    ((#x1F7EB)                                                    "brown square")
-    ((#x2B1B)                                                     "black large square")
-    ((#x2B1C)                                                     "white large square")
-    ((#x25FC #xFE0F)                                                "black medium square")
-    ((#x25FB #xFE0F)                                                "white medium square")
-    ((#x25FE)                                                     "black medium-small square")
-    ((#x25FD)                                                     "white medium-small square")
-    ((#x25AA #xFE0F)                                                "black small square")
-    ((#x25AB #xFE0F)                                                "white small square")
-    ((#x1F536)                                                    "large orange diamond")
-    ((#x1F537)                                                    "large blue diamond")
-    ((#x1F538)                                                    "small orange diamond")
-    ((#x1F539)                                                    "small blue diamond")
-    ((#x1F53A)                                                    "red triangle pointed up")
-    ((#x1F53B)                                                    "red triangle pointed down")
-    ((#x1F4A0)                                                    "diamond with a dot")
-    ((#x1F518)                                                    "radio button")
-    ((#x1F533)                                                    "white square button")
-    ((#x1F532)                                                    "black square button")
-    ((#x1F3C1)                                                    "chequered flag")
-    ((#x1F6A9)                                                    "triangular flag")
-    ((#x1F38C)                                                    "crossed flags")
-    ((#x1F3F4)                                                    "black flag")
-    ((#x1F3F3 #xFE0F)                                               "white flag")
-    ((#x1F3F3 #xFE0F #x200D #x1F308)                                    "rainbow flag")
-    ((#x1F3F3 #xFE0F #x200D #x26A7 #xFE0F)                                "transgender flag")
-    ((#x1F3F4 #x200D #x2620 #xFE0F)                                     "pirate flag")
-    ((#x1F1E6 #x1F1E8)                                              "flag: Ascension Island")
-    ((#x1F1E6 #x1F1E9)                                              "flag: Andorra")
-    ((#x1F1E6 #x1F1EA)                                              "flag: United Arab Emirates")
-    ((#x1F1E6 #x1F1EB)                                              "flag: Afghanistan")
-    ((#x1F1E6 #x1F1EC)                                              "flag: Antigua & Barbuda")
-    ((#x1F1E6 #x1F1EE)                                              "flag: Anguilla")
-    ((#x1F1E6 #x1F1F1)                                              "flag: Albania")
-    ((#x1F1E6 #x1F1F2)                                              "flag: Armenia")
-    ((#x1F1E6 #x1F1F4)                                              "flag: Angola")
-    ((#x1F1E6 #x1F1F6)                                              "flag: Antarctica")
-    ((#x1F1E6 #x1F1F7)                                              "flag: Argentina")
-    ((#x1F1E6 #x1F1F8)                                              "flag: American Samoa")
-    ((#x1F1E6 #x1F1F9)                                              "flag: Austria")
-    ((#x1F1E6 #x1F1FA)                                              "flag: Australia")
-    ((#x1F1E6 #x1F1FC)                                              "flag: Aruba")
-    ((#x1F1E6 #x1F1FD)                                              "flag: Åland Islands")
-    ((#x1F1E6 #x1F1FF)                                              "flag: Azerbaijan")
-    ((#x1F1E7 #x1F1E6)                                              "flag: Bosnia & Herzegovina")
-    ((#x1F1E7 #x1F1E7)                                              "flag: Barbados")
-    ((#x1F1E7 #x1F1E9)                                              "flag: Bangladesh")
-    ((#x1F1E7 #x1F1EA)                                              "flag: Belgium")
-    ((#x1F1E7 #x1F1EB)                                              "flag: Burkina Faso")
-    ((#x1F1E7 #x1F1EC)                                              "flag: Bulgaria")
-    ((#x1F1E7 #x1F1ED)                                              "flag: Bahrain")
-    ((#x1F1E7 #x1F1EE)                                              "flag: Burundi")
-    ((#x1F1E7 #x1F1EF)                                              "flag: Benin")
-    ((#x1F1E7 #x1F1F1)                                              "flag: St. Barthélemy")
-    ((#x1F1E7 #x1F1F2)                                              "flag: Bermuda")
-    ((#x1F1E7 #x1F1F3)                                              "flag: Brunei")
-    ((#x1F1E7 #x1F1F4)                                              "flag: Bolivia")
-    ((#x1F1E7 #x1F1F6)                                              "flag: Caribbean Netherlands")
-    ((#x1F1E7 #x1F1F7)                                              "flag: Brazil")
-    ((#x1F1E7 #x1F1F8)                                              "flag: Bahamas")
-    ((#x1F1E7 #x1F1F9)                                              "flag: Bhutan")
-    ((#x1F1E7 #x1F1FB)                                              "flag: Bouvet Island")
-    ((#x1F1E7 #x1F1FC)                                              "flag: Botswana")
-    ((#x1F1E7 #x1F1FE)                                              "flag: Belarus")
-    ((#x1F1E7 #x1F1FF)                                              "flag: Belize")
-    ((#x1F1E8 #x1F1E6)                                              "flag: Canada")
-    ((#x1F1E8 #x1F1E8)                                              "flag: Cocos (Keeling) Islands")
-    ((#x1F1E8 #x1F1E9)                                              "flag: Congo - Kinshasa")
-    ((#x1F1E8 #x1F1EB)                                              "flag: Central African Republic")
-    ((#x1F1E8 #x1F1EC)                                              "flag: Congo - Brazzaville")
-    ((#x1F1E8 #x1F1ED)                                              "flag: Switzerland")
-    ((#x1F1E8 #x1F1EE)                                              "flag: Côte d’Ivoire")
-    ((#x1F1E8 #x1F1F0)                                              "flag: Cook Islands")
-    ((#x1F1E8 #x1F1F1)                                              "flag: Chile")
-    ((#x1F1E8 #x1F1F2)                                              "flag: Cameroon")
-    ((#x1F1E8 #x1F1F3)                                              "flag: China")
-    ((#x1F1E8 #x1F1F4)                                              "flag: Colombia")
-    ((#x1F1E8 #x1F1F5)                                              "flag: Clipperton Island")
-    ((#x1F1E8 #x1F1F6)                                              "flag: Sark")
-    ((#x1F1E8 #x1F1F7)                                              "flag: Costa Rica")
-    ((#x1F1E8 #x1F1FA)                                              "flag: Cuba")
-    ((#x1F1E8 #x1F1FB)                                              "flag: Cape Verde")
-    ((#x1F1E8 #x1F1FC)                                              "flag: Curaçao")
-    ((#x1F1E8 #x1F1FD)                                              "flag: Christmas Island")
-    ((#x1F1E8 #x1F1FE)                                              "flag: Cyprus")
-    ((#x1F1E8 #x1F1FF)                                              "flag: Czechia")
-    ((#x1F1E9 #x1F1EA)                                              "flag: Germany")
-    ((#x1F1E9 #x1F1EC)                                              "flag: Diego Garcia")
-    ((#x1F1E9 #x1F1EF)                                              "flag: Djibouti")
-    ((#x1F1E9 #x1F1F0)                                              "flag: Denmark")
-    ((#x1F1E9 #x1F1F2)                                              "flag: Dominica")
-    ((#x1F1E9 #x1F1F4)                                              "flag: Dominican Republic")
-    ((#x1F1E9 #x1F1FF)                                              "flag: Algeria")
-    ((#x1F1EA #x1F1E6)                                              "flag: Ceuta & Melilla")
-    ((#x1F1EA #x1F1E8)                                              "flag: Ecuador")
-    ((#x1F1EA #x1F1EA)                                              "flag: Estonia")
-    ((#x1F1EA #x1F1EC)                                              "flag: Egypt")
-    ((#x1F1EA #x1F1ED)                                              "flag: Western Sahara")
-    ((#x1F1EA #x1F1F7)                                              "flag: Eritrea")
-    ((#x1F1EA #x1F1F8)                                              "flag: Spain")
-    ((#x1F1EA #x1F1F9)                                              "flag: Ethiopia")
-    ((#x1F1EA #x1F1FA)                                              "flag: European Union")
-    ((#x1F1EB #x1F1EE)                                              "flag: Finland")
-    ((#x1F1EB #x1F1EF)                                              "flag: Fiji")
-    ((#x1F1EB #x1F1F0)                                              "flag: Falkland Islands")
-    ((#x1F1EB #x1F1F2)                                              "flag: Micronesia")
-    ((#x1F1EB #x1F1F4)                                              "flag: Faroe Islands")
-    ((#x1F1EB #x1F1F7)                                              "flag: France")
-    ((#x1F1EC #x1F1E6)                                              "flag: Gabon")
-    ((#x1F1EC #x1F1E7)                                              "flag: United Kingdom")
-    ((#x1F1EC #x1F1E9)                                              "flag: Grenada")
-    ((#x1F1EC #x1F1EA)                                              "flag: Georgia")
-    ((#x1F1EC #x1F1EB)                                              "flag: French Guiana")
-    ((#x1F1EC #x1F1EC)                                              "flag: Guernsey")
-    ((#x1F1EC #x1F1ED)                                              "flag: Ghana")
-    ((#x1F1EC #x1F1EE)                                              "flag: Gibraltar")
-    ((#x1F1EC #x1F1F1)                                              "flag: Greenland")
-    ((#x1F1EC #x1F1F2)                                              "flag: Gambia")
-    ((#x1F1EC #x1F1F3)                                              "flag: Guinea")
-    ((#x1F1EC #x1F1F5)                                              "flag: Guadeloupe")
-    ((#x1F1EC #x1F1F6)                                              "flag: Equatorial Guinea")
-    ((#x1F1EC #x1F1F7)                                              "flag: Greece")
-    ((#x1F1EC #x1F1F8)                                              "flag: South Georgia & South Sandwich Islands")
-    ((#x1F1EC #x1F1F9)                                              "flag: Guatemala")
-    ((#x1F1EC #x1F1FA)                                              "flag: Guam")
-    ((#x1F1EC #x1F1FC)                                              "flag: Guinea-Bissau")
-    ((#x1F1EC #x1F1FE)                                              "flag: Guyana")
-    ((#x1F1ED #x1F1F0)                                              "flag: Hong Kong SAR China")
-    ((#x1F1ED #x1F1F2)                                              "flag: Heard & McDonald Islands")
-    ((#x1F1ED #x1F1F3)                                              "flag: Honduras")
-    ((#x1F1ED #x1F1F7)                                              "flag: Croatia")
-    ((#x1F1ED #x1F1F9)                                              "flag: Haiti")
-    ((#x1F1ED #x1F1FA)                                              "flag: Hungary")
-    ((#x1F1EE #x1F1E8)                                              "flag: Canary Islands")
-    ((#x1F1EE #x1F1E9)                                              "flag: Indonesia")
-    ((#x1F1EE #x1F1EA)                                              "flag: Ireland")
-    ((#x1F1EE #x1F1F1)                                              "flag: Israel")
-    ((#x1F1EE #x1F1F2)                                              "flag: Isle of Man")
-    ((#x1F1EE #x1F1F3)                                              "flag: India")
-    ((#x1F1EE #x1F1F4)                                              "flag: British Indian Ocean Territory")
-    ((#x1F1EE #x1F1F6)                                              "flag: Iraq")
-    ((#x1F1EE #x1F1F7)                                              "flag: Iran")
-    ((#x1F1EE #x1F1F8)                                              "flag: Iceland")
-    ((#x1F1EE #x1F1F9)                                              "flag: Italy")
-    ((#x1F1EF #x1F1EA)                                              "flag: Jersey")
-    ((#x1F1EF #x1F1F2)                                              "flag: Jamaica")
-    ((#x1F1EF #x1F1F4)                                              "flag: Jordan")
-    ((#x1F1EF #x1F1F5)                                              "flag: Japan")
-    ((#x1F1F0 #x1F1EA)                                              "flag: Kenya")
-    ((#x1F1F0 #x1F1EC)                                              "flag: Kyrgyzstan")
-    ((#x1F1F0 #x1F1ED)                                              "flag: Cambodia")
-    ((#x1F1F0 #x1F1EE)                                              "flag: Kiribati")
-    ((#x1F1F0 #x1F1F2)                                              "flag: Comoros")
-    ((#x1F1F0 #x1F1F3)                                              "flag: St. Kitts & Nevis")
-    ((#x1F1F0 #x1F1F5)                                              "flag: North Korea")
-    ((#x1F1F0 #x1F1F7)                                              "flag: South Korea")
-    ((#x1F1F0 #x1F1FC)                                              "flag: Kuwait")
-    ((#x1F1F0 #x1F1FE)                                              "flag: Cayman Islands")
-    ((#x1F1F0 #x1F1FF)                                              "flag: Kazakhstan")
-    ((#x1F1F1 #x1F1E6)                                              "flag: Laos")
-    ((#x1F1F1 #x1F1E7)                                              "flag: Lebanon")
-    ((#x1F1F1 #x1F1E8)                                              "flag: St. Lucia")
-    ((#x1F1F1 #x1F1EE)                                              "flag: Liechtenstein")
-    ((#x1F1F1 #x1F1F0)                                              "flag: Sri Lanka")
-    ((#x1F1F1 #x1F1F7)                                              "flag: Liberia")
-    ((#x1F1F1 #x1F1F8)                                              "flag: Lesotho")
-    ((#x1F1F1 #x1F1F9)                                              "flag: Lithuania")
-    ((#x1F1F1 #x1F1FA)                                              "flag: Luxembourg")
-    ((#x1F1F1 #x1F1FB)                                              "flag: Latvia")
-    ((#x1F1F1 #x1F1FE)                                              "flag: Libya")
-    ((#x1F1F2 #x1F1E6)                                              "flag: Morocco")
-    ((#x1F1F2 #x1F1E8)                                              "flag: Monaco")
-    ((#x1F1F2 #x1F1E9)                                              "flag: Moldova")
-    ((#x1F1F2 #x1F1EA)                                              "flag: Montenegro")
-    ((#x1F1F2 #x1F1EB)                                              "flag: St. Martin")
-    ((#x1F1F2 #x1F1EC)                                              "flag: Madagascar")
-    ((#x1F1F2 #x1F1ED)                                              "flag: Marshall Islands")
-    ((#x1F1F2 #x1F1F0)                                              "flag: North Macedonia")
-    ((#x1F1F2 #x1F1F1)                                              "flag: Mali")
-    ((#x1F1F2 #x1F1F2)                                              "flag: Myanmar (Burma)")
-    ((#x1F1F2 #x1F1F3)                                              "flag: Mongolia")
-    ((#x1F1F2 #x1F1F4)                                              "flag: Macao SAR China")
-    ((#x1F1F2 #x1F1F5)                                              "flag: Northern Mariana Islands")
-    ((#x1F1F2 #x1F1F6)                                              "flag: Martinique")
-    ((#x1F1F2 #x1F1F7)                                              "flag: Mauritania")
-    ((#x1F1F2 #x1F1F8)                                              "flag: Montserrat")
-    ((#x1F1F2 #x1F1F9)                                              "flag: Malta")
-    ((#x1F1F2 #x1F1FA)                                              "flag: Mauritius")
-    ((#x1F1F2 #x1F1FB)                                              "flag: Maldives")
-    ((#x1F1F2 #x1F1FC)                                              "flag: Malawi")
-    ((#x1F1F2 #x1F1FD)                                              "flag: Mexico")
-    ((#x1F1F2 #x1F1FE)                                              "flag: Malaysia")
-    ((#x1F1F2 #x1F1FF)                                              "flag: Mozambique")
-    ((#x1F1F3 #x1F1E6)                                              "flag: Namibia")
-    ((#x1F1F3 #x1F1E8)                                              "flag: New Caledonia")
-    ((#x1F1F3 #x1F1EA)                                              "flag: Niger")
-    ((#x1F1F3 #x1F1EB)                                              "flag: Norfolk Island")
-    ((#x1F1F3 #x1F1EC)                                              "flag: Nigeria")
-    ((#x1F1F3 #x1F1EE)                                              "flag: Nicaragua")
-    ((#x1F1F3 #x1F1F1)                                              "flag: Netherlands")
-    ((#x1F1F3 #x1F1F4)                                              "flag: Norway")
-    ((#x1F1F3 #x1F1F5)                                              "flag: Nepal")
-    ((#x1F1F3 #x1F1F7)                                              "flag: Nauru")
-    ((#x1F1F3 #x1F1FA)                                              "flag: Niue")
-    ((#x1F1F3 #x1F1FF)                                              "flag: New Zealand")
-    ((#x1F1F4 #x1F1F2)                                              "flag: Oman")
-    ((#x1F1F5 #x1F1E6)                                              "flag: Panama")
-    ((#x1F1F5 #x1F1EA)                                              "flag: Peru")
-    ((#x1F1F5 #x1F1EB)                                              "flag: French Polynesia")
-    ((#x1F1F5 #x1F1EC)                                              "flag: Papua New Guinea")
-    ((#x1F1F5 #x1F1ED)                                              "flag: Philippines")
-    ((#x1F1F5 #x1F1F0)                                              "flag: Pakistan")
-    ((#x1F1F5 #x1F1F1)                                              "flag: Poland")
-    ((#x1F1F5 #x1F1F2)                                              "flag: St. Pierre & Miquelon")
-    ((#x1F1F5 #x1F1F3)                                              "flag: Pitcairn Islands")
-    ((#x1F1F5 #x1F1F7)                                              "flag: Puerto Rico")
-    ((#x1F1F5 #x1F1F8)                                              "flag: Palestinian Territories")
-    ((#x1F1F5 #x1F1F9)                                              "flag: Portugal")
-    ((#x1F1F5 #x1F1FC)                                              "flag: Palau")
-    ((#x1F1F5 #x1F1FE)                                              "flag: Paraguay")
-    ((#x1F1F6 #x1F1E6)                                              "flag: Qatar")
-    ((#x1F1F7 #x1F1EA)                                              "flag: Réunion")
-    ((#x1F1F7 #x1F1F4)                                              "flag: Romania")
-    ((#x1F1F7 #x1F1F8)                                              "flag: Serbia")
-    ((#x1F1F7 #x1F1FA)                                              "flag: Russia")
-    ((#x1F1F7 #x1F1FC)                                              "flag: Rwanda")
-    ((#x1F1F8 #x1F1E6)                                              "flag: Saudi Arabia")
-    ((#x1F1F8 #x1F1E7)                                              "flag: Solomon Islands")
-    ((#x1F1F8 #x1F1E8)                                              "flag: Seychelles")
-    ((#x1F1F8 #x1F1E9)                                              "flag: Sudan")
-    ((#x1F1F8 #x1F1EA)                                              "flag: Sweden")
-    ((#x1F1F8 #x1F1EC)                                              "flag: Singapore")
-    ((#x1F1F8 #x1F1ED)                                              "flag: St. Helena")
-    ((#x1F1F8 #x1F1EE)                                              "flag: Slovenia")
-    ((#x1F1F8 #x1F1EF)                                              "flag: Svalbard & Jan Mayen")
-    ((#x1F1F8 #x1F1F0)                                              "flag: Slovakia")
-    ((#x1F1F8 #x1F1F1)                                              "flag: Sierra Leone")
-    ((#x1F1F8 #x1F1F2)                                              "flag: San Marino")
-    ((#x1F1F8 #x1F1F3)                                              "flag: Senegal")
-    ((#x1F1F8 #x1F1F4)                                              "flag: Somalia")
-    ((#x1F1F8 #x1F1F7)                                              "flag: Suriname")
-    ((#x1F1F8 #x1F1F8)                                              "flag: South Sudan")
-    ((#x1F1F8 #x1F1F9)                                              "flag: São Tomé & Príncipe")
-    ((#x1F1F8 #x1F1FB)                                              "flag: El Salvador")
-    ((#x1F1F8 #x1F1FD)                                              "flag: Sint Maarten")
-    ((#x1F1F8 #x1F1FE)                                              "flag: Syria")
-    ((#x1F1F8 #x1F1FF)                                              "flag: Eswatini")
-    ((#x1F1F9 #x1F1E6)                                              "flag: Tristan da Cunha")
-    ((#x1F1F9 #x1F1E8)                                              "flag: Turks & Caicos Islands")
-    ((#x1F1F9 #x1F1E9)                                              "flag: Chad")
-    ((#x1F1F9 #x1F1EB)                                              "flag: French Southern Territories")
-    ((#x1F1F9 #x1F1EC)                                              "flag: Togo")
-    ((#x1F1F9 #x1F1ED)                                              "flag: Thailand")
-    ((#x1F1F9 #x1F1EF)                                              "flag: Tajikistan")
-    ((#x1F1F9 #x1F1F0)                                              "flag: Tokelau")
-    ((#x1F1F9 #x1F1F1)                                              "flag: Timor-Leste")
-    ((#x1F1F9 #x1F1F2)                                              "flag: Turkmenistan")
-    ((#x1F1F9 #x1F1F3)                                              "flag: Tunisia")
-    ((#x1F1F9 #x1F1F4)                                              "flag: Tonga")
-    ((#x1F1F9 #x1F1F7)                                              "flag: Türkiye")
-    ((#x1F1F9 #x1F1F9)                                              "flag: Trinidad & Tobago")
-    ((#x1F1F9 #x1F1FB)                                              "flag: Tuvalu")
-    ((#x1F1F9 #x1F1FC)                                              "flag: Taiwan")
-    ((#x1F1F9 #x1F1FF)                                              "flag: Tanzania")
-    ((#x1F1FA #x1F1E6)                                              "flag: Ukraine")
-    ((#x1F1FA #x1F1EC)                                              "flag: Uganda")
-    ((#x1F1FA #x1F1F2)                                              "flag: U.S. Outlying Islands")
-    ((#x1F1FA #x1F1F3)                                              "flag: United Nations")
-    ((#x1F1FA #x1F1F8)                                              "flag: United States")
-    ((#x1F1FA #x1F1FE)                                              "flag: Uruguay")
-    ((#x1F1FA #x1F1FF)                                              "flag: Uzbekistan")
-    ((#x1F1FB #x1F1E6)                                              "flag: Vatican City")
-    ((#x1F1FB #x1F1E8)                                              "flag: St. Vincent & Grenadines")
-    ((#x1F1FB #x1F1EA)                                              "flag: Venezuela")
-    ((#x1F1FB #x1F1EC)                                              "flag: British Virgin Islands")
-    ((#x1F1FB #x1F1EE)                                              "flag: U.S. Virgin Islands")
-    ((#x1F1FB #x1F1F3)                                              "flag: Vietnam")
-    ((#x1F1FB #x1F1FA)                                              "flag: Vanuatu")
-    ((#x1F1FC #x1F1EB)                                              "flag: Wallis & Futuna")
-    ((#x1F1FC #x1F1F8)                                              "flag: Samoa")
-    ((#x1F1FD #x1F1F0)                                              "flag: Kosovo")
-    ((#x1F1FE #x1F1EA)                                              "flag: Yemen")
-    ((#x1F1FE #x1F1F9)                                              "flag: Mayotte")
-    ((#x1F1FF #x1F1E6)                                              "flag: South Africa")
-    ((#x1F1FF #x1F1F2)                                              "flag: Zambia")
-    ((#x1F1FF #x1F1FC)                                              "flag: Zimbabwe")
-    ((#x1F3F4 #xE0067 #xE0062 #xE0065 #xE006E #xE0067 #xE007F)                "flag: England")
-    ((#x1F3F4 #xE0067 #xE0062 #xE0073 #xE0063 #xE0074 #xE007F)                "flag: Scotland")
-    ((#x1F3F4 #xE0067 #xE0062 #xE0077 #xE006C #xE0073 #xE007F)                "flag: Wales")
-    )
-  )
-
-(defstruct emoji-names
-  full
-  split)
-
-(defvar emojis-map (make-hash-table :test #'equal))
-(mapcar (lambda (x)
-          (destructuring-bind (hexs names) x
-            (setf (gethash hexs emojis-map)
-                  (make-emoji-names :full names
-                                    :split (saturn:extract-tokens names)))))
-        emojis)
-
 (gobject:define-gobject-subclass
     "SaturnEmojiResult"
     emoji-result
@@ -4071,24 +109,14 @@
     (when (not (= *timeout-source* 0))
       (g:source-remove *timeout-source*)
       (setf *timeout-source* 0))
-    (let* ((str (gtk:string-object-string object))
-           (tokens (saturn:extract-tokens str)))
+    (let ((str (gtk:string-object-string object)))
       (unless (>= (length str) *min-query-length*)
         (return-from query))
       (labels ((thread ()
-                 (let ((tokens (split-sequence:split-sequence #\  str :remove-empty-subseqs t)))
-                   (loop for emoji being the hash-keys of emojis-map
-                         for names being the hash-values of emojis-map
-                         for full = (emoji-names-full names)
-                         for split = (emoji-names-split names)
-                         when (saturn:match-str-tokens tokens split)
-                           do (unless (saturn:submit-result
-                                       (make-instance
-                                        'emoji-result
-                                        :obj0 (gtk:string-object-new (code-seq-to-string emoji))
-                                        :obj1 (gtk:string-object-new full))
-                                       store provider)
-                                (return-from thread)))))
+                 ;; the emoji table is compiled in along with a sorted
+                 ;; index of the words in every name (see saturn-emoji.c),
+                 ;; obj0 being the glyph and obj1 its name
+                 (saturn:emoji-query str store provider "SaturnEmojiResult"))
                (idle-timeout ()
                  (setf *timeout-source* 0)
                  (bordeaux-threads:make-thread #'thread)
@@ -105,48 +105,19 @@
     (let* ((str (gtk:string-object-string object)))
       (unless (>= (length str) *min-query-length*)
         (return-from query))
-      (labels ((run-cmd ()
-                 (ignore-errors
-                  (with-input-from-string (s str)
-                    (uiop:run-program '("enchant-2" "-a")
-                                      ;; passing str as stdin
-                                      :input s
-                                      :output :string))))
-               (output-line-to-suggestions (line)
-                 (let ((colon-idx (search ":" line)))
-                   (unless colon-idx
-                     (return-from output-line-to-suggestions))
-                   (split-sequence:split-sequence-if
-                    (let ((split-next nil))
-                      (lambda (ch)
-                        (cond
-                          ((eql ch #\,) (setf split-next t))
-                          (split-next (progn (setf split-next nil) t)))))
-                    (subseq line (+ 2 colon-idx))
-                    :remove-empty-subseqs t)))
+      (labels ((thread ()
+                 ;; a single enchant-2 session is kept running in the
+                 ;; background (see saturn-spell.c), so this is one line
+                 ;; written and one read, obj0 being the suggestion
+                 (saturn:spell-query str store provider "SaturnEnchantResult"))
                (idle-timeout ()
                  (setf *timeout-source* 0)
-                 (let ((output (run-cmd)))
-                   (unless output
-                     (return-from idle-timeout))
-                   (with-input-from-string (s output)
-                     ;; discard line the first line, which looks like this:
-                     ;; ```
-                     ;; @(#) International Ispell Version 3.1.20 (but really Enchant 2.8.15)
-                     ;; ```
-                     (read-line s nil nil)
-                     (let* ((line (read-line s nil nil))
-                            (suggestions (output-line-to-suggestions line)))
-                       (loop for suggestion in suggestions
-                             do (saturn:submit-result
-                                 (make-instance 'enchant-result
-                                                :obj0 (gtk:string-object-new suggestion))
-                                 store provider)))))
+                 (bordeaux-threads:make-thread #'thread)
                  ;; don't run again
                  nil))
-      (setf *timeout-source*
-            ;; debounce 0.25 seconds
-            (g:timeout-add 250 #'idle-timeout)))))
+        (setf *timeout-source*
+              ;; debounce 0.1 seconds
+              (g:timeout-add 100 #'idle-timeout)))))
 
   )
 
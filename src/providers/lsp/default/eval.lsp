@@ -85,6 +85,8 @@
                                             (first vals))))))
                     (hadjustment (gtk:scrolled-window-hadjustment result-scrolled-window))
                     (vadjustment (gtk:scrolled-window-vadjustment result-scrolled-window)))
+               ;; whatever got defined is worth completing from now on
+               (saturn:update-package-completions *package*)
                ;; append to the end of the buffer with newline
                (gtk:text-buffer-insert result-buffer
                                        (gtk:text-buffer-end-iter result-buffer)
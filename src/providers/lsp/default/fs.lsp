@@ -89,113 +89,126 @@
 (setf +list-bind-gtype+ "SaturnFsResultListItem")
 
 (defvar *min-query-length* 2)
+;; seconds before the file list is considered stale, the first query after
+;; that gathers it again in the background while the old list keeps
+;; answering
+(defvar *file-index-max-age* (* 15 60))
 
-(let ((*work-lock* (bordeaux-threads:make-lock))
-      (*files-array* (make-array 0 :fill-pointer t :adjustable t)))
-
-  (defun gather-files (path)
-    (let* ((batch-size 4096)
-           (batch-arr (make-array batch-size :initial-element nil))
-           (batch-idx 0))
-      (labels ((submit (f)
-                 (setf (aref batch-arr batch-idx) f)
-                 (when (>= (incf batch-idx) batch-size)
-                   (bordeaux-threads:with-lock-held (*work-lock*)
-                     (loop for f across batch-arr
-                           do (vector-push-extend f *files-array*)))
-                   (setf batch-idx 0)))
-               (is-hidden-file (x)
-                 (let ((name (or (pathname-name x)
-                                 (car (last (pathname-directory x))))))
-                   (when (> (length name) 1)
-                     (search "." name :end2 1))))
-               (gather (path)
-                 (let ((dirs (uiop:subdirectories path))
-                       (git-dir (uiop:subpathname path ".git/")))
-                   (if (find git-dir dirs
-                             :test #'uiop:pathname-equal)
-                       ;; we are dealing with a git repo, so shrimply (🦐) grab
-                       ;; the results of ls-files
-                       (let* ((git-output
-                                (ignore-errors
-                                 (uiop:run-program (list "git"
-                                                         "-C"
-                                                         (uiop:unix-namestring path)
-                                                         "ls-files"
-                                                         "--cached"
-                                                         "--others"
-                                                         "--exclude-standard")
-                                                   :output :string))))
+;; the file list itself lives in the native file index (see
+;; saturn-file-index.c), which keeps a trigram index alongside it so that
+;; queries only touch the files which can possibly match
+(defun gather-files (path)
+  (let* ((batch-size 4096)
+         (batch-arr (make-array batch-size :initial-element nil))
+         (batch-idx 0))
+    (labels ((flush ()
+               (saturn:file-index-add-batch batch-arr batch-idx)
+               (setf batch-idx 0))
+             (submit (f)
+               (setf (aref batch-arr batch-idx) (uiop:unix-namestring f))
+               (when (>= (incf batch-idx) batch-size)
+                 (flush)))
+             (is-hidden-file (x)
+               (let ((name (or (pathname-name x)
+                               (car (last (pathname-directory x))))))
+                 (when (> (length name) 1)
+                   (search "." name :end2 1))))
+             (gather (path)
+               (let ((dirs (uiop:subdirectories path))
+                     (git-dir (uiop:subpathname path ".git/")))
+                 (if (find git-dir dirs
+                           :test #'uiop:pathname-equal)
+                     ;; we are dealing with a git repo, so shrimply (🦐) read
+                     ;; its index natively, only asking git itself when the
+                     ;; index is in a format the reader doesn't handle
+                     (unless (saturn:file-index-add-git-repo
+                              (uiop:unix-namestring path))
+                       (let ((git-output
+                               (ignore-errors
+                                (uiop:run-program (list "git"
+                                                        "-C"
+                                                        (uiop:unix-namestring path)
+                                                        "ls-files"
+                                                        "--cached"
+                                                        "--others"
+                                                        "--exclude-standard")
+                                                  :output :string))))
                          (when git-output
                            (with-input-from-string (s git-output)
                              (loop for line = (read-line s nil nil)
                                    while line
-                                   do (submit (uiop:subpathname path line))))))
-                       ;; otherwise just recurse as normal
-                       (let ((files (uiop:directory-files path)))
-                         (loop for f in files
-                               unless (is-hidden-file f)
-                                 do (submit f))
-                         (loop for d in dirs
-                               unless (is-hidden-file d)
-                                 do (gather d)))))))
-        (gather path))))
+                                   do (submit (uiop:subpathname path line)))))))
+                     ;; otherwise just recurse as normal
+                     (let ((files (uiop:directory-files path)))
+                       (loop for f in files
+                             unless (is-hidden-file f)
+                               do (submit f))
+                       (loop for d in dirs
+                             unless (is-hidden-file d)
+                               do (gather d)))))))
+      (gather path)
+      (flush))))
 
-  ;; PROVIDER IMPLEMENTATION
+;; PROVIDER IMPLEMENTATION
 
-  (let ((*gather-thread* (bordeaux-threads:make-thread
-                          (lambda ()
-                            (gather-files #P"~/")))))
-    (defun deinit-global (selected-text)
-      (when (bordeaux-threads:thread-alive-p *gather-thread*)
-        (bordeaux-threads:destroy-thread *gather-thread*))))
+;; the first gather fills the default index directly so that results show
+;; up as soon as possible, later ones fill a fresh index which is swapped in
+;; once complete, since nothing is ever removed from an index
+(let ((*gather-thread* nil)
+      (*gathered-at* 0))
+  (flet ((start-gather (rescan)
+           (setf *gathered-at* (get-universal-time))
+           (setf *gather-thread*
+                 (bordeaux-threads:make-thread
+                  (lambda ()
+                    (if rescan
+                        (progn
+                          (saturn:file-index-begin-rescan)
+                          (gather-files #P"~/")
+                          (saturn:file-index-finish-rescan))
+                        (gather-files #P"~/")))))))
+    (start-gather nil)
 
-  (defun query (provider object store)
-    (let* ((str (gtk:string-object-string object))
-           (tokens (saturn:extract-tokens str)))
-      (unless (>= (length str) *min-query-length*)
-        (return-from query))
-      (bordeaux-threads:make-thread
-       (lambda ()
-         (bordeaux-threads:with-lock-held (*work-lock*)
-           (block root
-             (loop for path across *files-array*
-                   for namestring = (file-namestring path)
-                   for split = (saturn:extract-tokens namestring)
-                   when (saturn:match-str-tokens tokens split)
-                     do (let* ((name (file-namestring path))
-                               (directory (uiop:unix-namestring (uiop:pathname-directory-pathname path)))
-                               (result (make-instance 'fs-result
-                                                      :obj0 (gtk:string-object-new name)
-                                                      :obj1 (gtk:string-object-new directory))))
-                          ;; gobject properties weirdly don't work
-                          (setf (g:object-data result "path") path)
-                          (unless (saturn:submit-result result store provider)
-                            (return-from root))))))))))
+    ;; only called from the main thread
+    (defun refresh-files ()
+      (when (and (not (bordeaux-threads:thread-alive-p *gather-thread*))
+                 (> (- (get-universal-time) *gathered-at*)
+                    *file-index-max-age*))
+        (start-gather t)))
 
-  )
+    (defun deinit-global (selected-text)
+      (when (bordeaux-threads:thread-alive-p *gather-thread*)
+        (bordeaux-threads:destroy-thread *gather-thread*)))))
 
+(defun query (provider object store)
+  (let ((str (gtk:string-object-string object)))
+    (unless (>= (length str) *min-query-length*)
+      (return-from query))
+    (refresh-files)
+    ;; results are built and submitted natively, obj0 being the file name,
+    ;; obj1 the directory and obj2 the full path
+    (bordeaux-threads:make-thread
+     (lambda ()
+       (saturn:file-index-query str store provider "SaturnFsResult")))))
 
 (defun score (provider item query)
   (let ((str (gtk:string-object-string query))
-        (name (file-namestring (g:object-data item "path"))))
+        (name (gtk:string-object-string (g:object-property item "obj0"))))
     (saturn:generic-str-score str name)))
 
 (defun select (provider item query)
-  (let* ((path (g:object-data item "path"))
-         (file (uiop:unix-namestring path)))
-    (ignore-errors
-     (uiop:run-program (list "flatpak-spawn"
-                             "--host"
-                             "xdg-open"
-                             file)))
+  (let ((file (gtk:string-object-string (g:object-property item "obj2")))
+        (name (gtk:string-object-string (g:object-property item "obj0"))))
+    (saturn:launch-async (list "flatpak-spawn"
+                               "--host"
+                               "xdg-open"
+                               file))
     (make-instance 'saturn:selection-event
                    :kind :close
-                   :selected-text (file-namestring path))))
+                   :selected-text name)))
 
 (defun bind-preview (provider item)
-  (let* ((path (g:object-data item "path"))
-         (file (uiop:unix-namestring path))
+  (let* ((file (gtk:string-object-string (g:object-property item "obj2")))
          (gfile (g:file-new-for-path file))
          (info (g:file-query-info gfile "standard::content-type" :none)))
     (unless info
@@ -19,29 +19,19 @@
 
 (defvar *min-query-length* 3)
 
-(defvar +highlight-rgbas+
-  (mapcar #'(lambda (spec)
-              (gdk:rgba-parse spec))
-          '("#3584e4aa"
-            "#2190a4aa"
-            "#3a944aaa"
-            "#c88800aa"
-            "#ed5b00aa"
-            "#e62d42aa"
-            "#d56199aa"
-            "#9141acaa"
-            "#6f8396aa")))
+;; :rg runs the bundled ripgrep over the home directory, treating the
+;; query as a regular expression. :native instead searches the files the fs
+;; provider has indexed in-process, for the query as a literal string, so
+;; it only finds what rg would if the query has no special characters and
+;; the file isn't hidden or ignored
+(defvar *engine* :rg)
 
-(defun make-grep-cmd (word)
-  (list "rg"
-        ;; From ripgrep manual: This flag prints the file path above clusters of
-        ;; matches from each file instead of printing the file path as a prefix
-        ;; for each matched line.
-        "--heading"
-        ;; From ripgrep manual: Show line numbers (1-based).
-        "--line-number"
-        word
-        (uiop:unix-namestring (user-homedir-pathname))))
+;; map whatever content index the last session left behind, so that the
+;; native engine can narrow queries down before the fs provider is done
+;; gathering and has refreshed it
+(when (eq *engine* :native)
+  (bordeaux-threads:make-thread
+   (lambda () (saturn:content-index-load))))
 
 (gobject:define-gobject-subclass
     "SaturnGrepResult"
@@ -115,7 +105,7 @@
 ;; PROVIDER IMPLEMENTATION
 
 (defun deinit-global (selected-text)
-  nil)
+  (saturn:grep-cancel))
 
 (let ((*timeout-source* 0))
 
@@ -123,107 +113,58 @@
     (when (not (= *timeout-source* 0))
       (g:source-remove *timeout-source*)
       (setf *timeout-source* 0))
-    (let* ((str (gtk:string-object-string object))
-           (strlen (length str)))
-      (unless (>= strlen *min-query-length*)
+    ;; this stops the search of the previous query right away instead of
+    ;; letting it finish scanning the home directory in the background
+    (let ((generation (saturn:grep-cancel))
+          (str (gtk:string-object-string object)))
+      (unless (>= (length str) *min-query-length*)
         (return-from query))
-      (labels ((populate-buffer-line (buffer cursor line match-offset match-color)
-                 (let* ((start-seq (subseq line 0 match-offset))
-                        (tag-seq (subseq line match-offset (+ match-offset strlen)))
-                        (end-seq (format nil "~a~%" (subseq line (+ match-offset strlen))))
-                        (tag (gtk:text-buffer-create-tag buffer nil
-                                                         :background-rgba match-color)))
-                   (gtk:text-iter-forward-to-end cursor)
-                   (gtk:text-buffer-insert buffer cursor start-seq)
-                   (gtk:text-iter-forward-to-end cursor)
-                   (gtk:text-buffer-insert-with-tags buffer cursor tag-seq tag)
-                   (gtk:text-iter-forward-to-end cursor)
-                   (gtk:text-buffer-insert buffer cursor end-seq)))
-               (finish-result (line path matches)
-                 (saturn:submit-result
-                  (make-instance
-                   'grep-result
-                   :obj0 (gtk:string-object-new path)
-                   :obj1 (let* ((buffer (make-instance 'gtk:text-buffer))
-                                (cursor (gtk:text-buffer-start-iter buffer)))
-                           (loop for line in (reverse matches)
-                                 for match-offset = (search str line)
-                                 for idx from 0
-                                 for match-color = (nth (mod idx
-                                                             (length +highlight-rgbas+))
-                                                        +highlight-rgbas+)
-                                 when match-offset
-                                   do (populate-buffer-line buffer
-                                                            cursor
-                                                            line
-                                                            match-offset
-                                                            match-color))
-                           buffer))
-                  store provider))
-               (thread ()
-                 (let ((process
-                         (ignore-errors
-                          (uiop:launch-program (make-grep-cmd str)
-                                               :output :stream))))
-                   (unless process
-                     (return-from thread))
-                   (with-open-stream (s (uiop:process-info-output process))
-                     (let ((current-path nil)
-                           (current-matches nil))
-                       (loop for line = (ignore-errors (read-line s nil nil))
-                             while line
-                             do (if (uiop:emptyp line)
-                                    (progn
-                                      (when (and current-path
-                                                 current-matches)
-                                        (finish-result line
-                                                       current-path
-                                                       current-matches))
-                                      (setf current-path nil
-                                            current-matches nil))
-                                    (if current-path
-                                        (push line current-matches)
-                                        (setf current-path line))))))))
+      (labels ((thread ()
+                 ;; results are built and submitted natively, one per file as
+                 ;; soon as the engine is done with it, obj0 being the path
+                 ;; and obj1 the file's match records
+                 (if (eq *engine* :rg)
+                     (saturn:grep-query generation
+                                        str
+                                        (uiop:unix-namestring (user-homedir-pathname))
+                                        store
+                                        provider
+                                        "SaturnGrepResult")
+                     (saturn:content-search-query generation
+                                                  str
+                                                  store
+                                                  provider
+                                                  "SaturnGrepResult")))
                (idle-timeout ()
                  (setf *timeout-source* 0)
                  (bordeaux-threads:make-thread #'thread)
                  ;; don't run again
                  nil))
         (setf *timeout-source*
-              ;; debounce 0.5 seconds
-              (g:timeout-add 500 #'idle-timeout)))))
+              ;; the content index makes native queries cheap enough to
+              ;; barely debounce, a full rg run over the home directory isn't
+              (g:timeout-add (if (eq *engine* :rg) 500 100) #'idle-timeout)))))
 
   )
 
 (defun score (provider item query)
   (let ((str (gtk:string-object-string query))
-        (n-matched-lines (gtk:text-buffer-line-count (g:object-property item "obj1"))))
+        (n-matched-lines (saturn:grep-matches-n-lines (g:object-property item "obj1"))))
     (* 100 n-matched-lines)))
 
 (defun select (provider item query)
   ;; same as fs.lsp
   (let* ((path (gtk:string-object-string
                 (g:object-property item "obj0"))))
-    (ignore-errors
-     (uiop:run-program (list "flatpak-spawn"
-                             "--host"
-                             "xdg-open"
-                             path)))
+    (saturn:launch-async (list "flatpak-spawn"
+                               "--host"
+                               "xdg-open"
+                               path))
     (make-instance 'saturn:selection-event
                    :kind :close
                    :selected-text (file-namestring path))))
 
 (defun bind-preview (provider item)
-  (let* ((buffer (g:object-property item "obj1"))
-         (text-view
-           (saturn:make-widget
-               'gtk:text-view
-               (:props (:buffer buffer
-                        :editable nil
-                        :monospace t)
-                :styles ("text-preview"))))
-         (scrolled-window
-           (saturn:make-widget
-               'gtk:scrolled-window
-               (:props (:child text-view)))))
-    scrolled-window))
+  ;; the highlighted buffer is only built now, and only as far as it is
+  ;; scrolled
+  (saturn:grep-matches-create-preview (g:object-property item "obj1")))
@@ -17,10 +17,6 @@
 ;;
 ;; SPDX-License-Identifier: GPL-3.0-or-later
 
-(defvar +history-file+
-  (uiop:subpathname (saturn:get-saturn-cache-dir)
-                    "history.txt"))
-
 (gobject:define-gobject-subclass
     "SaturnHistoryResult"
     history-result
@@ -93,33 +89,22 @@
 (setf +list-bind-gtype+ "SaturnHistoryResultListItem")
 
 
-(defvar +history+
-  (ignore-errors
-   (with-open-file (s +history-file+
-                      :direction :input)
-     (loop for line = (read-line s nil)
-           while line
-           collect (make-instance 'history-result
-                                  :obj0 (gtk:string-object-new line))))))
-
 ;; PROVIDER IMPLEMENTATION
 
 (defun deinit-global (selected-text)
-  (uiop/common-lisp:ensure-directories-exist +history-file+)
-  (unless selected-text
-    (return-from deinit-global))
-  ;; append to history
-  (with-open-file (s +history-file+
-                     :direction :output
-                     :if-exists :append
-                     :if-does-not-exist :create)
-    (format s "~a~%" selected-text)))
+  nil)
+
+(defun record-selection (selected-text)
+  ;; the history is kept natively, one entry per distinct selection with a
+  ;; use count and timestamp, and is bounded (see saturn-history.c)
+  (saturn:history-record selected-text))
 
 (defun query (provider object store)
   (unless (= 0 (length (gtk:string-object-string object)))
     (return-from query))
-  (loop for result in +history+
-        do (saturn:submit-result result store provider)))
+  ;; nothing is read until the first time this runs. results come most
+  ;; recently used first, obj0 being the text
+  (saturn:history-query store provider "SaturnHistoryResult"))
 
 (defun score (provider item query)
   1)
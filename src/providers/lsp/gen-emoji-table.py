@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# gen-emoji-table.py
+#
+# Copyright 2026 Eva M
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+# Compiles emoji-table.lsp into the tables declared in saturn-emoji-table.h:
+# every glyph pre-encoded as UTF-8, every name along with its casefolded
+# form, and the sorted words of those names mapped to the emojis using them.
+
+import re
+import sys
+
+ENTRY = re.compile(r'\(\(\s*((?:#x[0-9A-Fa-f]+\s*)+)\)\s+"((?:[^"\\]|\\.)*)"\)')
+
+
+# runs of alphanumerics, the same as saturn_emoji_query() splits queries
+def words(folded):
+    return re.findall(r'[^\W_]+', folded)
+
+
+def c_string(s):
+    out = []
+    for byte in s.encode('utf-8'):
+        if byte in (ord('"'), ord('\\')) or byte < 0x20 or byte > 0x7e or byte == ord('?'):
+            out.append('\\%03o' % byte)
+        else:
+            out.append(chr(byte))
+    return '"' + ''.join(out) + '\\000"'
+
+
+def main(input_path, output_path):
+    with open(input_path, encoding='utf-8') as f:
+        source = f.read()
+
+    entries = []
+    for codes, name in ENTRY.findall(source):
+        glyph = ''.join(chr(int(code[2:], 16)) for code in codes.split())
+        name = re.sub(r'\\(.)', r'\1', name)
+        entries.append((glyph, name, name.casefold()))
+
+    if not entries:
+        sys.exit('%s: no emojis found' % input_path)
+    if len(entries) > 0xffff:
+        sys.exit('%s: too many emojis for 16 bit ids' % input_path)
+
+    strings = []
+    offsets = {}
+    length = 0
+
+    def intern(s):
+        nonlocal length
+        if s not in offsets:
+            offsets[s] = length
+            strings.append(s)
+            length += len(s.encode('utf-8')) + 1
+        return offsets[s]
+
+    records = []
+    postings = {}
+    for i, (glyph, name, folded) in enumerate(entries):
+        records.append((intern(glyph), intern(name), intern(folded)))
+        for word in dict.fromkeys(words(folded)):
+            postings.setdefault(word, []).append(i)
+
+    # byte order, so that it matches strcmp() and prefixes sort together
+    tokens = sorted(postings, key=lambda word: word.encode('utf-8'))
+    token_records = []
+    flat = []
+    for word in tokens:
+        token_records.append((intern(word), len(flat), len(postings[word])))
+        flat.extend(postings[word])
+
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write('/* generated by gen-emoji-table.py, do not edit */\n\n')
+        f.write('#include "providers/lsp/saturn-emoji-table.h"\n\n')
+
+        f.write('const char saturn_emoji_strings[] =\n')
+        for s in strings:
+            f.write('  %s\n' % c_string(s))
+        f.write('  ;\n\n')
+
+        f.write('const SaturnEmojiEntry saturn_emoji_entries[] = {\n')
+        for record in records:
+            f.write('  { %d, %d, %d },\n' % record)
+        f.write('};\n')
+        f.write('const guint saturn_emoji_n_entries = %d;\n\n' % len(records))
+
+        f.write('const SaturnEmojiToken saturn_emoji_tokens[] = {\n')
+        for record in token_records:
+            f.write('  { %d, %d, %d },\n' % record)
+        f.write('};\n')
+        f.write('const guint saturn_emoji_n_tokens = %d;\n\n' % len(token_records))
+
+        f.write('const guint16 saturn_emoji_postings[] = {\n')
+        for i in range(0, len(flat), 16):
+            f.write('  %s,\n' % ', '.join(str(id) for id in flat[i:i + 16]))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit('usage: %s INPUT OUTPUT' % sys.argv[0])
+    main(sys.argv[1], sys.argv[2])
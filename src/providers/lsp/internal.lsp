@@ -203,45 +203,110 @@
 ;;;;;;;;;;;;;;;;;;;;;;;;
 ;; sourceview completion
 
+(defun make-symbol-proposal (s)
+  (let* ((symbol-kind
+           (cond
+             ((find-package s) :package)
+             ((macro-function s) :macro)
+             ((fboundp s) :function)
+             (t :normal)))
+         (symbol-string
+           (string-downcase (string s)))
+         (symbol-args
+           (when (eql symbol-kind :function)
+             (let ((fn (ignore-errors (symbol-function s))))
+               (when (functionp fn)
+                 ;; a string list only makes string objects for the
+                 ;; arguments once they are actually displayed
+                 (gtk:string-list-new
+                  (loop for arg in (si:function-lambda-list fn)
+                        collect (format nil "~a" arg))))))))
+    (make-instance 'completion-proposal
+                   :kind symbol-kind
+                   :string symbol-string
+                   :lambda-args symbol-args)))
+
 (defun package-completion-buffer (&rest pkgs)
   (let ((completions (g:list-store-new "GObject")))
     (loop for pkg in pkgs
-          for prefix = (string-downcase (package-name pkg))
           do (do-symbols (s pkg)
-               (let* ((symbol-kind
-                        (cond
-                          ((find-package s) :package)
-                          ((macro-function s) :macro)
-                          ((fboundp s) :function)
-                          (t :normal)))
-                      (symbol-string
-                        (string-downcase (string s)))
-                      (symbol-args
-                        (when (eql symbol-kind :function)
-                          (let ((fn (ignore-errors (symbol-function s))))
-                            (when (functionp fn)
-                              (let* ((args (si:function-lambda-list fn))
-                                     (store (g:list-store-new "GObject")))
-                                (loop for arg in args
-                                      for str-rep = (format nil "~a" arg)
-                                      for str-obj = (gtk:string-object-new str-rep)
-                                      do (g:list-store-append store str-obj))
-                                store)))))
-                      (proposal
-                        (make-instance 'completion-proposal
-                                       :kind symbol-kind
-                                       :string symbol-string
-                                       :lambda-args symbol-args)))
-                 (g:list-store-append completions proposal))))
+               (g:list-store-append completions (make-symbol-proposal s))))
     completions))
 (export 'package-completion-buffer)
 
+;; one catalogue per package, shared by every source view completing from
+;; it and only ever extended by the symbols it doesn't have yet
+(defstruct completion-catalogue
+  package
+  ;; main thread only
+  (model (g:list-store-new "GObject"))
+  ;; symbols that already have a proposal, guarded by lock
+  (seen (make-hash-table :test #'eq))
+  ;; what package-symbol-count said when seen was last brought up to date
+  (symbol-count -1)
+  (lock (bordeaux-threads:make-lock "completion-catalogue")))
+
+(defvar *completion-catalogues* (make-hash-table :test #'eq))
+(defvar *completion-catalogues-lock* (bordeaux-threads:make-lock "completion-catalogues"))
+
+(defun package-completion-catalogue (pkg)
+  (let ((pkg (find-package pkg)))
+    (bordeaux-threads:with-lock-held (*completion-catalogues-lock*)
+      (or (gethash pkg *completion-catalogues*)
+          (setf (gethash pkg *completion-catalogues*)
+                (make-completion-catalogue :package pkg))))))
+
+;; package-symbol-count (see provider.c) only reads the sizes of the
+;; package's symbol tables, and changes whenever a symbol becomes
+;; accessible, save for the rare unintern followed by an intern
+(defun completion-catalogue-stale-p (catalogue)
+  (/= (package-symbol-count (completion-catalogue-package catalogue))
+      (completion-catalogue-symbol-count catalogue)))
+
+(defun completion-catalogue-new-proposals (catalogue)
+  (bordeaux-threads:with-lock-held ((completion-catalogue-lock catalogue))
+    (let ((seen (completion-catalogue-seen catalogue))
+          (count (package-symbol-count (completion-catalogue-package catalogue)))
+          (proposals nil))
+      ;; another update may have caught up in the meantime
+      (when (/= count (completion-catalogue-symbol-count catalogue))
+        ;; do-symbols may well visit a symbol more than once
+        (do-symbols (s (completion-catalogue-package catalogue))
+          (unless (gethash s seen)
+            (setf (gethash s seen) t)
+            (push (make-symbol-proposal s) proposals)))
+        (setf (completion-catalogue-symbol-count catalogue) count))
+      (nreverse proposals))))
+
+;; adds proposals for every symbol interned since the last update, in the
+;; background, but only walks a package once its symbol count has changed
+(defun update-package-completions (&rest pkgs)
+  (loop for pkg in pkgs
+        for catalogue = (package-completion-catalogue pkg)
+        when (completion-catalogue-stale-p catalogue)
+        do (let ((catalogue catalogue))
+             (bordeaux-threads:make-thread
+              (lambda ()
+                (let ((proposals (completion-catalogue-new-proposals catalogue)))
+                  (when proposals
+                    (g:idle-add
+                     (lambda ()
+                       ;; one splice, so the completion popover hears about
+                       ;; a single items-changed rather than one per symbol
+                       (let ((model (completion-catalogue-model catalogue)))
+                         (g:list-store-splice model
+                                              (g:list-model-n-items model)
+                                              0
+                                              proposals))
+                       nil)))))))))
+(export 'update-package-completions)
+
 (defun package-completion-buffer-async (text-view &rest pkgs)
-  (bordeaux-threads:make-thread
-   (lambda ()
-     (let ((model (apply #'package-completion-buffer pkgs)))
-       (g:idle-add
-        (lambda ()
-          (finish-source-view-completions model text-view)
-          nil))))))
+  ;; the shared model is handed out right away, whatever is missing from
+  ;; it shows up as soon as it has been made
+  (loop for pkg in pkgs
+        do (finish-source-view-completions
+            (completion-catalogue-model (package-completion-catalogue pkg))
+            text-view))
+  (apply #'update-package-completions pkgs))
 (export 'package-completion-buffer-async)
@@ -27,10 +27,24 @@
 #include <gtksourceview/gtksource.h>
 
 #include "provider.h"
+#include "saturn-appinfo-catalogue.h"
+#include "saturn-brew-index.h"
+#include "saturn-calc.h"
 #include "saturn-cl-selection-event.h"
+#include "saturn-content-index.h"
+#include "saturn-content-search.h"
+#include "saturn-emoji.h"
+#include "saturn-file-index.h"
+#include "saturn-git-index.h"
+#include "saturn-grep-matches.h"
+#include "saturn-grep.h"
+#include "saturn-history.h"
+#include "saturn-icon-cache.h"
+#include "saturn-launch.h"
 #include "saturn-generic-result.h"
 #include "saturn-provider.h"
 #include "saturn-signal-widget.h"
+#include "saturn-spell.h"
 #include "saturn-threadsafe-list-store.h"
 #include "source-completions/saturn-cl-completion-proposal.h"
 #include "source-completions/saturn-cl-completion-provider.h"
@@ -71,6 +85,34 @@ static cl_object
 gobject_to_cl (gpointer object);
 static gpointer
 cl_to_gobject (cl_object object);
+static char *
+cl_string_to_utf8 (cl_object string);
+
+static gboolean
+submit_result (GObject                   *result,
+               SaturnThreadsafeListStore *store,
+               SaturnLspProvider         *provider);
+
+static void
+set_result_key (GObject    *result,
+                const char *key);
+
+/* where the native queries send their results */
+typedef struct
+{
+  GType                      type;
+  SaturnThreadsafeListStore *store;
+  SaturnLspProvider         *provider;
+} QueryTarget;
+
+static gboolean
+resolve_query_target (QueryTarget *target,
+                      cl_object    cl_store,
+                      cl_object    cl_provider,
+                      cl_object    cl_result_type);
+
+static void
+content_index_update_async (void);
 
 static void
 ensure_lisp (SaturnLspProvider *self);
@@ -188,8 +230,8 @@ saturn_lsp_provider_init (SaturnLspProvider *self)
   self->list_bind_type = G_TYPE_NONE;
 }
 
-static cl_object
-cl_get_saturn_cache_dir (void)
+static const char *
+get_saturn_cache_dir (void)
 {
   static char *saturn_cache = NULL;
 
@@ -207,7 +249,31 @@ cl_get_saturn_cache_dir (void)
           g_strdup_printf ("%s/%s/", cache_dir, appid));
     }
 
-  return ecl_make_constant_base_string (saturn_cache, -1);
+  return saturn_cache;
+}
+
+static cl_object
+cl_get_saturn_cache_dir (void)
+{
+  return ecl_make_constant_base_string (get_saturn_cache_dir (), -1);
+}
+
+static cl_object
+cl_launch_async (cl_object cl_argv)
+{
+  g_autoptr (GStrvBuilder) builder = NULL;
+  g_auto (GStrv) argv              = NULL;
+
+  builder = g_strv_builder_new ();
+  for (cl_object l = cl_argv; !Null (l); l = ECL_CONS_CDR (l))
+    g_strv_builder_take (builder, cl_string_to_utf8 (ECL_CONS_CAR (l)));
+  argv = g_strv_builder_end (builder);
+
+  if (argv[0] == NULL)
+    return ECL_NIL;
+
+  saturn_launch_async ((const char *const *) argv);
+  return ECL_T;
 }
 
 static cl_object
@@ -223,13 +289,837 @@ cl_submit_result (cl_object cl_result,
   store    = cl_to_gobject (cl_store);
   provider = cl_to_gobject (cl_provider);
 
-  g_object_set_qdata_full (
-      G_OBJECT (result),
-      SATURN_PROVIDER_QUARK,
-      g_object_ref (provider),
-      g_object_unref);
+  return ecl_make_bool (submit_result (result, store, provider));
+}
+
+static cl_object
+cl_set_result_key (cl_object cl_result,
+                   cl_object cl_key)
+{
+  g_autofree char *key = NULL;
+
+  key = cl_string_to_utf8 (cl_key);
+  set_result_key (cl_to_gobject (cl_result), key);
+
+  return cl_result;
+}
+
+/* while fs.lsp rescans, its batches go to a fresh index which only
+   replaces the default one once it is complete, so queries never see a
+   partial list */
+static GMutex           file_index_mutex   = { 0 };
+static SaturnFileIndex *file_index_pending = NULL;
+
+static SaturnFileIndex *
+dup_file_index_target (void)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&file_index_mutex);
+  if (file_index_pending != NULL)
+    return g_object_ref (file_index_pending);
+
+  return saturn_file_index_dup_default ();
+}
+
+static cl_object
+cl_file_index_begin_rescan (void)
+{
+  g_autoptr (SaturnFileIndex) old = NULL;
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    /* a rescan which died halfway is simply dropped */
+    locker             = g_mutex_locker_new (&file_index_mutex);
+    old                = g_steal_pointer (&file_index_pending);
+    file_index_pending = saturn_file_index_new ();
+  }
+
+  return ECL_T;
+}
+
+static cl_object
+cl_file_index_finish_rescan (void)
+{
+  g_autoptr (SaturnFileIndex) index = NULL;
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker = g_mutex_locker_new (&file_index_mutex);
+    index  = g_steal_pointer (&file_index_pending);
+  }
+
+  if (index == NULL)
+    return ECL_NIL;
+
+  saturn_file_index_set_default (index);
+  /* the content index merges against the new list, which is also when it
+     picks up edits to files it had already indexed */
+  content_index_update_async ();
+
+  return ECL_T;
+}
+
+static cl_object
+cl_file_index_add_batch (cl_object cl_paths,
+                         cl_object cl_count)
+{
+  cl_index count                    = 0;
+  g_autoptr (GPtrArray) arr         = NULL;
+  g_autoptr (SaturnFileIndex) index = NULL;
+
+  count = ecl_fixnum (cl_count);
+  arr   = g_ptr_array_new_full (count, g_free);
+
+  for (cl_index i = 0; i < count; i++)
+    {
+      cl_object cl_path = NULL;
+
+      cl_path = ecl_aref1 (cl_paths, i);
+      if (ecl_to_bool (cl_path))
+        g_ptr_array_add (arr, cl_string_to_utf8 (cl_path));
+    }
+
+  index = dup_file_index_target ();
+  saturn_file_index_add_batch (
+      index,
+      (const char *const *) arr->pdata,
+      arr->len);
+
+  return ECL_T;
+}
+
+/* matches the batching done by fs.lsp */
+#define FILE_INDEX_BATCH_SIZE 4096
+
+static cl_object
+cl_file_index_add_git_repo (cl_object cl_worktree)
+{
+  g_autoptr (GError) local_error    = NULL;
+  g_autofree char *worktree         = NULL;
+  g_autoptr (GPtrArray) files       = NULL;
+  g_autoptr (GPtrArray) batch       = NULL;
+  g_autoptr (SaturnFileIndex) index = NULL;
+
+  worktree = cl_string_to_utf8 (cl_worktree);
+  files    = saturn_git_list_files (worktree, get_saturn_cache_dir (), &local_error);
+  if (files == NULL)
+    {
+      g_debug ("Unable to read git index of %s, falling back: %s",
+               worktree, local_error->message);
+      return ECL_NIL;
+    }
+
+  index = dup_file_index_target ();
+  batch = g_ptr_array_new_full (FILE_INDEX_BATCH_SIZE, g_free);
+  for (guint i = 0; i < files->len; i++)
+    {
+      g_ptr_array_add (
+          batch,
+          g_build_filename (worktree, g_ptr_array_index (files, i), NULL));
+
+      if (batch->len >= FILE_INDEX_BATCH_SIZE || i + 1 == files->len)
+        {
+          saturn_file_index_add_batch (
+              index,
+              (const char *const *) batch->pdata,
+              batch->len);
+          g_ptr_array_set_size (batch, 0);
+        }
+    }
+
+  return ECL_T;
+}
+
+static gboolean
+file_index_query_cb (const char  *directory,
+                     const char  *name,
+                     QueryTarget *target)
+{
+  g_autofree char *path                = NULL;
+  g_autoptr (GtkStringObject) name_obj = NULL;
+  g_autoptr (GtkStringObject) dir_obj  = NULL;
+  g_autoptr (GtkStringObject) path_obj = NULL;
+  g_autoptr (GObject) result           = NULL;
+
+  path     = g_strconcat (directory, name, NULL);
+  name_obj = gtk_string_object_new (name);
+  dir_obj  = gtk_string_object_new (directory);
+  path_obj = gtk_string_object_new (path);
+
+  result = g_object_new (
+      target->type,
+      "obj0", name_obj,
+      "obj1", dir_obj,
+      "obj2", path_obj,
+      NULL);
+  set_result_key (result, name);
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_file_index_query (cl_object cl_query,
+                     cl_object cl_store,
+                     cl_object cl_provider,
+                     cl_object cl_result_type)
+{
+  g_autofree char *query            = NULL;
+  g_autoptr (SaturnFileIndex) index = NULL;
+  QueryTarget target                = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  index = saturn_file_index_dup_default ();
+  saturn_file_index_query (
+      index,
+      query,
+      (SaturnFileIndexFunc) file_index_query_cb,
+      &target);
+
+  return ECL_T;
+}
+
+static SaturnContentIndex *
+get_content_index (void)
+{
+  static SaturnContentIndex *content_index = NULL;
+
+  if (g_once_init_enter_pointer (&content_index))
+    {
+      g_autofree char *path = NULL;
+
+      path = g_build_filename (get_saturn_cache_dir (), "content-index", NULL);
+      g_once_init_leave_pointer (&content_index, saturn_content_index_new (path));
+    }
+
+  return content_index;
+}
+
+static cl_object
+cl_content_index_load (void)
+{
+  g_autoptr (GError) local_error = NULL;
+
+  if (!saturn_content_index_load (get_content_index (), &local_error))
+    {
+      g_warning ("Unable to load content index: %s", local_error->message);
+      return ECL_NIL;
+    }
+
+  return ECL_T;
+}
+
+/* at most one update at a time, and not more often than this */
+#define CONTENT_INDEX_UPDATE_INTERVAL (10 * G_USEC_PER_SEC)
+
+static GMutex   content_index_mutex       = { 0 };
+static gboolean content_index_updating    = FALSE;
+static gint64   content_index_last_update = 0;
+
+static void
+content_index_update_thread (gpointer data)
+{
+  g_autoptr (GError) local_error    = NULL;
+  g_autoptr (SaturnFileIndex) files = NULL;
+
+  files = saturn_file_index_dup_default ();
+  if (!saturn_content_index_update (
+          get_content_index (),
+          files,
+          NULL,
+          &local_error))
+    g_warning ("Unable to update content index: %s", local_error->message);
+
+  g_mutex_lock (&content_index_mutex);
+  content_index_updating = FALSE;
+  g_mutex_unlock (&content_index_mutex);
+}
+
+static void
+content_index_update_async (void)
+{
+  gint64 now = 0;
+
+  now = g_get_monotonic_time ();
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker = g_mutex_locker_new (&content_index_mutex);
+    if (content_index_updating ||
+        (content_index_last_update != 0 &&
+         now - content_index_last_update < CONTENT_INDEX_UPDATE_INTERVAL))
+      return;
+
+    content_index_updating    = TRUE;
+    content_index_last_update = now;
+  }
+
+  g_thread_unref (g_thread_new (
+      "Content Index",
+      (GThreadFunc) content_index_update_thread,
+      NULL));
+}
+
+/* only the latest grep query is ever allowed to run */
+static GMutex        grep_mutex       = { 0 };
+static guint         grep_generation  = 0;
+static GCancellable *grep_cancellable = NULL;
+
+static gboolean
+grep_file_cb (SaturnGrepFile *file,
+              QueryTarget    *target)
+{
+  g_autoptr (SaturnGrepMatches) matches = NULL;
+  g_autoptr (GtkStringObject) path_obj  = NULL;
+  g_autoptr (GObject) result            = NULL;
+
+  /* the result type is a lisp class, so this runs on the querying thread
+     rather than the search's workers. The preview is only laid out once the
+     result is actually looked at */
+  matches  = saturn_grep_matches_new (file);
+  path_obj = gtk_string_object_new (file->path);
+  result   = g_object_new (
+      target->type,
+      "obj0", path_obj,
+      "obj1", matches,
+      NULL);
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_grep_cancel (void)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&grep_mutex);
+
+  /* kills the running rg, if any */
+  if (grep_cancellable != NULL)
+    g_cancellable_cancel (grep_cancellable);
+  g_clear_object (&grep_cancellable);
+
+  return ecl_make_fixnum (++grep_generation);
+}
+
+/* returns NULL if the query was superseded before we even got to start */
+static GCancellable *
+grep_begin (guint generation)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&grep_mutex);
+  if (generation != grep_generation)
+    return NULL;
+
+  g_clear_object (&grep_cancellable);
+  grep_cancellable = g_cancellable_new ();
+
+  return g_object_ref (grep_cancellable);
+}
+
+static cl_object
+cl_grep_query (cl_object cl_generation,
+               cl_object cl_query,
+               cl_object cl_directory,
+               cl_object cl_store,
+               cl_object cl_provider,
+               cl_object cl_result_type)
+{
+  g_autoptr (GError) local_error       = NULL;
+  g_autofree char *query               = NULL;
+  g_autofree char *directory           = NULL;
+  g_autoptr (GCancellable) cancellable = NULL;
+  QueryTarget target                   = { 0 };
+
+  query     = cl_string_to_utf8 (cl_query);
+  directory = cl_string_to_utf8 (cl_directory);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  cancellable = grep_begin (ecl_fixnum (cl_generation));
+  if (cancellable == NULL)
+    return ECL_NIL;
+
+  if (!saturn_grep_run (
+          query, directory, cancellable,
+          (SaturnGrepFunc) grep_file_cb, &target,
+          &local_error))
+    {
+      g_warning ("Unable to run grep for %s: %s", query, local_error->message);
+      return ECL_NIL;
+    }
+
+  return ECL_T;
+}
+
+static cl_object
+cl_content_search_query (cl_object cl_generation,
+                         cl_object cl_query,
+                         cl_object cl_store,
+                         cl_object cl_provider,
+                         cl_object cl_result_type)
+{
+  g_autofree char *query               = NULL;
+  g_autoptr (GCancellable) cancellable = NULL;
+  g_autoptr (GPtrArray) candidates     = NULL;
+  g_autoptr (SaturnFileIndex) files    = NULL;
+  gboolean    stale                    = FALSE;
+  QueryTarget target                   = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  cancellable = grep_begin (ecl_fixnum (cl_generation));
+  if (cancellable == NULL)
+    return ECL_NIL;
+
+  /* the content index only narrows down which files to look at, every
+     candidate is still searched, so stale entries can't produce bogus
+     results */
+  files      = saturn_file_index_dup_default ();
+  candidates = saturn_content_index_query (
+      get_content_index (),
+      files, query, &stale);
+  if (stale)
+    /* for the queries after this one, the files it is behind on were added
+       to the candidates */
+    content_index_update_async ();
+  if (candidates != NULL)
+    saturn_content_search_run_paths (
+        candidates, query, cancellable,
+        (SaturnGrepFunc) grep_file_cb, &target);
+  else
+    /* searches whatever the fs provider has indexed so far */
+    saturn_content_search_run (
+        files, query, cancellable,
+        (SaturnGrepFunc) grep_file_cb, &target);
+
+  return ECL_T;
+}
+
+static cl_object
+cl_grep_matches_n_lines (cl_object cl_matches)
+{
+  SaturnGrepMatches *matches = NULL;
+
+  matches = cl_to_gobject (cl_matches);
+  return ecl_make_fixnum (saturn_grep_matches_get_n_lines (matches));
+}
+
+static cl_object
+cl_grep_matches_create_preview (cl_object cl_matches)
+{
+  SaturnGrepMatches *matches = NULL;
+
+  matches = cl_to_gobject (cl_matches);
+  return gobject_to_cl (saturn_grep_matches_create_preview (matches));
+}
+
+/* GTK's "large" icon size, which the row template asks for */
+#define APPINFO_ROW_ICON_SIZE 32
+
+static SaturnAppinfoCatalogue *
+get_appinfo_catalogue (void)
+{
+  static SaturnAppinfoCatalogue *catalogue = NULL;
+
+  if (g_once_init_enter_pointer (&catalogue))
+    {
+      g_autofree char *path = NULL;
+
+      path = g_build_filename (get_saturn_cache_dir (), "appinfo-cache", NULL);
+      g_once_init_leave_pointer (&catalogue, saturn_appinfo_catalogue_new (path));
+    }
+
+  return catalogue;
+}
+
+static cl_object
+cl_appinfo_catalogue_load (cl_object cl_directories)
+{
+  g_autoptr (GStrvBuilder) builder = NULL;
+  g_auto (GStrv) directories       = NULL;
+  g_autoptr (GPtrArray) entries    = NULL;
+  g_auto (GStrv) icon_names        = NULL;
+
+  builder = g_strv_builder_new ();
+  for (cl_object l = cl_directories; !Null (l); l = ECL_CONS_CDR (l))
+    g_strv_builder_take (builder, cl_string_to_utf8 (ECL_CONS_CAR (l)));
+  directories = g_strv_builder_end (builder);
+  g_clear_pointer (&builder, g_strv_builder_unref);
+
+  saturn_appinfo_catalogue_load (
+      get_appinfo_catalogue (),
+      (const char *const *) directories);
+
+  /* this runs while the provider is being set up on the main thread, and
+     rows will want every one of these icons as soon as they are shown */
+  entries = saturn_appinfo_catalogue_dup_entries (get_appinfo_catalogue ());
+  builder = g_strv_builder_new ();
+  for (guint i = 0; i < entries->len; i++)
+    {
+      const char *icon_name = NULL;
+
+      icon_name = saturn_appinfo_get_icon_name (g_ptr_array_index (entries, i));
+      if (icon_name != NULL)
+        g_strv_builder_add (builder, icon_name);
+    }
+  icon_names = g_strv_builder_end (builder);
+
+  saturn_icon_cache_prefetch (
+      saturn_icon_cache_get_default (),
+      (const char *const *) icon_names,
+      APPINFO_ROW_ICON_SIZE);
+
+  return ECL_T;
+}
+
+static gboolean
+appinfo_query_cb (SaturnAppinfo *info,
+                  QueryTarget   *target)
+{
+  g_autoptr (GtkStringObject) name_obj = NULL;
+  g_autoptr (GdkPaintable) icon        = NULL;
+  g_autoptr (GObject) result           = NULL;
+
+  name_obj = gtk_string_object_new (saturn_appinfo_get_name (info));
+  icon     = saturn_icon_cache_lookup (
+      saturn_icon_cache_get_default (),
+      saturn_appinfo_get_icon_name (info),
+      APPINFO_ROW_ICON_SIZE);
+
+  result = g_object_new (
+      target->type,
+      "obj0", name_obj,
+      "obj1", icon,
+      "obj2", info,
+      NULL);
+  set_result_key (result, saturn_appinfo_get_name (info));
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_appinfo_query (cl_object cl_query,
+                  cl_object cl_store,
+                  cl_object cl_provider,
+                  cl_object cl_result_type)
+{
+  g_autofree char *query  = NULL;
+  QueryTarget      target = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  saturn_appinfo_catalogue_query (
+      get_appinfo_catalogue (),
+      query,
+      (SaturnAppinfoFunc) appinfo_query_cb,
+      &target);
+
+  return ECL_T;
+}
+
+static cl_object
+cl_icon_cache_lookup (cl_object cl_icon_name,
+                      cl_object cl_size)
+{
+  g_autofree char *icon_name         = NULL;
+  g_autoptr (GdkPaintable) paintable = NULL;
+
+  icon_name = cl_string_to_utf8 (cl_icon_name);
+  paintable = saturn_icon_cache_lookup (
+      saturn_icon_cache_get_default (),
+      icon_name,
+      ecl_fixnum (cl_size));
+
+  return gobject_to_cl (paintable);
+}
+
+static gboolean
+emoji_query_cb (GtkStringObject *glyph,
+                GtkStringObject *name,
+                QueryTarget     *target)
+{
+  g_autoptr (GObject) result = NULL;
+
+  result = g_object_new (
+      target->type,
+      "obj0", glyph,
+      "obj1", name,
+      NULL);
+  set_result_key (result, gtk_string_object_get_string (name));
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_emoji_query (cl_object cl_query,
+                cl_object cl_store,
+                cl_object cl_provider,
+                cl_object cl_result_type)
+{
+  g_autofree char *query  = NULL;
+  QueryTarget      target = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  saturn_emoji_query (query, (SaturnEmojiFunc) emoji_query_cb, &target);
+
+  return ECL_T;
+}
+
+static SaturnBrewIndex *
+get_brew_index (void)
+{
+  static SaturnBrewIndex *brew_index = NULL;
+
+  if (g_once_init_enter_pointer (&brew_index))
+    {
+      g_autofree char *path = NULL;
+
+      path = g_build_filename (get_saturn_cache_dir (), "brew-index", NULL);
+      g_once_init_leave_pointer (&brew_index, saturn_brew_index_new (path));
+    }
+
+  return brew_index;
+}
+
+static cl_object
+cl_brew_index_refresh (cl_object cl_argv,
+                       cl_object cl_max_age)
+{
+  g_autoptr (GStrvBuilder) builder = NULL;
+  g_auto (GStrv) argv              = NULL;
+
+  builder = g_strv_builder_new ();
+  for (cl_object l = cl_argv; !Null (l); l = ECL_CONS_CDR (l))
+    g_strv_builder_take (builder, cl_string_to_utf8 (ECL_CONS_CAR (l)));
+  argv = g_strv_builder_end (builder);
+
+  if (argv[0] == NULL)
+    return ECL_NIL;
+
+  saturn_brew_index_refresh (
+      get_brew_index (),
+      (const char *const *) argv,
+      ecl_fixnum (cl_max_age));
+
+  return ECL_T;
+}
+
+static gboolean
+brew_query_cb (const char  *name,
+               const char  *description,
+               QueryTarget *target)
+{
+  g_autoptr (GtkStringObject) name_obj        = NULL;
+  g_autoptr (GtkStringObject) description_obj = NULL;
+  g_autoptr (GObject) result                  = NULL;
+
+  name_obj        = gtk_string_object_new (name);
+  description_obj = gtk_string_object_new (description);
+
+  result = g_object_new (
+      target->type,
+      "obj0", name_obj,
+      "obj1", description_obj,
+      NULL);
+  set_result_key (result, name);
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_brew_query (cl_object cl_query,
+               cl_object cl_store,
+               cl_object cl_provider,
+               cl_object cl_result_type)
+{
+  g_autofree char *query  = NULL;
+  QueryTarget      target = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  saturn_brew_index_query (
+      get_brew_index (),
+      query,
+      (SaturnBrewFunc) brew_query_cb,
+      &target);
+
+  return ECL_T;
+}
+
+static gboolean
+spell_query_cb (const char  *suggestion,
+                QueryTarget *target)
+{
+  g_autoptr (GtkStringObject) suggestion_obj = NULL;
+  g_autoptr (GObject) result                 = NULL;
+
+  suggestion_obj = gtk_string_object_new (suggestion);
+
+  result = g_object_new (
+      target->type,
+      "obj0", suggestion_obj,
+      NULL);
+  set_result_key (result, suggestion);
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_spell_query (cl_object cl_query,
+                cl_object cl_store,
+                cl_object cl_provider,
+                cl_object cl_result_type)
+{
+  g_autoptr (GError) local_error = NULL;
+  g_autofree char *query         = NULL;
+  QueryTarget      target        = { 0 };
+
+  query = cl_string_to_utf8 (cl_query);
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
+
+  if (!saturn_spell_suggest (
+          query,
+          (SaturnSpellFunc) spell_query_cb,
+          &target,
+          &local_error))
+    {
+      /* most likely enchant-2 just isn't installed */
+      g_debug ("Unable to check spelling of \"%s\": %s", query, local_error->message);
+      return ECL_NIL;
+    }
+
+  return ECL_T;
+}
+
+static cl_object
+cl_calc_evaluate (cl_object cl_expression)
+{
+  cl_index  length      = 0;
+  char     *expression  = NULL;
+  GError   *local_error = NULL;
+  cl_object result      = ECL_NIL;
+  cl_object steps       = ECL_NIL;
+
+  /* a condition signalled by the arithmetic unwinds straight through here
+     and skips any cleanup, so the copy belongs to lisp's collector. Only
+     ascii can make up an expression, anything else just fails to parse */
+  length     = ecl_length (cl_expression);
+  expression = ecl_alloc_atomic (length + 1);
+  for (cl_index i = 0; i < length; i++)
+    {
+      ecl_character c = ecl_char (cl_expression, i);
+
+      expression[i] = c > 0 && c < 0x80 ? c : 0x7f;
+    }
+  expression[length] = '\0';
+
+  /* the error is only ever set on the way out, once nothing can unwind */
+  result = saturn_calc_evaluate (expression, &steps, &local_error);
+  if (local_error != NULL)
+    {
+      /* most of what gets typed isn't math at all */
+      g_debug ("Not evaluating \"%s\": %s", expression, local_error->message);
+      g_clear_error (&local_error);
+      return ECL_NIL;
+    }
+
+  return ecl_cons (result, steps);
+}
+
+static SaturnHistory *
+get_history (void)
+{
+  static SaturnHistory *history = NULL;
+
+  if (g_once_init_enter_pointer (&history))
+    {
+      g_autofree char *path        = NULL;
+      g_autofree char *legacy_path = NULL;
+
+      path        = g_build_filename (get_saturn_cache_dir (), "history", NULL);
+      legacy_path = g_build_filename (get_saturn_cache_dir (), "history.txt", NULL);
+      g_once_init_leave_pointer (&history, saturn_history_new (path, legacy_path));
+    }
+
+  return history;
+}
+
+static cl_object
+cl_history_record (cl_object cl_text)
+{
+  g_autoptr (GError) local_error = NULL;
+  g_autofree char *text          = NULL;
+
+  text = cl_string_to_utf8 (cl_text);
+  if (!saturn_history_record (get_history (), text, &local_error))
+    {
+      g_warning ("Unable to record history: %s", local_error->message);
+      return ECL_NIL;
+    }
+
+  return ECL_T;
+}
+
+static gboolean
+history_query_cb (const char  *text,
+                  guint        count,
+                  gint64       last_used,
+                  QueryTarget *target)
+{
+  g_autoptr (GtkStringObject) text_obj = NULL;
+  g_autoptr (GObject) result           = NULL;
+
+  text_obj = gtk_string_object_new (text);
+
+  result = g_object_new (
+      target->type,
+      "obj0", text_obj,
+      NULL);
+
+  return submit_result (result, target->store, target->provider);
+}
+
+static cl_object
+cl_history_query (cl_object cl_store,
+                  cl_object cl_provider,
+                  cl_object cl_result_type)
+{
+  QueryTarget target = { 0 };
+
+  if (!resolve_query_target (&target, cl_store, cl_provider, cl_result_type))
+    return ECL_NIL;
 
-  return ecl_make_bool (saturn_threadsafe_list_store_append (store, result));
+  saturn_history_foreach (
+      get_history (),
+      (SaturnHistoryFunc) history_query_cb,
+      &target);
+
+  return ECL_T;
 }
 
 static cl_object
@@ -436,6 +1326,30 @@ cl_finish_source_view_completions (cl_object cl_model,
   return ECL_T;
 }
 
+/* The number of symbols accessible in a package, read off the sizes of its
+   symbol tables rather than visiting them like do-symbols would. Taken
+   without the package lock, since it is only a hint */
+static cl_object
+cl_package_symbol_count (cl_object cl_package)
+{
+  cl_object package = NULL;
+  cl_index  count   = 0;
+
+  package = si_coerce_to_package (cl_package);
+  count   = package->pack.internal->hash.entries +
+            package->pack.external->hash.entries;
+  for (cl_object l = package->pack.uses; !Null (l); l = ECL_CONS_CDR (l))
+    count += ECL_CONS_CAR (l)->pack.external->hash.entries;
+
+  return ecl_make_fixnum (count);
+}
+
+static const char *
+provider_get_name (SaturnProvider *provider)
+{
+  return SATURN_LSP_PROVIDER (provider)->name;
+}
+
 static void
 provider_init_global (SaturnProvider *provider)
 {
@@ -465,10 +1379,42 @@ provider_init_global (SaturnProvider *provider)
   DEFUN ("get-saturn-cache-dir", cl_get_saturn_cache_dir, 0);
 
   DEFUN ("submit-result", cl_submit_result, 3);
+  DEFUN ("set-result-key", cl_set_result_key, 2);
+  DEFUN ("launch-async", cl_launch_async, 1);
   DEFUN ("make-source-view", cl_make_source_view, 2);
   DEFUN ("make-lisp-buffer-view", cl_make_lisp_buffer_view, 0);
 
   DEFUN ("finish-source-view-completions", cl_finish_source_view_completions, 2);
+  DEFUN ("package-symbol-count", cl_package_symbol_count, 1);
+
+  DEFUN ("file-index-begin-rescan", cl_file_index_begin_rescan, 0);
+  DEFUN ("file-index-finish-rescan", cl_file_index_finish_rescan, 0);
+  DEFUN ("file-index-add-batch", cl_file_index_add_batch, 2);
+  DEFUN ("file-index-add-git-repo", cl_file_index_add_git_repo, 1);
+  DEFUN ("file-index-query", cl_file_index_query, 4);
+
+  DEFUN ("content-index-load", cl_content_index_load, 0);
+  DEFUN ("grep-cancel", cl_grep_cancel, 0);
+  DEFUN ("grep-query", cl_grep_query, 6);
+  DEFUN ("content-search-query", cl_content_search_query, 5);
+  DEFUN ("grep-matches-n-lines", cl_grep_matches_n_lines, 1);
+  DEFUN ("grep-matches-create-preview", cl_grep_matches_create_preview, 1);
+
+  DEFUN ("appinfo-catalogue-load", cl_appinfo_catalogue_load, 1);
+  DEFUN ("appinfo-query", cl_appinfo_query, 4);
+  DEFUN ("icon-cache-lookup", cl_icon_cache_lookup, 2);
+
+  DEFUN ("calc-evaluate", cl_calc_evaluate, 1);
+
+  DEFUN ("emoji-query", cl_emoji_query, 4);
+
+  DEFUN ("spell-query", cl_spell_query, 4);
+
+  DEFUN ("brew-index-refresh", cl_brew_index_refresh, 2);
+  DEFUN ("brew-query", cl_brew_query, 4);
+
+  DEFUN ("history-record", cl_history_record, 1);
+  DEFUN ("history-query", cl_history_query, 3);
 
 #undef DEFUN
 
@@ -503,6 +1449,26 @@ provider_deinit_global (SaturnProvider *provider,
           : ECL_NIL));
 }
 
+static void
+provider_record_selection (SaturnProvider *provider,
+                           const char     *selected_text)
+{
+  SaturnLspProvider *self     = SATURN_LSP_PROVIDER (provider);
+  char               fun[256] = { 0 };
+  cl_object          symbol   = NULL;
+
+  /* optional, most scripts only care about their own selections */
+  g_snprintf (fun, sizeof (fun), "%s:record-selection", self->name);
+  symbol = ecl_read_from_cstring (fun);
+  if (cl_fboundp (symbol) == ECL_NIL)
+    return;
+
+  cl_eval (cl_list (
+      2,
+      symbol,
+      ecl_make_constant_base_string (selected_text, -1)));
+}
+
 static void
 provider_query (SaturnProvider            *provider,
                 GObject                   *object,
@@ -644,13 +1610,15 @@ provider_bind_preview (SaturnProvider *provider,
 static void
 provider_iface_init (SaturnProviderInterface *iface)
 {
-  iface->init_global    = provider_init_global;
-  iface->deinit_global  = provider_deinit_global;
-  iface->query          = provider_query;
-  iface->score          = provider_score;
-  iface->select         = provider_select;
-  iface->bind_list_item = provider_bind_list_item;
-  iface->bind_preview   = provider_bind_preview;
+  iface->get_name         = provider_get_name;
+  iface->init_global      = provider_init_global;
+  iface->deinit_global    = provider_deinit_global;
+  iface->record_selection = provider_record_selection;
+  iface->query            = provider_query;
+  iface->score            = provider_score;
+  iface->select           = provider_select;
+  iface->bind_list_item   = provider_bind_list_item;
+  iface->bind_preview     = provider_bind_preview;
 }
 
 static cl_object
@@ -671,6 +1639,70 @@ cl_to_gobject (cl_object object)
       object)));
 }
 
+static char *
+cl_string_to_utf8 (cl_object string)
+{
+  cl_index length      = 0;
+  GString *utf8_string = NULL;
+
+  /* lisp strings may hold any character, so we can't just take the base
+     string pointer */
+  length      = ecl_length (string);
+  utf8_string = g_string_sized_new (length);
+  for (cl_index i = 0; i < length; i++)
+    g_string_append_unichar (utf8_string, ecl_char (string, i));
+
+  return g_string_free (utf8_string, FALSE);
+}
+
+static gboolean
+submit_result (GObject                   *result,
+               SaturnThreadsafeListStore *store,
+               SaturnLspProvider         *provider)
+{
+  g_object_set_qdata_full (
+      result,
+      SATURN_PROVIDER_QUARK,
+      g_object_ref (provider),
+      g_object_unref);
+
+  return saturn_threadsafe_list_store_append (store, result);
+}
+
+static void
+set_result_key (GObject    *result,
+                const char *key)
+{
+  g_object_set_qdata_full (
+      result,
+      SATURN_PROVIDER_KEY_QUARK,
+      g_strdup (key),
+      g_free);
+}
+
+static gboolean
+resolve_query_target (QueryTarget *target,
+                      cl_object    cl_store,
+                      cl_object    cl_provider,
+                      cl_object    cl_result_type)
+{
+  g_autofree char *type_name = NULL;
+
+  type_name    = cl_string_to_utf8 (cl_result_type);
+  target->type = g_type_from_name (type_name);
+  if (!g_type_is_a (target->type, SATURN_TYPE_GENERIC_RESULT))
+    {
+      g_critical ("%s is not a subtype of %s",
+                  type_name, g_type_name (SATURN_TYPE_GENERIC_RESULT));
+      return FALSE;
+    }
+
+  target->store    = cl_to_gobject (cl_store);
+  target->provider = cl_to_gobject (cl_provider);
+
+  return TRUE;
+}
+
 static void
 ensure_lisp (SaturnLspProvider *self)
 {
@@ -715,7 +1747,7 @@ ensure_lisp (SaturnLspProvider *self)
 
   eval_before = g_strdup_printf ("(progn (defpackage :%s "
                                  "  (:use :cl) "
-                                 "  (:export :+list-bind-gtype+ :deinit-global :query :score :select :bind-list-item :bind-preview)) "
+                                 "  (:export :+list-bind-gtype+ :deinit-global :record-selection :query :score :select :bind-list-item :bind-preview)) "
                                  "(in-package :%s))",
                                  self->name, self->name);
   cl_eval (ecl_read_from_cstring (eval_before));
@@ -0,0 +1,858 @@
+/* saturn-appinfo-catalogue.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* Desktop entries are parsed once and kept in a small binary cache next to
+   the directories' mtimes. Adding, removing or renaming a desktop file, which
+   is how package managers install them, bumps the mtime of its directory, so
+   a warm start only has to stat a handful of directories and read one file.
+
+   The cache is a saturn-binary-file.h file laid out as
+
+     magic
+     guint32 n_directories, then each directory's path and gint64 mtime
+     guint32 n_entries, then each entry's strings, keywords and flags
+
+   Once loaded, every directory is monitored and a changed desktop file is
+   parsed on its own. Readers only ever see whole snapshots of the entries,
+   which are swapped in under a lock, and the cache is rewritten shortly
+   after. */
+
+#define G_LOG_DOMAIN "SATURN::APPINFO-CATALOGUE"
+
+#include <gio/gio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "saturn-appinfo-catalogue.h"
+#include "saturn-binary-file.h"
+#include "util.h"
+
+#define CACHE_MAGIC "SATAPPS1"
+
+enum
+{
+  ENTRY_NEEDS_TERMINAL = 1 << 0,
+  ENTRY_STARTUP_NOTIFY = 1 << 1,
+};
+
+/* how long to wait for a burst of desktop file changes to settle before
+   rewriting the cache */
+#define CACHE_WRITE_DELAY_MS 1000
+
+/* every prefix of a token up to this many characters is indexed, longer
+   query tokens are looked up by their first few and then verified */
+#define MAX_PREFIX_CHARS 8
+#define MAX_QUERY_TOKENS 16
+
+SATURN_DEFINE_DATA (
+    snapshot,
+    Snapshot,
+    {
+      guint64    version;
+      GPtrArray *entries;
+      /* casefolded tokens of every entry's name, categories and keywords,
+         NULL for entries lacking a name or an icon */
+      GPtrArray *tokens;
+      /* casefolded token prefix -> ascending guint32 entry ids */
+      GHashTable *prefixes;
+    },
+    SATURN_RELEASE_DATA (entries, g_ptr_array_unref);
+    SATURN_RELEASE_DATA (tokens, g_ptr_array_unref);
+    SATURN_RELEASE_DATA (prefixes, g_hash_table_unref));
+
+struct _SaturnAppinfoCatalogue
+{
+  GObject parent_instance;
+
+  char *cache_path;
+  GStrv directories;
+
+  /* only guards the snapshot pointer, which is swapped whole */
+  GMutex        mutex;
+  SnapshotData *snapshot;
+
+  /* main thread only */
+  GPtrArray *monitors;
+  guint      cache_write_source;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnAppinfoCatalogue, saturn_appinfo_catalogue, G_TYPE_OBJECT);
+
+static SnapshotData *
+get_snapshot (SaturnAppinfoCatalogue *self);
+
+static SnapshotData *
+snapshot_new (GPtrArray *entries);
+
+static void
+set_entries (SaturnAppinfoCatalogue *self,
+             GPtrArray              *entries);
+
+static gboolean
+start_monitoring (SaturnAppinfoCatalogue *self);
+
+static void
+directory_changed (SaturnAppinfoCatalogue *self,
+                   GFile                  *file,
+                   GFile                  *other_file,
+                   GFileMonitorEvent       event,
+                   GFileMonitor           *monitor);
+
+static void
+update_entry (SaturnAppinfoCatalogue *self,
+              GFile                  *file,
+              gboolean                removed);
+
+static gboolean
+cache_write_timeout (SaturnAppinfoCatalogue *self);
+
+static gint64 *
+get_mtimes (const char *const *directories);
+
+static gint64
+get_mtime (const char *path);
+
+static GPtrArray *
+parse_directories (const char *const *directories);
+
+static GPtrArray *
+read_cache (const char        *path,
+            const char *const *directories,
+            const gint64      *mtimes,
+            GError           **error);
+
+static gboolean
+write_cache (const char        *path,
+             const char *const *directories,
+             const gint64      *mtimes,
+             GPtrArray         *entries,
+             GError           **error);
+
+static void
+saturn_appinfo_catalogue_dispose (GObject *object)
+{
+  SaturnAppinfoCatalogue *self = SATURN_APPINFO_CATALOGUE (object);
+
+  g_clear_handle_id (&self->cache_write_source, g_source_remove);
+  g_clear_pointer (&self->monitors, g_ptr_array_unref);
+  g_clear_pointer (&self->snapshot, snapshot_data_unref);
+
+  G_OBJECT_CLASS (saturn_appinfo_catalogue_parent_class)->dispose (object);
+}
+
+static void
+saturn_appinfo_catalogue_finalize (GObject *object)
+{
+  SaturnAppinfoCatalogue *self = SATURN_APPINFO_CATALOGUE (object);
+
+  g_clear_pointer (&self->cache_path, g_free);
+  g_clear_pointer (&self->directories, g_strfreev);
+  g_mutex_clear (&self->mutex);
+
+  G_OBJECT_CLASS (saturn_appinfo_catalogue_parent_class)->finalize (object);
+}
+
+static void
+saturn_appinfo_catalogue_class_init (SaturnAppinfoCatalogueClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_appinfo_catalogue_dispose;
+  object_class->finalize = saturn_appinfo_catalogue_finalize;
+}
+
+static void
+saturn_appinfo_catalogue_init (SaturnAppinfoCatalogue *self)
+{
+  g_autoptr (GPtrArray) entries = NULL;
+
+  g_mutex_init (&self->mutex);
+
+  entries        = g_ptr_array_new_with_free_func (g_object_unref);
+  self->snapshot = snapshot_new (entries);
+}
+
+SaturnAppinfoCatalogue *
+saturn_appinfo_catalogue_new (const char *cache_path)
+{
+  SaturnAppinfoCatalogue *self = NULL;
+
+  g_return_val_if_fail (cache_path != NULL, NULL);
+
+  self             = g_object_new (SATURN_TYPE_APPINFO_CATALOGUE, NULL);
+  self->cache_path = g_strdup (cache_path);
+
+  return self;
+}
+
+void
+saturn_appinfo_catalogue_load (SaturnAppinfoCatalogue *self,
+                               const char *const      *directories)
+{
+  g_autofree gint64 *mtimes      = NULL;
+  g_autoptr (GError) local_error = NULL;
+  g_autoptr (GPtrArray) entries  = NULL;
+
+  g_return_if_fail (SATURN_IS_APPINFO_CATALOGUE (self));
+  g_return_if_fail (directories != NULL);
+
+  /* taken before parsing, so that anything changing underneath us
+     invalidates the cache we are about to write */
+  mtimes = get_mtimes (directories);
+
+  entries = read_cache (self->cache_path, directories, mtimes, &local_error);
+  if (entries == NULL)
+    {
+      g_debug ("Parsing desktop entries: %s", local_error->message);
+      g_clear_error (&local_error);
+
+      entries = parse_directories (directories);
+      if (!write_cache (self->cache_path, directories, mtimes, entries, &local_error))
+        g_warning ("Unable to write appinfo cache: %s", local_error->message);
+    }
+
+  set_entries (self, entries);
+
+  /* monitors deliver their events to the thread default main context they
+     were created in, and we may well be running on some other thread */
+  if (self->directories == NULL)
+    {
+      self->directories = g_strdupv ((GStrv) directories);
+      g_main_context_invoke_full (
+          NULL, G_PRIORITY_DEFAULT,
+          (GSourceFunc) start_monitoring,
+          g_object_ref (self), g_object_unref);
+    }
+}
+
+GPtrArray *
+saturn_appinfo_catalogue_dup_entries (SaturnAppinfoCatalogue *self)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  g_return_val_if_fail (SATURN_IS_APPINFO_CATALOGUE (self), NULL);
+
+  snapshot = get_snapshot (self);
+  return g_ptr_array_ref (snapshot->entries);
+}
+
+guint64
+saturn_appinfo_catalogue_get_version (SaturnAppinfoCatalogue *self)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  g_return_val_if_fail (SATURN_IS_APPINFO_CATALOGUE (self), 0);
+
+  snapshot = get_snapshot (self);
+  return snapshot->version;
+}
+
+static gboolean
+contains_id (GArray  *ids,
+             guint32  id)
+{
+  guint lo = 0;
+  guint hi = ids->len;
+
+  while (lo < hi)
+    {
+      guint   mid    = lo + (hi - lo) / 2;
+      guint32 mid_id = g_array_index (ids, guint32, mid);
+
+      if (mid_id < id)
+        lo = mid + 1;
+      else if (mid_id > id)
+        hi = mid;
+      else
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+static gboolean
+has_token_prefix (const char *const *tokens,
+                  const char        *prefix)
+{
+  for (const char *const *token = tokens; *token != NULL; token++)
+    {
+      if (g_str_has_prefix (*token, prefix))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+void
+saturn_appinfo_catalogue_query (SaturnAppinfoCatalogue *self,
+                                const char             *query,
+                                SaturnAppinfoFunc       func,
+                                gpointer                user_data)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autofree char *folded           = NULL;
+  char            *tokens[MAX_QUERY_TOKENS] = { 0 };
+  GArray          *lists[MAX_QUERY_TOKENS]  = { 0 };
+  guint            n_tokens                 = 0;
+  guint            smallest                 = 0;
+  char            *p                        = NULL;
+
+  g_return_if_fail (SATURN_IS_APPINFO_CATALOGUE (self));
+  g_return_if_fail (query != NULL);
+  g_return_if_fail (func != NULL);
+
+  snapshot = get_snapshot (self);
+
+  /* split in place, separators are overwritten with NULs */
+  folded = g_utf8_casefold (query, -1);
+  for (p = folded; *p != '\0' && n_tokens < MAX_QUERY_TOKENS;)
+    {
+      char *token = p;
+
+      while (*p != '\0' && g_unichar_isalnum (g_utf8_get_char (p)))
+        p = g_utf8_next_char (p);
+
+      if (p > token)
+        tokens[n_tokens++] = token;
+      if (*p == '\0')
+        break;
+
+      {
+        char *separator = p;
+
+        p = g_utf8_next_char (p);
+        memset (separator, '\0', p - separator);
+      }
+    }
+  if (n_tokens == 0)
+    return;
+
+  for (guint i = 0; i < n_tokens; i++)
+    {
+      char *cut  = tokens[i];
+      char  save = '\0';
+
+      for (guint j = 0; j < MAX_PREFIX_CHARS && *cut != '\0'; j++)
+        cut = g_utf8_next_char (cut);
+
+      save     = *cut;
+      *cut     = '\0';
+      lists[i] = g_hash_table_lookup (snapshot->prefixes, tokens[i]);
+      *cut     = save;
+
+      if (lists[i] == NULL)
+        return;
+      if (lists[i]->len < lists[smallest]->len)
+        smallest = i;
+    }
+
+  for (guint i = 0; i < lists[smallest]->len; i++)
+    {
+      guint32            id           = g_array_index (lists[smallest], guint32, i);
+      const char *const *entry_tokens = g_ptr_array_index (snapshot->tokens, id);
+      gboolean           matches      = TRUE;
+
+      for (guint j = 0; j < n_tokens && matches; j++)
+        {
+          if (j != smallest && !contains_id (lists[j], id))
+            matches = FALSE;
+          else if (g_utf8_strlen (tokens[j], -1) > MAX_PREFIX_CHARS &&
+                   !has_token_prefix (entry_tokens, tokens[j]))
+            matches = FALSE;
+        }
+
+      if (matches && !func (g_ptr_array_index (snapshot->entries, id), user_data))
+        break;
+    }
+}
+
+static SnapshotData *
+get_snapshot (SaturnAppinfoCatalogue *self)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&self->mutex);
+  return snapshot_data_ref (self->snapshot);
+}
+
+static void
+set_entries (SaturnAppinfoCatalogue *self,
+             GPtrArray              *entries)
+{
+  g_autoptr (SnapshotData) old      = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  /* the index is built before taking the lock and published along with
+     the entries it refers to */
+  snapshot = snapshot_new (entries);
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker            = g_mutex_locker_new (&self->mutex);
+    snapshot->version = self->snapshot->version + 1;
+    old               = g_steal_pointer (&self->snapshot);
+    self->snapshot    = g_steal_pointer (&snapshot);
+  }
+
+  /* old is released outside of the lock */
+}
+
+static void
+add_tokens (GStrvBuilder *builder,
+            const char   *text)
+{
+  g_autofree char *folded = NULL;
+  const char      *p      = NULL;
+
+  if (text == NULL)
+    return;
+
+  folded = g_utf8_casefold (text, -1);
+  for (p = folded; *p != '\0';)
+    {
+      const char *token = p;
+
+      while (*p != '\0' && g_unichar_isalnum (g_utf8_get_char (p)))
+        p = g_utf8_next_char (p);
+
+      if (p > token)
+        g_strv_builder_take (builder, g_strndup (token, p - token));
+      if (*p != '\0')
+        p = g_utf8_next_char (p);
+    }
+}
+
+static SnapshotData *
+snapshot_new (GPtrArray *entries)
+{
+  SnapshotData *snapshot = NULL;
+
+  snapshot           = snapshot_data_new ();
+  snapshot->entries  = g_ptr_array_ref (entries);
+  snapshot->tokens   = g_ptr_array_new_full (entries->len, (GDestroyNotify) g_strfreev);
+  snapshot->prefixes = g_hash_table_new_full (
+      g_str_hash, g_str_equal,
+      g_free, (GDestroyNotify) g_array_unref);
+
+  for (guint32 id = 0; id < entries->len; id++)
+    {
+      SaturnAppinfo *info              = g_ptr_array_index (entries, id);
+      g_autoptr (GStrvBuilder) builder = NULL;
+      GStrv tokens                     = NULL;
+
+      /* these never showed up in results */
+      if (saturn_appinfo_get_name (info) == NULL ||
+          saturn_appinfo_get_icon_name (info) == NULL)
+        {
+          g_ptr_array_add (snapshot->tokens, NULL);
+          continue;
+        }
+
+      builder = g_strv_builder_new ();
+      add_tokens (builder, saturn_appinfo_get_name (info));
+      for (const char *const *keyword = saturn_appinfo_get_keywords (info);
+           *keyword != NULL;
+           keyword++)
+        add_tokens (builder, *keyword);
+      tokens = g_strv_builder_end (builder);
+      g_ptr_array_add (snapshot->tokens, tokens);
+
+      for (char **token = tokens; *token != NULL; token++)
+        {
+          const char *end = *token;
+
+          for (guint i = 0; i < MAX_PREFIX_CHARS && *end != '\0'; i++)
+            {
+              g_autofree char *prefix = NULL;
+              GArray          *ids    = NULL;
+
+              end    = g_utf8_next_char (end);
+              prefix = g_strndup (*token, end - *token);
+
+              ids = g_hash_table_lookup (snapshot->prefixes, prefix);
+              if (ids == NULL)
+                {
+                  ids = g_array_new (FALSE, FALSE, sizeof (guint32));
+                  g_hash_table_replace (snapshot->prefixes, g_steal_pointer (&prefix), ids);
+                }
+
+              /* ids only ever grow, so this keeps them sorted and unique */
+              if (ids->len == 0 || g_array_index (ids, guint32, ids->len - 1) != id)
+                g_array_append_val (ids, id);
+            }
+        }
+    }
+
+  return snapshot;
+}
+
+static gboolean
+start_monitoring (SaturnAppinfoCatalogue *self)
+{
+  self->monitors = g_ptr_array_new_with_free_func (g_object_unref);
+  for (char **directory = self->directories; *directory != NULL; directory++)
+    {
+      g_autoptr (GError) local_error = NULL;
+      g_autoptr (GFile) file         = NULL;
+      GFileMonitor *monitor          = NULL;
+
+      file    = g_file_new_for_path (*directory);
+      monitor = g_file_monitor_directory (file, G_FILE_MONITOR_WATCH_MOVES, NULL, &local_error);
+      if (monitor == NULL)
+        {
+          g_debug ("Unable to monitor %s: %s", *directory, local_error->message);
+          continue;
+        }
+
+      g_signal_connect_object (
+          monitor, "changed",
+          G_CALLBACK (directory_changed),
+          self, G_CONNECT_SWAPPED);
+      g_ptr_array_add (self->monitors, monitor);
+    }
+
+  return G_SOURCE_REMOVE;
+}
+
+static gboolean
+is_desktop_file (GFile *file)
+{
+  g_autofree char *basename = NULL;
+
+  if (file == NULL)
+    return FALSE;
+
+  basename = g_file_get_basename (file);
+  return g_str_has_suffix (basename, ".desktop");
+}
+
+static void
+directory_changed (SaturnAppinfoCatalogue *self,
+                   GFile                  *file,
+                   GFile                  *other_file,
+                   GFileMonitorEvent       event,
+                   GFileMonitor           *monitor)
+{
+  switch (event)
+    {
+    case G_FILE_MONITOR_EVENT_CREATED:
+    case G_FILE_MONITOR_EVENT_CHANGES_DONE_HINT:
+    case G_FILE_MONITOR_EVENT_MOVED_IN:
+      if (is_desktop_file (file))
+        update_entry (self, file, FALSE);
+      break;
+    case G_FILE_MONITOR_EVENT_DELETED:
+    case G_FILE_MONITOR_EVENT_MOVED_OUT:
+      if (is_desktop_file (file))
+        update_entry (self, file, TRUE);
+      break;
+    case G_FILE_MONITOR_EVENT_RENAMED:
+      if (is_desktop_file (file))
+        update_entry (self, file, TRUE);
+      if (is_desktop_file (other_file))
+        update_entry (self, other_file, FALSE);
+      break;
+    default:
+      return;
+    }
+}
+
+/* re-parses (or drops) a single desktop file and swaps in a copy of the
+   entries with just that one replaced */
+static void
+update_entry (SaturnAppinfoCatalogue *self,
+              GFile                  *file,
+              gboolean                removed)
+{
+  g_autoptr (GError) local_error    = NULL;
+  g_autofree char *path             = NULL;
+  g_autoptr (SaturnAppinfo) info    = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autoptr (GPtrArray) entries     = NULL;
+  gboolean found                    = FALSE;
+
+  path = g_file_get_path (file);
+  if (!removed)
+    {
+      info = saturn_appinfo_new_from_file (path, &local_error);
+      if (info == NULL)
+        g_debug ("Unable to parse %s: %s", path, local_error->message);
+    }
+
+  snapshot = get_snapshot (self);
+  entries  = g_ptr_array_new_full (snapshot->entries->len + 1, g_object_unref);
+  for (guint i = 0; i < snapshot->entries->len; i++)
+    {
+      SaturnAppinfo *entry = g_ptr_array_index (snapshot->entries, i);
+
+      if (g_strcmp0 (saturn_appinfo_get_desktop_file (entry), path) == 0)
+        {
+          found = TRUE;
+          if (info != NULL)
+            g_ptr_array_add (entries, g_object_ref (info));
+        }
+      else
+        g_ptr_array_add (entries, g_object_ref (entry));
+    }
+
+  if (!found && info == NULL)
+    return;
+  if (!found)
+    g_ptr_array_add (entries, g_object_ref (info));
+
+  g_debug ("Desktop entry %s %s", path,
+           info == NULL ? "removed" : found ? "updated" : "added");
+  set_entries (self, entries);
+
+  g_clear_handle_id (&self->cache_write_source, g_source_remove);
+  self->cache_write_source = g_timeout_add (
+      CACHE_WRITE_DELAY_MS, (GSourceFunc) cache_write_timeout, self);
+}
+
+static gboolean
+cache_write_timeout (SaturnAppinfoCatalogue *self)
+{
+  g_autoptr (GError) local_error    = NULL;
+  g_autofree gint64 *mtimes         = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  self->cache_write_source = 0;
+
+  mtimes   = get_mtimes ((const char *const *) self->directories);
+  snapshot = get_snapshot (self);
+  if (!write_cache (
+          self->cache_path,
+          (const char *const *) self->directories,
+          mtimes, snapshot->entries,
+          &local_error))
+    g_warning ("Unable to write appinfo cache: %s", local_error->message);
+
+  return G_SOURCE_REMOVE;
+}
+
+static gint64 *
+get_mtimes (const char *const *directories)
+{
+  guint   n_directories = 0;
+  gint64 *mtimes        = NULL;
+
+  n_directories = g_strv_length ((GStrv) directories);
+  mtimes        = g_new0 (gint64, MAX (n_directories, 1));
+  for (guint i = 0; i < n_directories; i++)
+    mtimes[i] = get_mtime (directories[i]);
+
+  return mtimes;
+}
+
+static gint64
+get_mtime (const char *path)
+{
+  struct stat st = { 0 };
+
+  if (stat (path, &st) != 0)
+    return -1;
+
+  return (gint64) st.st_mtim.tv_sec * G_GINT64_CONSTANT (1000000000) + st.st_mtim.tv_nsec;
+}
+
+static gint
+cmp_strings (gconstpointer a,
+             gconstpointer b)
+{
+  return strcmp (*(const char *const *) a, *(const char *const *) b);
+}
+
+static GPtrArray *
+parse_directories (const char *const *directories)
+{
+  GPtrArray *entries = NULL;
+
+  entries = g_ptr_array_new_with_free_func (g_object_unref);
+  for (const char *const *directory = directories; *directory != NULL; directory++)
+    {
+      g_autoptr (GDir) dir        = NULL;
+      g_autoptr (GPtrArray) names = NULL;
+      const char *name            = NULL;
+
+      dir = g_dir_open (*directory, 0, NULL);
+      if (dir == NULL)
+        continue;
+
+      names = g_ptr_array_new_with_free_func (g_free);
+      while ((name = g_dir_read_name (dir)) != NULL)
+        {
+          if (g_str_has_suffix (name, ".desktop"))
+            g_ptr_array_add (names, g_strdup (name));
+        }
+      g_ptr_array_sort (names, cmp_strings);
+
+      for (guint i = 0; i < names->len; i++)
+        {
+          g_autoptr (GError) local_error = NULL;
+          g_autofree char *path          = NULL;
+          SaturnAppinfo   *info          = NULL;
+
+          path = g_build_filename (*directory, g_ptr_array_index (names, i), NULL);
+          info = saturn_appinfo_new_from_file (path, &local_error);
+          if (info != NULL)
+            g_ptr_array_add (entries, info);
+          else
+            g_debug ("Unable to parse %s: %s", path, local_error->message);
+        }
+    }
+
+  return entries;
+}
+
+static GPtrArray *
+read_cache (const char        *path,
+            const char *const *directories,
+            const gint64      *mtimes,
+            GError           **error)
+{
+  g_auto (SaturnBinaryReader) reader = { 0 };
+  guint32 n_dirs                     = 0;
+  guint32 n_entries                  = 0;
+  g_autoptr (GPtrArray) entries      = NULL;
+
+  if (!saturn_binary_reader_init (&reader, path, CACHE_MAGIC, error) ||
+      !saturn_binary_reader_read_u32 (&reader, &n_dirs, error))
+    return NULL;
+  if (n_dirs != g_strv_length ((GStrv) directories))
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                   "%s is out of date", path);
+      return NULL;
+    }
+
+  for (guint32 i = 0; i < n_dirs; i++)
+    {
+      g_autofree char *directory = NULL;
+      gint64           mtime     = 0;
+
+      if (!saturn_binary_reader_read_string (&reader, &directory, error) ||
+          !saturn_binary_reader_read_i64 (&reader, &mtime, error))
+        return NULL;
+      if (g_strcmp0 (directory, directories[i]) != 0 ||
+          mtime != mtimes[i])
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                       "%s is out of date", path);
+          return NULL;
+        }
+    }
+
+  if (!saturn_binary_reader_read_u32 (&reader, &n_entries, error))
+    return NULL;
+
+  entries = g_ptr_array_new_full (MIN (n_entries, 1 << 16), g_object_unref);
+  for (guint32 i = 0; i < n_entries; i++)
+    {
+      g_autofree char *desktop_file    = NULL;
+      g_autofree char *name            = NULL;
+      g_autofree char *exec            = NULL;
+      g_autofree char *icon_name       = NULL;
+      guint32 n_keywords               = 0;
+      g_autoptr (GStrvBuilder) builder = NULL;
+      g_auto (GStrv) keywords          = NULL;
+      guint32 flags                    = 0;
+
+      if (!saturn_binary_reader_read_string (&reader, &desktop_file, error) ||
+          !saturn_binary_reader_read_nullable_string (&reader, &name, error) ||
+          !saturn_binary_reader_read_nullable_string (&reader, &exec, error) ||
+          !saturn_binary_reader_read_nullable_string (&reader, &icon_name, error) ||
+          !saturn_binary_reader_read_u32 (&reader, &n_keywords, error))
+        return NULL;
+
+      builder = g_strv_builder_new ();
+      for (guint32 j = 0; j < n_keywords; j++)
+        {
+          char *keyword = NULL;
+
+          if (!saturn_binary_reader_read_string (&reader, &keyword, error))
+            return NULL;
+          g_strv_builder_take (builder, keyword);
+        }
+      keywords = g_strv_builder_end (builder);
+
+      if (!saturn_binary_reader_read_u32 (&reader, &flags, error))
+        return NULL;
+
+      g_ptr_array_add (
+          entries,
+          saturn_appinfo_new (
+              desktop_file, name, exec, icon_name,
+              (const char *const *) keywords,
+              (flags & ENTRY_NEEDS_TERMINAL) != 0,
+              (flags & ENTRY_STARTUP_NOTIFY) != 0));
+    }
+
+  return g_steal_pointer (&entries);
+}
+
+static gboolean
+write_cache (const char        *path,
+             const char *const *directories,
+             const gint64      *mtimes,
+             GPtrArray         *entries,
+             GError           **error)
+{
+  g_autoptr (GByteArray) out = NULL;
+  guint n_dirs               = 0;
+
+  out    = saturn_binary_writer_new (CACHE_MAGIC);
+  n_dirs = g_strv_length ((GStrv) directories);
+
+  saturn_binary_writer_add_u32 (out, n_dirs);
+  for (guint i = 0; i < n_dirs; i++)
+    {
+      saturn_binary_writer_add_string (out, directories[i]);
+      saturn_binary_writer_add_i64 (out, mtimes[i]);
+    }
+
+  saturn_binary_writer_add_u32 (out, entries->len);
+  for (guint i = 0; i < entries->len; i++)
+    {
+      SaturnAppinfo     *info     = g_ptr_array_index (entries, i);
+      const char *const *keywords = NULL;
+      guint32            flags    = 0;
+
+      saturn_binary_writer_add_string (out, saturn_appinfo_get_desktop_file (info));
+      saturn_binary_writer_add_string (out, saturn_appinfo_get_name (info));
+      saturn_binary_writer_add_string (out, saturn_appinfo_get_exec (info));
+      saturn_binary_writer_add_string (out, saturn_appinfo_get_icon_name (info));
+
+      keywords = saturn_appinfo_get_keywords (info);
+      saturn_binary_writer_add_u32 (out, g_strv_length ((GStrv) keywords));
+      for (const char *const *keyword = keywords; *keyword != NULL; keyword++)
+        saturn_binary_writer_add_string (out, *keyword);
+
+      if (saturn_appinfo_get_needs_terminal (info))
+        flags |= ENTRY_NEEDS_TERMINAL;
+      if (saturn_appinfo_get_startup_notify (info))
+        flags |= ENTRY_STARTUP_NOTIFY;
+      saturn_binary_writer_add_u32 (out, flags);
+    }
+
+  return saturn_binary_writer_save (out, path, error);
+}
+
+/* End of saturn-appinfo-catalogue.c */
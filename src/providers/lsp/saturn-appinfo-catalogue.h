@@ -0,0 +1,69 @@
+/* saturn-appinfo-catalogue.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <glib-object.h>
+
+#include "saturn-appinfo.h"
+
+G_BEGIN_DECLS
+
+/* Return FALSE to stop the query */
+typedef gboolean (*SaturnAppinfoFunc) (SaturnAppinfo *info,
+                                       gpointer       user_data);
+
+#define SATURN_TYPE_APPINFO_CATALOGUE (saturn_appinfo_catalogue_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnAppinfoCatalogue, saturn_appinfo_catalogue, SATURN, APPINFO_CATALOGUE, GObject)
+
+/* `cache_path` is where parsed entries are kept between runs */
+SaturnAppinfoCatalogue *
+saturn_appinfo_catalogue_new (const char *cache_path);
+
+/* Loads every .desktop file directly inside `directories`. As long as none
+   of the directories' mtimes changed since the cache was written, the
+   entries come straight out of the cache and no desktop file is parsed.
+   After the first load the directories are monitored from the default main
+   context, and changed desktop files are picked up one at a time */
+void
+saturn_appinfo_catalogue_load (SaturnAppinfoCatalogue *self,
+                               const char *const      *directories);
+
+/* Returns the current SaturnAppinfo entries. The array itself is never
+   modified once returned */
+GPtrArray *
+saturn_appinfo_catalogue_dup_entries (SaturnAppinfoCatalogue *self);
+
+/* Visits every entry with both a name and an icon for which each token of
+   `query` is a case insensitive prefix of some word in its name,
+   categories or keywords. Tokens are runs of alphanumeric characters */
+void
+saturn_appinfo_catalogue_query (SaturnAppinfoCatalogue *self,
+                                const char             *query,
+                                SaturnAppinfoFunc       func,
+                                gpointer                user_data);
+
+/* Bumped every time the entries change */
+guint64
+saturn_appinfo_catalogue_get_version (SaturnAppinfoCatalogue *self);
+
+G_END_DECLS
+
+/* End of saturn-appinfo-catalogue.h */
@@ -0,0 +1,288 @@
+/* saturn-appinfo.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define G_LOG_DOMAIN "SATURN::APPINFO"
+
+#include "saturn-appinfo.h"
+
+#define DESKTOP_GROUP "Desktop Entry"
+
+struct _SaturnAppinfo
+{
+  GObject parent_instance;
+
+  char    *desktop_file;
+  char    *name;
+  char    *exec;
+  char    *icon_name;
+  GStrv    keywords;
+  gboolean needs_terminal;
+  gboolean startup_notify;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnAppinfo, saturn_appinfo, G_TYPE_OBJECT);
+
+enum
+{
+  PROP_0,
+
+  PROP_DESKTOP_FILE,
+  PROP_NAME,
+  PROP_EXEC,
+  PROP_ICON_NAME,
+  PROP_NEEDS_TERMINAL,
+  PROP_STARTUP_NOTIFY,
+
+  LAST_PROP
+};
+static GParamSpec *props[LAST_PROP] = { 0 };
+
+static void
+saturn_appinfo_dispose (GObject *object)
+{
+  SaturnAppinfo *self = SATURN_APPINFO (object);
+
+  g_clear_pointer (&self->desktop_file, g_free);
+  g_clear_pointer (&self->name, g_free);
+  g_clear_pointer (&self->exec, g_free);
+  g_clear_pointer (&self->icon_name, g_free);
+  g_clear_pointer (&self->keywords, g_strfreev);
+
+  G_OBJECT_CLASS (saturn_appinfo_parent_class)->dispose (object);
+}
+
+static void
+saturn_appinfo_get_property (GObject    *object,
+                             guint       prop_id,
+                             GValue     *value,
+                             GParamSpec *pspec)
+{
+  SaturnAppinfo *self = SATURN_APPINFO (object);
+
+  switch (prop_id)
+    {
+    case PROP_DESKTOP_FILE:
+      g_value_set_string (value, self->desktop_file);
+      break;
+    case PROP_NAME:
+      g_value_set_string (value, self->name);
+      break;
+    case PROP_EXEC:
+      g_value_set_string (value, self->exec);
+      break;
+    case PROP_ICON_NAME:
+      g_value_set_string (value, self->icon_name);
+      break;
+    case PROP_NEEDS_TERMINAL:
+      g_value_set_boolean (value, self->needs_terminal);
+      break;
+    case PROP_STARTUP_NOTIFY:
+      g_value_set_boolean (value, self->startup_notify);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+    }
+}
+
+static void
+saturn_appinfo_class_init (SaturnAppinfoClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->get_property = saturn_appinfo_get_property;
+  object_class->dispose      = saturn_appinfo_dispose;
+
+  props[PROP_DESKTOP_FILE] =
+      g_param_spec_string (
+          "desktop-file",
+          NULL, NULL, NULL,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  props[PROP_NAME] =
+      g_param_spec_string (
+          "name",
+          NULL, NULL, NULL,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  props[PROP_EXEC] =
+      g_param_spec_string (
+          "exec",
+          NULL, NULL, NULL,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  props[PROP_ICON_NAME] =
+      g_param_spec_string (
+          "icon-name",
+          NULL, NULL, NULL,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  props[PROP_NEEDS_TERMINAL] =
+      g_param_spec_boolean (
+          "needs-terminal",
+          NULL, NULL, FALSE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  props[PROP_STARTUP_NOTIFY] =
+      g_param_spec_boolean (
+          "startup-notify",
+          NULL, NULL, FALSE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  g_object_class_install_properties (object_class, LAST_PROP, props);
+}
+
+static void
+saturn_appinfo_init (SaturnAppinfo *self)
+{
+}
+
+SaturnAppinfo *
+saturn_appinfo_new (const char        *desktop_file,
+                    const char        *name,
+                    const char        *exec,
+                    const char        *icon_name,
+                    const char *const *keywords,
+                    gboolean           needs_terminal,
+                    gboolean           startup_notify)
+{
+  SaturnAppinfo *self = NULL;
+
+  g_return_val_if_fail (desktop_file != NULL, NULL);
+
+  self                 = g_object_new (SATURN_TYPE_APPINFO, NULL);
+  self->desktop_file   = g_strdup (desktop_file);
+  self->name           = g_strdup (name);
+  self->exec           = g_strdup (exec);
+  self->icon_name      = g_strdup (icon_name);
+  self->keywords       = keywords != NULL ? g_strdupv ((GStrv) keywords) : g_new0 (char *, 1);
+  self->needs_terminal = needs_terminal;
+  self->startup_notify = startup_notify;
+
+  return self;
+}
+
+static void
+append_list (GStrvBuilder *builder,
+             const char   *list)
+{
+  g_auto (GStrv) items = NULL;
+
+  if (list == NULL)
+    return;
+
+  items = g_strsplit (list, ";", -1);
+  for (char **item = items; *item != NULL; item++)
+    {
+      if (**item != '\0')
+        g_strv_builder_add (builder, *item);
+    }
+}
+
+SaturnAppinfo *
+saturn_appinfo_new_from_file (const char *desktop_file,
+                              GError    **error)
+{
+  g_autoptr (GKeyFile) keyfile     = NULL;
+  g_autofree char *name            = NULL;
+  g_autofree char *exec            = NULL;
+  g_autofree char *icon_name       = NULL;
+  g_autofree char *categories      = NULL;
+  g_autofree char *keywords        = NULL;
+  g_autoptr (GStrvBuilder) builder = NULL;
+  g_auto (GStrv) keyword_list      = NULL;
+  gboolean needs_terminal          = FALSE;
+  gboolean startup_notify          = FALSE;
+
+  g_return_val_if_fail (desktop_file != NULL, NULL);
+
+  keyfile = g_key_file_new ();
+  if (!g_key_file_load_from_file (keyfile, desktop_file, G_KEY_FILE_NONE, error))
+    return NULL;
+
+  /* missing keys are simply left unset */
+  name           = g_key_file_get_string (keyfile, DESKTOP_GROUP, "Name", NULL);
+  exec           = g_key_file_get_string (keyfile, DESKTOP_GROUP, "Exec", NULL);
+  icon_name      = g_key_file_get_string (keyfile, DESKTOP_GROUP, "Icon", NULL);
+  categories     = g_key_file_get_string (keyfile, DESKTOP_GROUP, "Categories", NULL);
+  keywords       = g_key_file_get_string (keyfile, DESKTOP_GROUP, "Keywords", NULL);
+  needs_terminal = g_key_file_get_boolean (keyfile, DESKTOP_GROUP, "Terminal", NULL);
+  startup_notify = g_key_file_get_boolean (keyfile, DESKTOP_GROUP, "StartupNotify", NULL);
+
+  builder = g_strv_builder_new ();
+  append_list (builder, categories);
+  append_list (builder, keywords);
+  keyword_list = g_strv_builder_end (builder);
+
+  return saturn_appinfo_new (
+      desktop_file, name, exec, icon_name,
+      (const char *const *) keyword_list,
+      needs_terminal, startup_notify);
+}
+
+const char *
+saturn_appinfo_get_desktop_file (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), NULL);
+  return self->desktop_file;
+}
+
+const char *
+saturn_appinfo_get_name (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), NULL);
+  return self->name;
+}
+
+const char *
+saturn_appinfo_get_exec (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), NULL);
+  return self->exec;
+}
+
+const char *
+saturn_appinfo_get_icon_name (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), NULL);
+  return self->icon_name;
+}
+
+const char *const *
+saturn_appinfo_get_keywords (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), NULL);
+  return (const char *const *) self->keywords;
+}
+
+gboolean
+saturn_appinfo_get_needs_terminal (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), FALSE);
+  return self->needs_terminal;
+}
+
+gboolean
+saturn_appinfo_get_startup_notify (SaturnAppinfo *self)
+{
+  g_return_val_if_fail (SATURN_IS_APPINFO (self), FALSE);
+  return self->startup_notify;
+}
+
+/* End of saturn-appinfo.c */
@@ -0,0 +1,68 @@
+/* saturn-appinfo.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_APPINFO (saturn_appinfo_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnAppinfo, saturn_appinfo, SATURN, APPINFO, GObject)
+
+/* The handful of desktop entry fields the appinfo provider cares about */
+SaturnAppinfo *
+saturn_appinfo_new (const char        *desktop_file,
+                    const char        *name,
+                    const char        *exec,
+                    const char        *icon_name,
+                    const char *const *keywords,
+                    gboolean           needs_terminal,
+                    gboolean           startup_notify);
+
+SaturnAppinfo *
+saturn_appinfo_new_from_file (const char *desktop_file,
+                              GError    **error);
+
+const char *
+saturn_appinfo_get_desktop_file (SaturnAppinfo *self);
+
+const char *
+saturn_appinfo_get_name (SaturnAppinfo *self);
+
+const char *
+saturn_appinfo_get_exec (SaturnAppinfo *self);
+
+const char *
+saturn_appinfo_get_icon_name (SaturnAppinfo *self);
+
+/* Categories followed by keywords, never NULL */
+const char *const *
+saturn_appinfo_get_keywords (SaturnAppinfo *self);
+
+gboolean
+saturn_appinfo_get_needs_terminal (SaturnAppinfo *self);
+
+gboolean
+saturn_appinfo_get_startup_notify (SaturnAppinfo *self);
+
+G_END_DECLS
+
+/* End of saturn-appinfo.h */
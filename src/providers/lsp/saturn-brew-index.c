@@ -0,0 +1,477 @@
+/* saturn-brew-index.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+/* Asking brew itself means booting a Ruby interpreter on the host, which
+   takes seconds, so every formula is listed once and searched locally from
+   then on. The listing is kept in a saturn-binary-file.h file laid out as
+
+     magic
+     gint64 time of the listing in seconds
+     guint32 n_formulae, then each formula's name and description
+
+   Readers only ever see whole snapshots of the formulae, which are swapped
+   in under a lock once a rebuild is done. */
+
+#define G_LOG_DOMAIN "SATURN::BREW-INDEX"
+
+#include <string.h>
+
+#include "saturn-binary-file.h"
+#include "saturn-brew-index.h"
+#include "util.h"
+
+#define CACHE_MAGIC "SATBREW1"
+
+typedef struct
+{
+  char *name;
+  char *description;
+  /* casefolded, for matching */
+  char *folded_name;
+  char *folded_description;
+} Formula;
+
+SATURN_DEFINE_DATA (
+    snapshot,
+    Snapshot,
+    {
+      /* when brew was last asked, in seconds, 0 if never */
+      gint64     updated;
+      /* Formula */
+      GPtrArray *formulae;
+    },
+    SATURN_RELEASE_DATA (formulae, g_ptr_array_unref));
+
+SATURN_DEFINE_DATA (
+    refresh,
+    Refresh,
+    {
+      SaturnBrewIndex *self;
+      GStrv            argv;
+    },
+    SATURN_RELEASE_DATA (self, g_object_unref);
+    SATURN_RELEASE_DATA (argv, g_strfreev));
+
+struct _SaturnBrewIndex
+{
+  GObject parent_instance;
+
+  char *cache_path;
+
+  GMutex        mutex;
+  gboolean      loaded;
+  SnapshotData *snapshot;
+  gboolean      refreshing;
+  /* when a rebuild was last started, in seconds */
+  gint64        attempted;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnBrewIndex, saturn_brew_index, G_TYPE_OBJECT);
+
+static Formula *
+formula_new (const char *name,
+             const char *description);
+
+static void
+formula_free (Formula *formula);
+
+static SnapshotData *
+snapshot_new (GPtrArray *formulae,
+              gint64     updated);
+
+static SnapshotData *
+get_snapshot (SaturnBrewIndex *self);
+
+static void
+set_snapshot (SaturnBrewIndex *self,
+              SnapshotData    *snapshot);
+
+static gpointer
+refresh_thread (RefreshData *data);
+
+static GPtrArray *
+list_formulae (const char *const *argv,
+               GError           **error);
+
+static SnapshotData *
+read_cache (const char *path,
+            GError    **error);
+
+static gboolean
+write_cache (const char   *path,
+             SnapshotData *snapshot,
+             GError      **error);
+
+static void
+saturn_brew_index_dispose (GObject *object)
+{
+  SaturnBrewIndex *self = SATURN_BREW_INDEX (object);
+
+  g_clear_pointer (&self->cache_path, g_free);
+  g_clear_pointer (&self->snapshot, snapshot_data_unref);
+
+  G_OBJECT_CLASS (saturn_brew_index_parent_class)->dispose (object);
+}
+
+static void
+saturn_brew_index_finalize (GObject *object)
+{
+  SaturnBrewIndex *self = SATURN_BREW_INDEX (object);
+
+  g_mutex_clear (&self->mutex);
+
+  G_OBJECT_CLASS (saturn_brew_index_parent_class)->finalize (object);
+}
+
+static void
+saturn_brew_index_class_init (SaturnBrewIndexClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_brew_index_dispose;
+  object_class->finalize = saturn_brew_index_finalize;
+}
+
+static void
+saturn_brew_index_init (SaturnBrewIndex *self)
+{
+  g_autoptr (GPtrArray) formulae = NULL;
+
+  g_mutex_init (&self->mutex);
+
+  formulae       = g_ptr_array_new_with_free_func ((GDestroyNotify) formula_free);
+  self->snapshot = snapshot_new (formulae, 0);
+}
+
+SaturnBrewIndex *
+saturn_brew_index_new (const char *cache_path)
+{
+  SaturnBrewIndex *self = NULL;
+
+  g_return_val_if_fail (cache_path != NULL, NULL);
+
+  self             = g_object_new (SATURN_TYPE_BREW_INDEX, NULL);
+  self->cache_path = g_strdup (cache_path);
+
+  return self;
+}
+
+void
+saturn_brew_index_refresh (SaturnBrewIndex   *self,
+                           const char *const *argv,
+                           gint64             max_age)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+  gint64       now                  = 0;
+  RefreshData *data                 = NULL;
+
+  g_return_if_fail (SATURN_IS_BREW_INDEX (self));
+  g_return_if_fail (argv != NULL && argv[0] != NULL);
+
+  snapshot = get_snapshot (self);
+  now      = g_get_real_time () / G_USEC_PER_SEC;
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker = g_mutex_locker_new (&self->mutex);
+    if (self->refreshing ||
+        now - MAX (snapshot->updated, self->attempted) < max_age)
+      return;
+
+    self->refreshing = TRUE;
+    self->attempted  = now;
+  }
+
+  data       = refresh_data_new ();
+  data->self = g_object_ref (self);
+  data->argv = g_strdupv ((GStrv) argv);
+
+  g_thread_unref (g_thread_new (
+      "Brew Index",
+      (GThreadFunc) refresh_thread,
+      data));
+}
+
+void
+saturn_brew_index_query (SaturnBrewIndex *self,
+                         const char      *query,
+                         SaturnBrewFunc   func,
+                         gpointer         user_data)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autofree char *folded           = NULL;
+
+  g_return_if_fail (SATURN_IS_BREW_INDEX (self));
+  g_return_if_fail (query != NULL);
+  g_return_if_fail (func != NULL);
+
+  if (*query == '\0')
+    return;
+
+  snapshot = get_snapshot (self);
+  folded   = g_utf8_casefold (query, -1);
+
+  for (guint i = 0; i < snapshot->formulae->len; i++)
+    {
+      Formula *formula = g_ptr_array_index (snapshot->formulae, i);
+
+      if (strstr (formula->folded_name, folded) == NULL &&
+          strstr (formula->folded_description, folded) == NULL)
+        continue;
+
+      if (!func (formula->name, formula->description, user_data))
+        break;
+    }
+}
+
+static Formula *
+formula_new (const char *name,
+             const char *description)
+{
+  Formula *formula = NULL;
+
+  formula                     = g_new0 (Formula, 1);
+  formula->name               = g_strdup (name);
+  formula->description        = g_strdup (description);
+  formula->folded_name        = g_utf8_casefold (name, -1);
+  formula->folded_description = g_utf8_casefold (description, -1);
+
+  return formula;
+}
+
+static void
+formula_free (Formula *formula)
+{
+  g_free (formula->name);
+  g_free (formula->description);
+  g_free (formula->folded_name);
+  g_free (formula->folded_description);
+  g_free (formula);
+}
+
+static SnapshotData *
+snapshot_new (GPtrArray *formulae,
+              gint64     updated)
+{
+  SnapshotData *snapshot = NULL;
+
+  snapshot           = snapshot_data_new ();
+  snapshot->updated  = updated;
+  snapshot->formulae = g_ptr_array_ref (formulae);
+
+  return snapshot;
+}
+
+static SnapshotData *
+get_snapshot (SaturnBrewIndex *self)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&self->mutex);
+
+  if (!self->loaded)
+    {
+      g_autoptr (GError) local_error    = NULL;
+      g_autoptr (SnapshotData) snapshot = NULL;
+
+      self->loaded = TRUE;
+
+      snapshot = read_cache (self->cache_path, &local_error);
+      if (snapshot != NULL)
+        {
+          g_clear_pointer (&self->snapshot, snapshot_data_unref);
+          self->snapshot = g_steal_pointer (&snapshot);
+        }
+      else if (!g_error_matches (local_error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+        g_warning ("Unable to read brew index: %s", local_error->message);
+    }
+
+  return snapshot_data_ref (self->snapshot);
+}
+
+static void
+set_snapshot (SaturnBrewIndex *self,
+              SnapshotData    *snapshot)
+{
+  g_autoptr (SnapshotData) old = NULL;
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker         = g_mutex_locker_new (&self->mutex);
+    old            = g_steal_pointer (&self->snapshot);
+    self->snapshot = snapshot_data_ref (snapshot);
+    self->loaded   = TRUE;
+  }
+
+  /* old is released outside of the lock */
+}
+
+static gpointer
+refresh_thread (RefreshData *data)
+{
+  g_autoptr (RefreshData) owned     = data;
+  g_autoptr (GError) local_error    = NULL;
+  g_autoptr (GPtrArray) formulae    = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  formulae = list_formulae ((const char *const *) data->argv, &local_error);
+  if (formulae != NULL)
+    {
+      snapshot = snapshot_new (formulae, g_get_real_time () / G_USEC_PER_SEC);
+      set_snapshot (data->self, snapshot);
+
+      if (!write_cache (data->self->cache_path, snapshot, &local_error))
+        g_warning ("Unable to write brew index: %s", local_error->message);
+    }
+  else if (g_error_matches (local_error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND))
+    /* plenty of people simply don't use brew */
+    g_debug ("Not listing brew formulae: %s", local_error->message);
+  else
+    g_warning ("Unable to list brew formulae: %s", local_error->message);
+
+  g_mutex_lock (&data->self->mutex);
+  data->self->refreshing = FALSE;
+  g_mutex_unlock (&data->self->mutex);
+
+  return NULL;
+}
+
+static GPtrArray *
+list_formulae (const char *const *argv,
+               GError           **error)
+{
+  g_autoptr (GSubprocess) subprocess = NULL;
+  g_autoptr (GError) local_error     = NULL;
+  g_autofree char *output            = NULL;
+  g_autoptr (GPtrArray) formulae     = NULL;
+  char            *line              = NULL;
+  char            *next              = NULL;
+
+  subprocess = g_subprocess_newv (
+      argv,
+      G_SUBPROCESS_FLAGS_STDOUT_PIPE |
+          G_SUBPROCESS_FLAGS_STDERR_SILENCE,
+      &local_error);
+  if (subprocess == NULL)
+    {
+      if (g_error_matches (local_error, G_SPAWN_ERROR, G_SPAWN_ERROR_NOENT))
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                     "%s was not found", argv[0]);
+      else
+        g_propagate_error (error, g_steal_pointer (&local_error));
+      return NULL;
+    }
+
+  if (!g_subprocess_communicate_utf8 (subprocess, NULL, NULL, &output, NULL, error))
+    return NULL;
+  /* 127 is what a wrapper like flatpak-spawn exits with when the command
+     itself is missing */
+  if (g_subprocess_get_if_exited (subprocess) &&
+      g_subprocess_get_exit_status (subprocess) == 127)
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                   "%s could not find the command to run", argv[0]);
+      return NULL;
+    }
+  if (!g_subprocess_get_successful (subprocess))
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                   "%s did not exit successfully", argv[0]);
+      return NULL;
+    }
+
+  formulae = g_ptr_array_new_with_free_func ((GDestroyNotify) formula_free);
+  for (line = output; line != NULL && *line != '\0'; line = next)
+    {
+      char *separator = NULL;
+
+      next = strchr (line, '\n');
+      if (next != NULL)
+        *next++ = '\0';
+
+      /* section headers look like "==> Formulae" */
+      if (g_str_has_prefix (line, "==>"))
+        continue;
+
+      separator = strstr (line, ": ");
+      if (separator == NULL || separator == line)
+        continue;
+      *separator = '\0';
+
+      g_ptr_array_add (formulae, formula_new (line, g_strstrip (separator + 2)));
+    }
+
+  return g_steal_pointer (&formulae);
+}
+
+static SnapshotData *
+read_cache (const char *path,
+            GError    **error)
+{
+  g_auto (SaturnBinaryReader) reader = { 0 };
+  gint64  updated                    = 0;
+  guint32 n_formulae                 = 0;
+  g_autoptr (GPtrArray) formulae     = NULL;
+
+  if (!saturn_binary_reader_init (&reader, path, CACHE_MAGIC, error) ||
+      !saturn_binary_reader_read_i64 (&reader, &updated, error) ||
+      !saturn_binary_reader_read_u32 (&reader, &n_formulae, error))
+    return NULL;
+
+  formulae = g_ptr_array_new_full (MIN (n_formulae, 1 << 16), (GDestroyNotify) formula_free);
+  for (guint32 i = 0; i < n_formulae; i++)
+    {
+      g_autofree char *name        = NULL;
+      g_autofree char *description = NULL;
+
+      if (!saturn_binary_reader_read_string (&reader, &name, error) ||
+          !saturn_binary_reader_read_string (&reader, &description, error))
+        return NULL;
+
+      g_ptr_array_add (formulae, formula_new (name, description));
+    }
+
+  return snapshot_new (formulae, updated);
+}
+
+static gboolean
+write_cache (const char   *path,
+             SnapshotData *snapshot,
+             GError      **error)
+{
+  g_autoptr (GByteArray) out = NULL;
+
+  out = saturn_binary_writer_new (CACHE_MAGIC);
+  saturn_binary_writer_add_i64 (out, snapshot->updated);
+
+  saturn_binary_writer_add_u32 (out, snapshot->formulae->len);
+  for (guint i = 0; i < snapshot->formulae->len; i++)
+    {
+      Formula *formula = g_ptr_array_index (snapshot->formulae, i);
+
+      saturn_binary_writer_add_string (out, formula->name);
+      saturn_binary_writer_add_string (out, formula->description);
+    }
+
+  return saturn_binary_writer_save (out, path, error);
+}
+
+/* End of saturn-brew-index.c */
@@ -0,0 +1,61 @@
+/* saturn-brew-index.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_BREW_INDEX (saturn_brew_index_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnBrewIndex, saturn_brew_index, SATURN, BREW_INDEX, GObject)
+
+/* Return FALSE to stop the query */
+typedef gboolean (*SaturnBrewFunc) (const char *name,
+                                    const char *description,
+                                    gpointer    user_data);
+
+/* `cache_path` is where the index is kept between runs. Nothing is read
+   until the index is first used */
+SaturnBrewIndex *
+saturn_brew_index_new (const char *cache_path);
+
+/* Unless the index was rebuilt less than `max_age` seconds ago, or a
+   rebuild is already underway, runs `argv` on a thread of its own and
+   replaces the index with what it printed. `argv` has to list every formula
+   as "name: description" lines, the way `brew search --desc` does. A failed
+   rebuild isn't retried before `max_age` passes either. Returns right
+   away */
+void
+saturn_brew_index_refresh (SaturnBrewIndex   *self,
+                           const char *const *argv,
+                           gint64             max_age);
+
+/* Visits every formula whose name or description contains `query`,
+   ignoring case, in the order brew listed them. Safe to call from any
+   thread */
+void
+saturn_brew_index_query (SaturnBrewIndex *self,
+                         const char      *query,
+                         SaturnBrewFunc   func,
+                         gpointer         user_data);
+
+G_END_DECLS
+
+/* End of saturn-brew-index.h */
@@ -0,0 +1,318 @@
+/* saturn-calc.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* A Pratt parser which evaluates as it goes, so the expression is scanned
+   exactly once and each step is recorded the moment it's computed. Nothing
+   in here allocates outside of lisp, since a condition signalled by the
+   arithmetic itself unwinds straight through these frames, and callers have
+   to hold to the same rule. The checks in apply_operator() keep the usual
+   culprits from ever getting that far. */
+
+#define G_LOG_DOMAIN "SATURN::CALC"
+
+#include "saturn-calc.h"
+
+#define MAX_DEPTH       256
+/* beyond this, a power would take ages and eat all memory */
+#define MAX_RESULT_BITS (1 << 20)
+
+typedef struct
+{
+  char        symbol;
+  const char *name;
+  int         precedence;
+} Operator;
+
+static const Operator operators[] = {
+  { '+', "+",    1 },
+  { '-', "-",    1 },
+  { '*', "*",    2 },
+  { '/', "/",    2 },
+  { '%', "MOD",  2 },
+  { '^', "EXPT", 3 },
+};
+
+typedef struct
+{
+  const char *p;
+  guint       depth;
+  /* newest first */
+  cl_object steps;
+} Parser;
+
+static gboolean
+parse_expression (Parser    *parser,
+                  int        min_precedence,
+                  cl_object *out,
+                  GError   **error);
+
+static gboolean
+parse_primary (Parser    *parser,
+               cl_object *out,
+               GError   **error);
+
+static gboolean
+apply_operator (const Operator *op,
+                cl_object       left,
+                cl_object       right,
+                cl_object      *out,
+                GError        **error);
+
+static gboolean
+power_too_large (cl_object base,
+                 cl_object exponent);
+
+static void
+skip_spaces (Parser *parser);
+
+cl_object
+saturn_calc_evaluate (const char *expression,
+                      cl_object  *steps,
+                      GError    **error)
+{
+  Parser    parser = { 0 };
+  cl_object result = ECL_NIL;
+
+  g_return_val_if_fail (expression != NULL, ECL_NIL);
+
+  parser.p     = expression;
+  parser.steps = ECL_NIL;
+
+  if (!parse_expression (&parser, 0, &result, error))
+    return ECL_NIL;
+
+  skip_spaces (&parser);
+  if (*parser.p != '\0')
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                   "Unexpected '%c'", *parser.p);
+      return ECL_NIL;
+    }
+
+  if (steps != NULL)
+    *steps = cl_nreverse (parser.steps);
+  return result;
+}
+
+static gboolean
+parse_expression (Parser    *parser,
+                  int        min_precedence,
+                  cl_object *out,
+                  GError   **error)
+{
+  cl_object left = ECL_NIL;
+
+  if (!parse_primary (parser, &left, error))
+    return FALSE;
+
+  for (;;)
+    {
+      const Operator *op     = NULL;
+      cl_object       right  = ECL_NIL;
+      cl_object       result = ECL_NIL;
+
+      skip_spaces (parser);
+      for (guint i = 0; i < G_N_ELEMENTS (operators); i++)
+        {
+          if (operators[i].symbol == *parser->p)
+            {
+              op = &operators[i];
+              break;
+            }
+        }
+
+      /* anything binding no tighter is left to whoever called us, which is
+         what makes every operator left associative */
+      if (op == NULL || op->precedence <= min_precedence)
+        break;
+      parser->p++;
+
+      if (!parse_expression (parser, op->precedence, &right, error) ||
+          !apply_operator (op, left, right, &result, error))
+        return FALSE;
+
+      parser->steps = ecl_cons (
+          cl_list (4, left, ecl_make_constant_base_string (op->name, -1), right, result),
+          parser->steps);
+      left = result;
+    }
+
+  *out = left;
+  return TRUE;
+}
+
+static gboolean
+parse_primary (Parser    *parser,
+               cl_object *out,
+               GError   **error)
+{
+  skip_spaces (parser);
+
+  if (g_ascii_isdigit (*parser->p))
+    {
+      cl_object value = ecl_make_fixnum (0);
+
+      /* a machine word's worth of digits at a time */
+      while (g_ascii_isdigit (*parser->p))
+        {
+          guint64 chunk = 0;
+          guint64 scale = 1;
+
+          for (guint i = 0; i < 18 && g_ascii_isdigit (*parser->p); i++)
+            {
+              chunk = chunk * 10 + (*parser->p - '0');
+              scale *= 10;
+              parser->p++;
+            }
+
+          value = ecl_plus (
+              ecl_times (value, ecl_make_unsigned_integer (scale)),
+              ecl_make_unsigned_integer (chunk));
+        }
+
+      *out = value;
+      return TRUE;
+    }
+
+  if (*parser->p == '(')
+    {
+      if (++parser->depth > MAX_DEPTH)
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                       "Parentheses nested too deeply");
+          return FALSE;
+        }
+      parser->p++;
+
+      if (!parse_expression (parser, 0, out, error))
+        return FALSE;
+
+      skip_spaces (parser);
+      if (*parser->p != ')')
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                       "Unbalanced parentheses");
+          return FALSE;
+        }
+      parser->p++;
+      parser->depth--;
+
+      return TRUE;
+    }
+
+  if (*parser->p == '\0')
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                 "Unexpected end of expression");
+  else
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                 "Unexpected '%c'", *parser->p);
+  return FALSE;
+}
+
+static gboolean
+apply_operator (const Operator *op,
+                cl_object       left,
+                cl_object       right,
+                cl_object      *out,
+                GError        **error)
+{
+  cl_object result = ECL_NIL;
+
+  switch (op->symbol)
+    {
+    case '+':
+      result = ecl_plus (left, right);
+      break;
+    case '-':
+      result = ecl_minus (left, right);
+      break;
+    case '*':
+      result = ecl_times (left, right);
+      break;
+    case '/':
+    case '%':
+      if (ecl_zerop (right))
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                       "Division by zero");
+          return FALSE;
+        }
+      result = op->symbol == '/'
+                   ? ecl_divide (left, right)
+                   : cl_mod (left, right);
+      break;
+    case '^':
+      if (ecl_zerop (left) &&
+          !Null (cl_realp (right)) &&
+          ecl_minusp (right))
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                       "Division by zero");
+          return FALSE;
+        }
+      if (power_too_large (left, right))
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                       "Result too large");
+          return FALSE;
+        }
+      result = cl_expt (left, right);
+      break;
+    default:
+      g_assert_not_reached ();
+    }
+
+  *out = result;
+  return TRUE;
+}
+
+static gboolean
+power_too_large (cl_object base,
+                 cl_object exponent)
+{
+  cl_object bits = ECL_NIL;
+
+  /* a float result can't outgrow its word */
+  if (Null (cl_rationalp (base)) || Null (cl_integerp (exponent)))
+    return FALSE;
+  /* 0, 1 and -1 stay put however large the exponent */
+  if (!Null (cl_integerp (base)) &&
+      ecl_number_compare (cl_abs (base), ecl_make_fixnum (1)) <= 0)
+    return FALSE;
+
+  /* a power takes about as many bits as its base times the exponent, so
+     the size is known before any of the work is done */
+  bits = ecl_plus (
+      cl_integer_length (cl_numerator (base)),
+      cl_integer_length (cl_denominator (base)));
+  return ecl_number_compare (
+             ecl_times (bits, cl_abs (exponent)),
+             ecl_make_fixnum (MAX_RESULT_BITS))
+         > 0;
+}
+
+static void
+skip_spaces (Parser *parser)
+{
+  while (*parser->p == ' ')
+    parser->p++;
+}
+
+/* End of saturn-calc.c */
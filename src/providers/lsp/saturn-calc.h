@@ -0,0 +1,44 @@
+/* saturn-calc.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <ecl/ecl.h>
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* Evaluates an arithmetic expression of non-negative integers, parentheses
+   and the binary operators + - * / % ^, all left associative, with ^
+   binding tightest and + - loosest. Arithmetic is done on lisp numbers, so
+   integers never overflow and / yields exact rationals. On success the
+   result is returned, and `steps` receives a list of (left op right result)
+   lists in the order they were evaluated, op being the operator's name.
+   Must be called from a thread known to lisp, holding nothing allocated
+   outside of it, since a condition signalled by the arithmetic unwinds
+   through the caller too */
+cl_object
+saturn_calc_evaluate (const char *expression,
+                      cl_object  *steps,
+                      GError    **error);
+
+G_END_DECLS
+
+/* End of saturn-calc.h */
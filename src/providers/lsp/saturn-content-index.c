@@ -0,0 +1,1166 @@
+/* saturn-content-index.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* A codesearch style inverted index from every byte trigram occurring in a
+   file's contents to the files containing it. A literal needle can only
+   occur in files which contain all of its trigrams, so a query decodes and
+   intersects a handful of posting lists and the content searcher only has
+   to verify the survivors.
+
+   The index lives in a base file and a smaller delta file next to it,
+   which share a layout and are mapped as is:
+
+     Header
+     FileRecord[n_files]         path, mtime and size of every file
+     strings                     NUL terminated paths
+     TrigramRecord[n_trigrams]   sorted by trigram
+     postings                    LEB128 deltas of ascending file ids
+
+   The index remembers which version of the file index it has caught up
+   to, so a query only has to add whatever was published to the file index
+   since, which is nothing most of the time. An update reads just those new
+   files and rewrites the delta, carrying over its postings as they are.
+   Once the delta grows too large, or the file index is replaced by a
+   rescan, the delta is merged: every file is stat'ed again, the postings
+   of those whose mtime and size are unchanged are reused, the rest are
+   read, and a new base is written. Edits to files which are already
+   indexed are therefore only picked up by a merge. A delta only belongs to
+   the base of the same generation, so one left over from before a merge is
+   ignored. Trigrams spanning a newline are never stored since a needle is
+   always a single line. */
+
+#define G_LOG_DOMAIN "SATURN::CONTENT-INDEX"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "saturn-content-index.h"
+#include "util.h"
+
+#define INDEX_MAGIC         "SATCIDX"
+#define INDEX_VERSION       1
+#define TRIGRAM_LENGTH      3
+#define N_TRIGRAMS          (1 << 24)
+#define BINARY_SNIFF_LENGTH 8192
+/* anything bigger, or with more distinct trigrams than this, would mostly
+   bloat the index and is simply always verified */
+#define MAX_INDEXED_SIZE     (1024 * 1024)
+#define MAX_INDEXED_TRIGRAMS 20000
+/* the delta is merged once it holds more files than this, or than an
+   eighth of the base if that is more */
+#define MAX_DELTA_FILES 4096
+
+enum
+{
+  FILE_BINARY    = 1 << 0,
+  FILE_UNINDEXED = 1 << 1,
+};
+
+typedef struct
+{
+  char    magic[8];
+  guint32 version;
+  guint32 n_files;
+  guint32 n_trigrams;
+  guint32 generation;
+  guint64 files_offset;
+  guint64 strings_offset;
+  guint64 strings_size;
+  guint64 trigrams_offset;
+  guint64 postings_offset;
+  guint64 postings_size;
+} Header;
+
+typedef struct
+{
+  guint64 path;
+  gint64  mtime;
+  guint64 size;
+  guint32 flags;
+  guint32 reserved;
+} FileRecord;
+
+typedef struct
+{
+  guint32 trigram;
+  guint32 n_postings;
+  guint64 offset;
+} TrigramRecord;
+
+SATURN_DEFINE_DATA (
+    segment,
+    Segment,
+    {
+      GMappedFile         *mapped;
+      const Header        *header;
+      const FileRecord    *files;
+      const char          *strings;
+      const TrigramRecord *trigrams;
+      const guint8        *postings;
+      /* guint32 ids of the files which are always candidates */
+      GArray *unindexed;
+    },
+    SATURN_RELEASE_DATA (mapped, g_mapped_file_unref);
+    SATURN_RELEASE_DATA (unindexed, g_array_unref));
+
+SATURN_DEFINE_DATA (
+    snapshot,
+    Snapshot,
+    {
+      SegmentData *base;
+      /* may be NULL, its ids follow the base's */
+      SegmentData *delta;
+      /* the file index this is up to date with as of `files_version`, or
+         NULL if it was loaded from disk and has yet to be merged */
+      SaturnFileIndex *files;
+      guint64          files_version;
+    },
+    SATURN_RELEASE_DATA (base, segment_data_unref);
+    SATURN_RELEASE_DATA (delta, segment_data_unref);
+    SATURN_RELEASE_DATA (files, g_object_unref));
+
+typedef struct
+{
+  GArray  *records;
+  GString *strings;
+  /* trigram -> GArray of guint32 ids */
+  GHashTable *postings;
+  guint8     *seen;
+  GArray     *touched;
+  GByteArray *buffer;
+} Builder;
+
+struct _SaturnContentIndex
+{
+  GObject parent_instance;
+
+  char *path;
+  char *delta_path;
+
+  /* only guards the snapshot pointer, so taking a reference is cheap */
+  GMutex        snapshot_mutex;
+  SnapshotData *snapshot;
+
+  /* serializes loads and updates */
+  GMutex update_mutex;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnContentIndex, saturn_content_index, G_TYPE_OBJECT);
+
+static void
+builder_init (Builder *builder);
+
+static void
+builder_clear (Builder *builder);
+
+G_DEFINE_AUTO_CLEANUP_CLEAR_FUNC (Builder, builder_clear);
+
+static SnapshotData *
+get_snapshot (SaturnContentIndex *self);
+
+static void
+set_snapshot (SaturnContentIndex *self,
+              SnapshotData       *snapshot);
+
+static SnapshotData *
+update_delta (SaturnContentIndex *self,
+              SnapshotData       *old,
+              GPtrArray          *paths,
+              guint64             version,
+              GCancellable       *cancellable,
+              GError            **error);
+
+static SnapshotData *
+merge (SaturnContentIndex *self,
+       SnapshotData       *old,
+       SaturnFileIndex    *files,
+       GCancellable       *cancellable,
+       GError            **error);
+
+static const FileRecord *
+snapshot_get_file (SnapshotData *snapshot,
+                   guint32       id);
+
+static SegmentData *
+segment_load (const char *path,
+              GError    **error);
+
+static gboolean
+segment_query (SegmentData *segment,
+               const char  *needle,
+               GPtrArray   *paths);
+
+static const TrigramRecord *
+segment_lookup (SegmentData *segment,
+                guint32      trigram);
+
+static gboolean
+segment_decode (SegmentData         *segment,
+                const TrigramRecord *record,
+                GArray              *out);
+
+static guint32
+builder_add (Builder           *builder,
+             const char        *path,
+             const struct stat *st,
+             const FileRecord  *previous);
+
+static void
+builder_carry_over (Builder       *builder,
+                    SegmentData   *segment,
+                    const guint32 *remap);
+
+static SegmentData *
+builder_write (Builder    *builder,
+               const char *path,
+               guint32     generation,
+               GError    **error);
+
+static guint32
+index_file (const char        *path,
+            const struct stat *st,
+            guint32            id,
+            Builder           *builder);
+
+static GByteArray *
+serialize (Builder *builder,
+           guint32  generation);
+
+static void
+saturn_content_index_dispose (GObject *object)
+{
+  SaturnContentIndex *self = SATURN_CONTENT_INDEX (object);
+
+  g_clear_pointer (&self->snapshot, snapshot_data_unref);
+
+  G_OBJECT_CLASS (saturn_content_index_parent_class)->dispose (object);
+}
+
+static void
+saturn_content_index_finalize (GObject *object)
+{
+  SaturnContentIndex *self = SATURN_CONTENT_INDEX (object);
+
+  g_clear_pointer (&self->path, g_free);
+  g_clear_pointer (&self->delta_path, g_free);
+  g_mutex_clear (&self->snapshot_mutex);
+  g_mutex_clear (&self->update_mutex);
+
+  G_OBJECT_CLASS (saturn_content_index_parent_class)->finalize (object);
+}
+
+static void
+saturn_content_index_class_init (SaturnContentIndexClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_content_index_dispose;
+  object_class->finalize = saturn_content_index_finalize;
+}
+
+static void
+saturn_content_index_init (SaturnContentIndex *self)
+{
+  g_mutex_init (&self->snapshot_mutex);
+  g_mutex_init (&self->update_mutex);
+}
+
+SaturnContentIndex *
+saturn_content_index_new (const char *path)
+{
+  SaturnContentIndex *self = NULL;
+
+  g_return_val_if_fail (path != NULL, NULL);
+
+  self             = g_object_new (SATURN_TYPE_CONTENT_INDEX, NULL);
+  self->path       = g_strdup (path);
+  self->delta_path = g_strconcat (path, ".delta", NULL);
+
+  return self;
+}
+
+gboolean
+saturn_content_index_load (SaturnContentIndex *self,
+                           GError            **error)
+{
+  g_autoptr (GMutexLocker) locker   = NULL;
+  g_autoptr (GError) local_error    = NULL;
+  g_autoptr (SnapshotData) existing = NULL;
+  g_autoptr (SegmentData) base      = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+
+  g_return_val_if_fail (SATURN_IS_CONTENT_INDEX (self), FALSE);
+
+  locker = g_mutex_locker_new (&self->update_mutex);
+
+  existing = get_snapshot (self);
+  if (existing != NULL)
+    /* an update beat us to it */
+    return TRUE;
+
+  base = segment_load (self->path, &local_error);
+  if (base == NULL)
+    {
+      if (g_error_matches (local_error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+        return TRUE;
+      g_propagate_error (error, g_steal_pointer (&local_error));
+      return FALSE;
+    }
+
+  snapshot        = snapshot_data_new ();
+  snapshot->base  = g_steal_pointer (&base);
+  snapshot->delta = segment_load (self->delta_path, NULL);
+  if (snapshot->delta != NULL &&
+      snapshot->delta->header->generation != snapshot->base->header->generation)
+    /* left behind by a merge which didn't get to remove it */
+    g_clear_pointer (&snapshot->delta, segment_data_unref);
+
+  set_snapshot (self, snapshot);
+  return TRUE;
+}
+
+static gboolean
+collect_path (const char *directory,
+              const char *name,
+              GPtrArray  *paths)
+{
+  g_ptr_array_add (paths, g_strconcat (directory, name, NULL));
+  return TRUE;
+}
+
+static gint
+cmp_uint32 (gconstpointer a,
+            gconstpointer b)
+{
+  guint32 value_a = *(const guint32 *) a;
+  guint32 value_b = *(const guint32 *) b;
+
+  return value_a < value_b ? -1 : value_a > value_b ? 1 : 0;
+}
+
+static gint64
+get_mtime (const struct stat *st)
+{
+  return (gint64) st->st_mtim.tv_sec * G_GINT64_CONSTANT (1000000000) + st->st_mtim.tv_nsec;
+}
+
+gboolean
+saturn_content_index_update (SaturnContentIndex *self,
+                             SaturnFileIndex    *files,
+                             GCancellable       *cancellable,
+                             GError            **error)
+{
+  g_autoptr (GMutexLocker) locker   = NULL;
+  g_autoptr (SnapshotData) old      = NULL;
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autoptr (GPtrArray) paths       = NULL;
+  guint64  version                  = 0;
+  gboolean delta                    = FALSE;
+
+  g_return_val_if_fail (SATURN_IS_CONTENT_INDEX (self), FALSE);
+  g_return_val_if_fail (SATURN_IS_FILE_INDEX (files), FALSE);
+
+  locker = g_mutex_locker_new (&self->update_mutex);
+  old    = get_snapshot (self);
+
+  if (old != NULL && old->files == files)
+    {
+      guint n_delta = old->delta != NULL ? old->delta->header->n_files : 0;
+
+      paths   = g_ptr_array_new_with_free_func (g_free);
+      version = saturn_file_index_foreach_since (
+          files, old->files_version,
+          (SaturnFileIndexFunc) collect_path, paths);
+      if (paths->len == 0)
+        return TRUE;
+
+      delta = n_delta + paths->len <= MAX (MAX_DELTA_FILES, old->base->header->n_files / 8);
+    }
+
+  if (delta)
+    snapshot = update_delta (self, old, paths, version, cancellable, error);
+  else
+    snapshot = merge (self, old, files, cancellable, error);
+  if (snapshot == NULL)
+    return FALSE;
+
+  set_snapshot (self, snapshot);
+  return TRUE;
+}
+
+static SnapshotData *
+update_delta (SaturnContentIndex *self,
+              SnapshotData       *old,
+              GPtrArray          *paths,
+              guint64             version,
+              GCancellable       *cancellable,
+              GError            **error)
+{
+  g_auto (Builder) builder          = { 0 };
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autofree guint32 *remap         = NULL;
+  SegmentData *delta                = old->delta;
+  guint32      n_kept               = 0;
+
+  builder_init (&builder);
+
+  if (delta != NULL)
+    {
+      /* the files already in the delta are carried over without a look */
+      n_kept = delta->header->n_files;
+      remap  = g_new (guint32, MAX (n_kept, 1));
+      for (guint32 i = 0; i < n_kept; i++)
+        remap[i] = builder_add (
+            &builder, delta->strings + delta->files[i].path,
+            NULL, delta->files + i);
+      builder_carry_over (&builder, delta, remap);
+    }
+
+  for (guint i = 0; i < paths->len; i++)
+    {
+      const char *path = g_ptr_array_index (paths, i);
+      struct stat st   = { 0 };
+
+      if (i % 256 == 0 &&
+          g_cancellable_set_error_if_cancelled (cancellable, error))
+        return NULL;
+
+      if (stat (path, &st) != 0 || !S_ISREG (st.st_mode))
+        continue;
+
+      builder_add (&builder, path, &st, NULL);
+    }
+
+  snapshot        = snapshot_data_new ();
+  snapshot->base  = segment_data_ref (old->base);
+  snapshot->delta = builder_write (
+      &builder, self->delta_path,
+      old->base->header->generation, error);
+  if (snapshot->delta == NULL)
+    return NULL;
+  snapshot->files         = g_object_ref (old->files);
+  snapshot->files_version = version;
+
+  g_debug ("Content index delta holds %u files, %u of them new",
+           builder.records->len, builder.records->len - n_kept);
+
+  return g_steal_pointer (&snapshot);
+}
+
+static SnapshotData *
+merge (SaturnContentIndex *self,
+       SnapshotData       *old,
+       SaturnFileIndex    *files,
+       GCancellable       *cancellable,
+       GError            **error)
+{
+  g_auto (Builder) builder          = { 0 };
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autoptr (GPtrArray) paths       = NULL;
+  g_autoptr (GHashTable) old_ids    = NULL;
+  g_autofree guint32 *remap         = NULL;
+  guint32 n_base                    = 0;
+  guint32 n_old                     = 0;
+  guint32 generation                = 0;
+  guint64 version                   = 0;
+  guint   n_reused                  = 0;
+
+  paths   = g_ptr_array_new_with_free_func (g_free);
+  version = saturn_file_index_foreach_since (
+      files, 0, (SaturnFileIndexFunc) collect_path, paths);
+
+  if (old != NULL)
+    {
+      n_base     = old->base->header->n_files;
+      n_old      = n_base + (old->delta != NULL ? old->delta->header->n_files : 0);
+      generation = old->base->header->generation + 1;
+
+      old_ids = g_hash_table_new (g_str_hash, g_str_equal);
+      remap   = g_new (guint32, MAX (n_old, 1));
+      for (guint32 i = 0; i < n_old; i++)
+        {
+          SegmentData *segment = i < n_base ? old->base : old->delta;
+
+          g_hash_table_replace (
+              old_ids,
+              (gpointer) (segment->strings + snapshot_get_file (old, i)->path),
+              GUINT_TO_POINTER (i + 1));
+          remap[i] = G_MAXUINT32;
+        }
+    }
+
+  builder_init (&builder);
+  for (guint i = 0; i < paths->len; i++)
+    {
+      const char *path   = g_ptr_array_index (paths, i);
+      struct stat st     = { 0 };
+      gpointer    lookup = NULL;
+
+      if (i % 256 == 0 &&
+          g_cancellable_set_error_if_cancelled (cancellable, error))
+        return NULL;
+
+      if (stat (path, &st) != 0 || !S_ISREG (st.st_mode))
+        continue;
+
+      if (old_ids != NULL &&
+          (lookup = g_hash_table_lookup (old_ids, path)) != NULL)
+        {
+          guint32           old_id   = GPOINTER_TO_UINT (lookup) - 1;
+          const FileRecord *previous = snapshot_get_file (old, old_id);
+
+          if (remap[old_id] == G_MAXUINT32 &&
+              previous->mtime == get_mtime (&st) &&
+              previous->size == (guint64) st.st_size)
+            {
+              /* its postings get carried over below */
+              remap[old_id] = builder_add (&builder, path, &st, previous);
+              n_reused++;
+              continue;
+            }
+        }
+
+      builder_add (&builder, path, &st, NULL);
+    }
+
+  if (old != NULL)
+    {
+      builder_carry_over (&builder, old->base, remap);
+      if (old->delta != NULL)
+        builder_carry_over (&builder, old->delta, remap + n_base);
+    }
+
+  snapshot       = snapshot_data_new ();
+  snapshot->base = builder_write (&builder, self->path, generation, error);
+  if (snapshot->base == NULL)
+    return NULL;
+  snapshot->files         = g_object_ref (files);
+  snapshot->files_version = version;
+
+  /* the generation moved on, so a delta we fail to remove is ignored by
+     the next load anyway */
+  unlink (self->delta_path);
+
+  g_debug ("Content index holds %u files, %u read and %u carried over",
+           builder.records->len, builder.records->len - n_reused, n_reused);
+
+  return g_steal_pointer (&snapshot);
+}
+
+GPtrArray *
+saturn_content_index_query (SaturnContentIndex *self,
+                            SaturnFileIndex    *files,
+                            const char         *needle,
+                            gboolean           *stale)
+{
+  g_autoptr (SnapshotData) snapshot = NULL;
+  g_autoptr (GPtrArray) paths       = NULL;
+  guint n_indexed                   = 0;
+
+  g_return_val_if_fail (SATURN_IS_CONTENT_INDEX (self), NULL);
+  g_return_val_if_fail (SATURN_IS_FILE_INDEX (files), NULL);
+  g_return_val_if_fail (needle != NULL, NULL);
+
+  if (stale != NULL)
+    *stale = FALSE;
+
+  snapshot = get_snapshot (self);
+  if (snapshot == NULL || snapshot->files != files)
+    {
+      /* nothing can be ruled out until it has been merged against `files` */
+      if (stale != NULL)
+        *stale = TRUE;
+      return NULL;
+    }
+
+  if (strlen (needle) < TRIGRAM_LENGTH)
+    return NULL;
+
+  paths = g_ptr_array_new_with_free_func (g_free);
+  if (!segment_query (snapshot->base, needle, paths))
+    return NULL;
+  if (snapshot->delta != NULL &&
+      !segment_query (snapshot->delta, needle, paths))
+    return NULL;
+
+  /* whatever was published since the last update can't be ruled out by the
+     postings, so it is searched as well */
+  n_indexed = paths->len;
+  saturn_file_index_foreach_since (
+      files, snapshot->files_version,
+      (SaturnFileIndexFunc) collect_path, paths);
+
+  if (stale != NULL)
+    *stale = paths->len > n_indexed;
+  return g_steal_pointer (&paths);
+}
+
+static SnapshotData *
+get_snapshot (SaturnContentIndex *self)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&self->snapshot_mutex);
+  return saturn_maybe_ref (self->snapshot, snapshot_data_ref);
+}
+
+static void
+set_snapshot (SaturnContentIndex *self,
+              SnapshotData       *snapshot)
+{
+  g_autoptr (SnapshotData) old = NULL;
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker         = g_mutex_locker_new (&self->snapshot_mutex);
+    old            = g_steal_pointer (&self->snapshot);
+    self->snapshot = snapshot_data_ref (snapshot);
+  }
+
+  /* old is released outside of the lock */
+}
+
+static const FileRecord *
+snapshot_get_file (SnapshotData *snapshot,
+                   guint32       id)
+{
+  if (id < snapshot->base->header->n_files)
+    return snapshot->base->files + id;
+  return snapshot->delta->files + (id - snapshot->base->header->n_files);
+}
+
+static SegmentData *
+segment_load (const char *path,
+              GError    **error)
+{
+  g_autoptr (SegmentData) segment = NULL;
+  const char   *data              = NULL;
+  gsize         size              = 0;
+  const Header *header            = NULL;
+
+  segment         = segment_data_new ();
+  segment->mapped = g_mapped_file_new (path, FALSE, error);
+  if (segment->mapped == NULL)
+    return NULL;
+
+  data = g_mapped_file_get_contents (segment->mapped);
+  size = g_mapped_file_get_length (segment->mapped);
+
+#define INVALID()                                               \
+  G_STMT_START                                                  \
+  {                                                             \
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,    \
+                 "%s is not a valid content index", path);      \
+    return NULL;                                                \
+  }                                                             \
+  G_STMT_END
+
+  if (size < sizeof (Header))
+    INVALID ();
+
+  header = (const Header *) data;
+  if (memcmp (header->magic, INDEX_MAGIC, sizeof (header->magic)) != 0 ||
+      header->version != INDEX_VERSION)
+    INVALID ();
+
+  if (header->files_offset % 8 != 0 ||
+      header->trigrams_offset % 8 != 0 ||
+      header->files_offset > size ||
+      (size - header->files_offset) / sizeof (FileRecord) < header->n_files ||
+      header->strings_offset > size ||
+      size - header->strings_offset < header->strings_size ||
+      header->trigrams_offset > size ||
+      (size - header->trigrams_offset) / sizeof (TrigramRecord) < header->n_trigrams ||
+      header->postings_offset > size ||
+      size - header->postings_offset < header->postings_size)
+    INVALID ();
+
+  segment->header   = header;
+  segment->files    = (const FileRecord *) (data + header->files_offset);
+  segment->strings  = data + header->strings_offset;
+  segment->trigrams = (const TrigramRecord *) (data + header->trigrams_offset);
+  segment->postings = (const guint8 *) data + header->postings_offset;
+
+  if (header->n_files > 0 &&
+      (header->strings_size == 0 ||
+       segment->strings[header->strings_size - 1] != '\0'))
+    INVALID ();
+
+  segment->unindexed = g_array_new (FALSE, FALSE, sizeof (guint32));
+  for (guint32 i = 0; i < header->n_files; i++)
+    {
+      if (segment->files[i].path >= header->strings_size)
+        INVALID ();
+      if (segment->files[i].flags & FILE_UNINDEXED)
+        g_array_append_val (segment->unindexed, i);
+    }
+
+  for (guint32 i = 0; i < header->n_trigrams; i++)
+    {
+      if (segment->trigrams[i].offset > header->postings_size)
+        INVALID ();
+    }
+
+#undef INVALID
+
+  return g_steal_pointer (&segment);
+}
+
+static gint
+cmp_n_postings (gconstpointer a,
+                gconstpointer b)
+{
+  const TrigramRecord *record_a = *(const TrigramRecord *const *) a;
+  const TrigramRecord *record_b = *(const TrigramRecord *const *) b;
+
+  return record_a->n_postings < record_b->n_postings   ? -1
+         : record_a->n_postings > record_b->n_postings ? 1
+                                                       : 0;
+}
+
+static gboolean
+segment_query (SegmentData *segment,
+               const char  *needle,
+               GPtrArray   *paths)
+{
+  g_autoptr (GPtrArray) records = NULL;
+  g_autoptr (GArray) candidates = NULL;
+  g_autoptr (GArray) list       = NULL;
+  gsize    length               = strlen (needle);
+  gboolean empty                = FALSE;
+
+  records = g_ptr_array_new ();
+  for (gsize i = 0; i + TRIGRAM_LENGTH <= length; i++)
+    {
+      guint32              trigram = 0;
+      const TrigramRecord *record  = NULL;
+
+      trigram = (guchar) needle[i] << 16 |
+                (guchar) needle[i + 1] << 8 |
+                (guchar) needle[i + 2];
+
+      record = segment_lookup (segment, trigram);
+      if (record == NULL)
+        {
+          /* no indexed file can match */
+          empty = TRUE;
+          break;
+        }
+      g_ptr_array_add (records, (gpointer) record);
+    }
+
+  candidates = g_array_new (FALSE, FALSE, sizeof (guint32));
+  if (!empty)
+    {
+      /* rarest first so that the working set only shrinks */
+      g_ptr_array_sort (records, cmp_n_postings);
+
+      if (!segment_decode (segment, g_ptr_array_index (records, 0), candidates))
+        return FALSE;
+
+      list = g_array_new (FALSE, FALSE, sizeof (guint32));
+      for (guint i = 1; i < records->len && candidates->len > 0; i++)
+        {
+          guint a   = 0;
+          guint b   = 0;
+          guint out = 0;
+
+          if (!segment_decode (segment, g_ptr_array_index (records, i), list))
+            return FALSE;
+
+          while (a < candidates->len && b < list->len)
+            {
+              guint32 a_id = g_array_index (candidates, guint32, a);
+              guint32 b_id = g_array_index (list, guint32, b);
+
+              if (a_id < b_id)
+                a++;
+              else if (a_id > b_id)
+                b++;
+              else
+                {
+                  g_array_index (candidates, guint32, out++) = a_id;
+                  a++;
+                  b++;
+                }
+            }
+          g_array_set_size (candidates, out);
+        }
+    }
+
+  g_array_append_vals (candidates, segment->unindexed->data, segment->unindexed->len);
+
+  for (guint i = 0; i < candidates->len; i++)
+    {
+      guint32 id = g_array_index (candidates, guint32, i);
+
+      g_ptr_array_add (paths, g_strdup (segment->strings + segment->files[id].path));
+    }
+
+  return TRUE;
+}
+
+static const TrigramRecord *
+segment_lookup (SegmentData *segment,
+                guint32      trigram)
+{
+  guint32 lo = 0;
+  guint32 hi = segment->header->n_trigrams;
+
+  while (lo < hi)
+    {
+      guint32 mid = lo + (hi - lo) / 2;
+
+      if (segment->trigrams[mid].trigram < trigram)
+        lo = mid + 1;
+      else if (segment->trigrams[mid].trigram > trigram)
+        hi = mid;
+      else
+        return segment->trigrams + mid;
+    }
+
+  return NULL;
+}
+
+static gboolean
+segment_decode (SegmentData         *segment,
+                const TrigramRecord *record,
+                GArray              *out)
+{
+  const guint8 *p   = segment->postings + record->offset;
+  const guint8 *end = segment->postings + segment->header->postings_size;
+  guint32       id  = 0;
+
+  g_array_set_size (out, 0);
+  for (guint32 i = 0; i < record->n_postings; i++)
+    {
+      guint32 delta = 0;
+      guint   shift = 0;
+      guint8  byte  = 0;
+
+      do
+        {
+          if (p >= end || shift > 28)
+            return FALSE;
+          byte = *p++;
+          delta |= (guint32) (byte & 0x7f) << shift;
+          shift += 7;
+        }
+      while (byte & 0x80);
+
+      id += delta;
+      if (id >= segment->header->n_files)
+        return FALSE;
+      g_array_append_val (out, id);
+    }
+
+  return TRUE;
+}
+
+static void
+builder_init (Builder *builder)
+{
+  builder->records  = g_array_new (FALSE, TRUE, sizeof (FileRecord));
+  builder->strings  = g_string_new (NULL);
+  builder->postings = g_hash_table_new_full (
+      g_direct_hash, g_direct_equal,
+      NULL, (GDestroyNotify) g_array_unref);
+  builder->seen    = g_malloc0 (N_TRIGRAMS / 8);
+  builder->touched = g_array_new (FALSE, FALSE, sizeof (guint32));
+  builder->buffer  = g_byte_array_new ();
+}
+
+static void
+builder_clear (Builder *builder)
+{
+  g_clear_pointer (&builder->records, g_array_unref);
+  if (builder->strings != NULL)
+    g_string_free (g_steal_pointer (&builder->strings), TRUE);
+  g_clear_pointer (&builder->postings, g_hash_table_unref);
+  g_clear_pointer (&builder->seen, g_free);
+  g_clear_pointer (&builder->touched, g_array_unref);
+  g_clear_pointer (&builder->buffer, g_byte_array_unref);
+}
+
+/* Returns the id `path` was given. Its contents are only read if there is
+   no `previous` record whose postings get carried over instead */
+static guint32
+builder_add (Builder           *builder,
+             const char        *path,
+             const struct stat *st,
+             const FileRecord  *previous)
+{
+  FileRecord record = { 0 };
+  guint32    id     = builder->records->len;
+
+  if (previous != NULL)
+    {
+      record.mtime = previous->mtime;
+      record.size  = previous->size;
+      record.flags = previous->flags;
+    }
+  else
+    {
+      record.mtime = get_mtime (st);
+      record.size  = st->st_size;
+      record.flags = index_file (path, st, id, builder);
+    }
+
+  record.path = builder->strings->len;
+  g_string_append_len (builder->strings, path, strlen (path) + 1);
+  g_array_append_val (builder->records, record);
+
+  return id;
+}
+
+/* `remap` maps every id in `segment` to its new one, or G_MAXUINT32 if the
+   file is gone */
+static void
+builder_carry_over (Builder       *builder,
+                    SegmentData   *segment,
+                    const guint32 *remap)
+{
+  g_autoptr (GArray) list = NULL;
+
+  list = g_array_new (FALSE, FALSE, sizeof (guint32));
+  for (guint32 i = 0; i < segment->header->n_trigrams; i++)
+    {
+      const TrigramRecord *record = segment->trigrams + i;
+      GArray              *ids    = NULL;
+
+      if (!segment_decode (segment, record, list))
+        continue;
+
+      for (guint j = 0; j < list->len; j++)
+        {
+          guint32 id = remap[g_array_index (list, guint32, j)];
+
+          if (id == G_MAXUINT32)
+            continue;
+
+          if (ids == NULL)
+            {
+              ids = g_hash_table_lookup (builder->postings, GUINT_TO_POINTER (record->trigram));
+              if (ids == NULL)
+                {
+                  ids = g_array_new (FALSE, FALSE, sizeof (guint32));
+                  g_hash_table_replace (builder->postings, GUINT_TO_POINTER (record->trigram), ids);
+                }
+            }
+          g_array_append_val (ids, id);
+        }
+    }
+}
+
+static SegmentData *
+builder_write (Builder    *builder,
+               const char *path,
+               guint32     generation,
+               GError    **error)
+{
+  g_autoptr (GByteArray) serialized = NULL;
+  g_autofree char *dirname          = NULL;
+
+  serialized = serialize (builder, generation);
+  g_clear_pointer (&builder->postings, g_hash_table_unref);
+
+  dirname = g_path_get_dirname (path);
+  g_mkdir_with_parents (dirname, 0755);
+  if (!g_file_set_contents_full (
+          path,
+          (const char *) serialized->data,
+          serialized->len,
+          G_FILE_SET_CONTENTS_CONSISTENT,
+          0644,
+          error))
+    return NULL;
+
+  /* the old mapping stays valid for readers still holding it, since the
+     file was replaced rather than rewritten */
+  return segment_load (path, error);
+}
+
+static guint32
+index_file (const char        *path,
+            const struct stat *st,
+            guint32            id,
+            Builder           *builder)
+{
+  int           fd      = -1;
+  gsize         size    = 0;
+  gssize        n_read  = 0;
+  const guint8 *data    = NULL;
+  guint8       *seen    = builder->seen;
+  GArray       *touched = builder->touched;
+  guint32       flags   = 0;
+
+  if (st->st_size > MAX_INDEXED_SIZE)
+    return FILE_UNINDEXED;
+  if (st->st_size == 0)
+    return 0;
+
+  fd = open (path, O_RDONLY | O_CLOEXEC | O_NOCTTY);
+  if (fd < 0)
+    /* we can't tell what it contains right now */
+    return FILE_UNINDEXED;
+
+  g_byte_array_set_size (builder->buffer, st->st_size);
+  while (size < (gsize) st->st_size &&
+         (n_read = read (fd, builder->buffer->data + size, st->st_size - size)) > 0)
+    size += n_read;
+  close (fd);
+
+  data = builder->buffer->data;
+  if (memchr (data, '\0', MIN (size, BINARY_SNIFF_LENGTH)) != NULL)
+    return FILE_BINARY;
+
+  g_array_set_size (touched, 0);
+  for (gsize i = 0; i + TRIGRAM_LENGTH <= size; i++)
+    {
+      guint32 trigram = 0;
+
+      if (data[i] == '\n' || data[i + 1] == '\n' || data[i + 2] == '\n')
+        continue;
+
+      trigram = data[i] << 16 | data[i + 1] << 8 | data[i + 2];
+      if (seen[trigram >> 3] & (1 << (trigram & 7)))
+        continue;
+
+      seen[trigram >> 3] |= 1 << (trigram & 7);
+      g_array_append_val (touched, trigram);
+    }
+
+  if (touched->len > MAX_INDEXED_TRIGRAMS)
+    flags = FILE_UNINDEXED;
+
+  for (guint i = 0; i < touched->len; i++)
+    {
+      guint32 trigram = g_array_index (touched, guint32, i);
+      GArray *ids     = NULL;
+
+      seen[trigram >> 3] &= ~(1 << (trigram & 7));
+      if (flags & FILE_UNINDEXED)
+        continue;
+
+      ids = g_hash_table_lookup (builder->postings, GUINT_TO_POINTER (trigram));
+      if (ids == NULL)
+        {
+          ids = g_array_new (FALSE, FALSE, sizeof (guint32));
+          g_hash_table_replace (builder->postings, GUINT_TO_POINTER (trigram), ids);
+        }
+      g_array_append_val (ids, id);
+    }
+
+  return flags;
+}
+
+static gint
+cmp_trigram_key (gconstpointer a,
+                 gconstpointer b)
+{
+  guint32 trigram_a = GPOINTER_TO_UINT (*(gconstpointer *) a);
+  guint32 trigram_b = GPOINTER_TO_UINT (*(gconstpointer *) b);
+
+  return trigram_a < trigram_b ? -1 : trigram_a > trigram_b ? 1 : 0;
+}
+
+static GByteArray *
+serialize (Builder *builder,
+           guint32  generation)
+{
+  static const guint8 padding[8] = { 0 };
+  GArray     *records            = builder->records;
+  GString    *strings            = builder->strings;
+  GHashTable *postings           = builder->postings;
+  Header      header             = { 0 };
+  g_autofree gpointer *keys      = NULL;
+  guint n_keys                   = 0;
+  g_autoptr (GArray) trigrams    = NULL;
+  g_autoptr (GByteArray) encoded = NULL;
+  GByteArray *out                = NULL;
+
+  keys = g_hash_table_get_keys_as_array (postings, &n_keys);
+  qsort (keys, n_keys, sizeof (*keys), cmp_trigram_key);
+
+  trigrams = g_array_sized_new (FALSE, TRUE, sizeof (TrigramRecord), n_keys);
+  encoded  = g_byte_array_new ();
+
+  for (guint i = 0; i < n_keys; i++)
+    {
+      GArray       *ids    = g_hash_table_lookup (postings, keys[i]);
+      TrigramRecord record = { 0 };
+      guint32       last   = 0;
+
+      /* carried over ids were appended after the freshly read ones */
+      g_array_sort (ids, cmp_uint32);
+
+      record.trigram    = GPOINTER_TO_UINT (keys[i]);
+      record.n_postings = ids->len;
+      record.offset     = encoded->len;
+
+      for (guint j = 0; j < ids->len; j++)
+        {
+          guint32 id    = g_array_index (ids, guint32, j);
+          guint32 delta = id - last;
+
+          last = id;
+          do
+            {
+              guint8 byte = delta & 0x7f;
+
+              delta >>= 7;
+              if (delta > 0)
+                byte |= 0x80;
+              g_byte_array_append (encoded, &byte, 1);
+            }
+          while (delta > 0);
+        }
+
+      g_array_append_val (trigrams, record);
+    }
+
+  memcpy (header.magic, INDEX_MAGIC, sizeof (header.magic));
+  header.version         = INDEX_VERSION;
+  header.n_files         = records->len;
+  header.n_trigrams      = n_keys;
+  header.generation      = generation;
+  header.files_offset    = sizeof (Header);
+  header.strings_offset  = header.files_offset + records->len * sizeof (FileRecord);
+  header.strings_size    = strings->len;
+  header.trigrams_offset = (header.strings_offset + strings->len + 7) & ~(guint64) 7;
+  header.postings_offset = header.trigrams_offset + n_keys * sizeof (TrigramRecord);
+  header.postings_size   = encoded->len;
+
+  out = g_byte_array_sized_new (header.postings_offset + header.postings_size);
+  g_byte_array_append (out, (const guint8 *) &header, sizeof (header));
+  g_byte_array_append (out, (const guint8 *) records->data, records->len * sizeof (FileRecord));
+  g_byte_array_append (out, (const guint8 *) strings->str, strings->len);
+  g_byte_array_append (out, padding, header.trigrams_offset - (header.strings_offset + strings->len));
+  g_byte_array_append (out, (const guint8 *) trigrams->data, n_keys * sizeof (TrigramRecord));
+  g_byte_array_append (out, encoded->data, encoded->len);
+
+  return out;
+}
+
+/* End of saturn-content-index.c */
@@ -0,0 +1,67 @@
+/* saturn-content-index.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+#include "saturn-file-index.h"
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_CONTENT_INDEX (saturn_content_index_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnContentIndex, saturn_content_index, SATURN, CONTENT_INDEX, GObject)
+
+/* `path` is where the index is persisted */
+SaturnContentIndex *
+saturn_content_index_new (const char *path);
+
+/* Maps whatever index a previous run left behind. A missing file is not an
+   error, the index just stays empty until the first update */
+gboolean
+saturn_content_index_load (SaturnContentIndex *self,
+                           GError            **error);
+
+/* Brings the index in line with `files`. Usually only the files published
+   to it since the last update are read and written to the delta, but the
+   first update against a given file index, or one which finds the delta
+   too large, merges everything into a new base, rereading only the files
+   whose mtime or size changed */
+gboolean
+saturn_content_index_update (SaturnContentIndex *self,
+                             SaturnFileIndex    *files,
+                             GCancellable       *cancellable,
+                             GError            **error);
+
+/* Returns the paths of every file which may contain `needle` and still
+   needs verifying, or NULL if the index can't narrow the search down, in
+   which case every file has to be searched. Files published to `files`
+   since the last update are always included, and set `stale`, which means
+   an update is due, as does an index which was never updated against
+   `files`. Neither reads nor stats any file */
+GPtrArray *
+saturn_content_index_query (SaturnContentIndex *self,
+                            SaturnFileIndex    *files,
+                            const char         *needle,
+                            gboolean           *stale);
+
+G_END_DECLS
+
+/* End of saturn-content-index.h */
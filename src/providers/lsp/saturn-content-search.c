@@ -0,0 +1,495 @@
+/* saturn-content-search.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* An in-process alternative to running ripgrep. The file list comes from the
+   fs provider's index, so hidden files and anything git ignores are already
+   left out. Large files are mapped and small ones read into a per-thread
+   buffer. Either way they are sniffed for a NUL byte, the way grep tools
+   usually detect binaries, and then scanned with find_literal(). On SSE2
+   that compares the first and last byte of the needle against 16 positions
+   at a time and only falls back to memcmp on candidates.
+
+   Only the scanning happens on the pool. Every file with a match is queued
+   back to the thread which started the search and handed to the callback
+   there, since that thread is known to lisp and the pool's are not. */
+
+#define _GNU_SOURCE
+#define G_LOG_DOMAIN "SATURN::CONTENT-SEARCH"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "saturn-content-search.h"
+
+/* files are handed to the pool in chunks to keep queueing overhead down */
+#define CHUNK_SIZE          256
+#define BINARY_SNIFF_LENGTH 8192
+#define MAX_FILE_SIZE       (64 * 1024 * 1024)
+#define MMAP_THRESHOLD      (1024 * 1024)
+
+static GPrivate read_buffer = G_PRIVATE_INIT ((GDestroyNotify) g_byte_array_unref);
+
+/* queued by a worker once it is done with a chunk */
+static char chunk_done;
+
+typedef struct
+{
+  const char    *needle;
+  GCancellable  *cancellable;
+  SaturnGrepFunc func;
+  gpointer       user_data;
+  GThreadPool   *pool;
+  GPtrArray     *chunk;
+  guint          n_pending_chunks;
+  gint           stopped;
+  /* SaturnGrepFile, or &chunk_done */
+  GAsyncQueue   *results;
+} Search;
+
+static void
+search_begin (Search        *search,
+              const char    *needle,
+              GCancellable  *cancellable,
+              SaturnGrepFunc func,
+              gpointer       user_data);
+
+static void
+search_finish (Search *search);
+
+static gboolean
+enqueue_path (Search *search,
+              char   *path);
+
+static gboolean
+enqueue_file (const char *directory,
+              const char *name,
+              Search     *search);
+
+static void
+push_chunk (Search *search);
+
+static void
+search_chunk (GPtrArray *chunk,
+              Search    *search);
+
+static void
+deliver_result (Search  *search,
+                gpointer item);
+
+static SaturnGrepFile *
+search_file (const char *path,
+             const char *needle);
+
+static SaturnGrepFile *
+scan_buffer (const char *path,
+             const char *data,
+             gsize       size,
+             const char *needle);
+
+static const char *
+find_literal (const char *haystack,
+              gsize       haystack_length,
+              const char *needle,
+              gsize       needle_length);
+
+void
+saturn_content_search_run (SaturnFileIndex *index,
+                           const char      *needle,
+                           GCancellable    *cancellable,
+                           SaturnGrepFunc   func,
+                           gpointer         user_data)
+{
+  Search search = { 0 };
+
+  g_return_if_fail (SATURN_IS_FILE_INDEX (index));
+  g_return_if_fail (needle != NULL);
+  g_return_if_fail (func != NULL);
+
+  if (*needle == '\0')
+    return;
+
+  search_begin (&search, needle, cancellable, func, user_data);
+  saturn_file_index_foreach (index, (SaturnFileIndexFunc) enqueue_file, &search);
+  search_finish (&search);
+}
+
+void
+saturn_content_search_run_paths (GPtrArray     *paths,
+                                 const char    *needle,
+                                 GCancellable  *cancellable,
+                                 SaturnGrepFunc func,
+                                 gpointer       user_data)
+{
+  Search search = { 0 };
+
+  g_return_if_fail (paths != NULL);
+  g_return_if_fail (needle != NULL);
+  g_return_if_fail (func != NULL);
+
+  if (*needle == '\0' || paths->len == 0)
+    return;
+
+  search_begin (&search, needle, cancellable, func, user_data);
+  for (guint i = 0; i < paths->len; i++)
+    {
+      if (!enqueue_path (&search, g_strdup (g_ptr_array_index (paths, i))))
+        break;
+    }
+  search_finish (&search);
+}
+
+gboolean
+saturn_content_search_file (const char    *path,
+                            const char    *needle,
+                            SaturnGrepFunc func,
+                            gpointer       user_data)
+{
+  g_autoptr (SaturnGrepFile) file = NULL;
+
+  g_return_val_if_fail (path != NULL, FALSE);
+  g_return_val_if_fail (needle != NULL, FALSE);
+  g_return_val_if_fail (func != NULL, FALSE);
+
+  file = search_file (path, needle);
+  if (file != NULL)
+    return func (file, user_data);
+
+  return TRUE;
+}
+
+static void
+search_begin (Search        *search,
+              const char    *needle,
+              GCancellable  *cancellable,
+              SaturnGrepFunc func,
+              gpointer       user_data)
+{
+  search->needle      = needle;
+  search->cancellable = cancellable;
+  search->func        = func;
+  search->user_data   = user_data;
+  search->pool        = g_thread_pool_new (
+      (GFunc) search_chunk, search,
+      g_get_num_processors (), FALSE, NULL);
+  search->chunk   = g_ptr_array_new_with_free_func (g_free);
+  search->results = g_async_queue_new ();
+}
+
+static void
+search_finish (Search *search)
+{
+  if (search->chunk->len > 0)
+    push_chunk (search);
+  g_clear_pointer (&search->chunk, g_ptr_array_unref);
+
+  /* hand out results until every chunk has been searched */
+  while (search->n_pending_chunks > 0)
+    deliver_result (search, g_async_queue_pop (search->results));
+
+  g_thread_pool_free (search->pool, FALSE, TRUE);
+  g_clear_pointer (&search->results, g_async_queue_unref);
+}
+
+static gboolean
+enqueue_path (Search *search,
+              char   *path)
+{
+  gpointer item = NULL;
+
+  if (g_atomic_int_get (&search->stopped) ||
+      g_cancellable_is_cancelled (search->cancellable))
+    {
+      g_free (path);
+      return FALSE;
+    }
+
+  g_ptr_array_add (search->chunk, path);
+  if (search->chunk->len >= CHUNK_SIZE)
+    {
+      push_chunk (search);
+      search->chunk = g_ptr_array_new_with_free_func (g_free);
+    }
+
+  /* results show up while the file list is still being walked */
+  while ((item = g_async_queue_try_pop (search->results)) != NULL)
+    deliver_result (search, item);
+
+  return TRUE;
+}
+
+static gboolean
+enqueue_file (const char *directory,
+              const char *name,
+              Search     *search)
+{
+  return enqueue_path (search, g_strconcat (directory, name, NULL));
+}
+
+static void
+push_chunk (Search *search)
+{
+  search->n_pending_chunks++;
+  g_thread_pool_push (search->pool, g_steal_pointer (&search->chunk), NULL);
+}
+
+static void
+search_chunk (GPtrArray *chunk,
+              Search    *search)
+{
+  for (guint i = 0; i < chunk->len; i++)
+    {
+      SaturnGrepFile *file = NULL;
+
+      if (g_atomic_int_get (&search->stopped) ||
+          g_cancellable_is_cancelled (search->cancellable))
+        break;
+
+      file = search_file (g_ptr_array_index (chunk, i), search->needle);
+      if (file != NULL)
+        g_async_queue_push (search->results, file);
+    }
+
+  g_ptr_array_unref (chunk);
+  g_async_queue_push (search->results, &chunk_done);
+}
+
+static void
+deliver_result (Search  *search,
+                gpointer item)
+{
+  g_autoptr (SaturnGrepFile) file = NULL;
+
+  if (item == &chunk_done)
+    {
+      search->n_pending_chunks--;
+      return;
+    }
+
+  /* once stopped, whatever is still queued is just dropped */
+  file = item;
+  if (!g_atomic_int_get (&search->stopped) &&
+      !search->func (file, search->user_data))
+    g_atomic_int_set (&search->stopped, TRUE);
+}
+
+/* returns NULL unless something matched */
+static SaturnGrepFile *
+search_file (const char *path,
+             const char *needle)
+{
+  int             fd     = -1;
+  struct stat     st     = { 0 };
+  const char     *data   = NULL;
+  gsize           size   = 0;
+  gboolean        mapped = FALSE;
+  SaturnGrepFile *file   = NULL;
+
+  fd = open (path, O_RDONLY | O_CLOEXEC | O_NOCTTY);
+  if (fd < 0)
+    return NULL;
+
+  if (fstat (fd, &st) != 0 ||
+      !S_ISREG (st.st_mode) ||
+      st.st_size == 0 ||
+      st.st_size > MAX_FILE_SIZE)
+    {
+      close (fd);
+      return NULL;
+    }
+
+  if (st.st_size >= MMAP_THRESHOLD)
+    {
+      data = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED)
+        {
+          close (fd);
+          return NULL;
+        }
+      madvise ((void *) data, st.st_size, MADV_SEQUENTIAL);
+      size   = st.st_size;
+      mapped = TRUE;
+    }
+  else
+    {
+      GByteArray *buffer = NULL;
+      gssize      n_read = 0;
+
+      /* most files are small, and mapping and unmapping each of them costs
+         far more than a read into a buffer we keep around per thread */
+      buffer = g_private_get (&read_buffer);
+      if (buffer == NULL)
+        {
+          buffer = g_byte_array_new ();
+          g_private_set (&read_buffer, buffer);
+        }
+      g_byte_array_set_size (buffer, st.st_size);
+
+      while (size < (gsize) st.st_size &&
+             (n_read = read (fd, buffer->data + size, st.st_size - size)) > 0)
+        size += n_read;
+      data = (const char *) buffer->data;
+    }
+  close (fd);
+
+  if (size > 0 && memchr (data, '\0', MIN (size, BINARY_SNIFF_LENGTH)) == NULL)
+    file = scan_buffer (path, data, size, needle);
+
+  if (mapped)
+    munmap ((void *) data, size);
+  return file;
+}
+
+static SaturnGrepFile *
+scan_buffer (const char *path,
+             const char *data,
+             gsize       size,
+             const char *needle)
+{
+  g_autoptr (SaturnGrepFile) file = NULL;
+  gsize       needle_length       = 0;
+  const char *end                 = data + size;
+  const char *p                   = data;
+  const char *counted             = data;
+  guint64     line_number         = 1;
+  const char *hit                 = NULL;
+
+  needle_length = strlen (needle);
+  while ((hit = find_literal (p, end - p, needle, needle_length)) != NULL)
+    {
+      const char *line_start  = hit;
+      const char *line_end    = NULL;
+      gsize       line_length = 0;
+      gboolean    valid       = FALSE;
+
+      while (line_start > data && line_start[-1] != '\n')
+        line_start--;
+      line_end = memchr (hit, '\n', end - hit);
+      if (line_end == NULL)
+        line_end = end;
+
+      /* only count the newlines we skipped over since the last match */
+      for (const char *nl = counted;
+           (nl = memchr (nl, '\n', line_start - nl)) != NULL;
+           nl++)
+        line_number++;
+      counted = line_start;
+
+      line_length = line_end - line_start;
+      if (line_length > 0 && line_start[line_length - 1] == '\r')
+        line_length--;
+
+      if (file == NULL)
+        file = saturn_grep_file_new (path);
+      g_array_append_val (file->line_numbers, line_number);
+
+      valid = g_utf8_validate_len (line_start, line_length, NULL);
+      if (valid)
+        {
+          for (const char *match = hit;
+               match != NULL && match + needle_length <= line_start + line_length;
+               match = find_literal (
+                   match + needle_length,
+                   line_start + line_length - (match + needle_length),
+                   needle, needle_length))
+            {
+              SaturnGrepSubmatch record = { 0 };
+
+              record.line  = file->n_lines;
+              record.start = match - line_start;
+              record.end   = record.start + needle_length;
+              g_array_append_val (file->submatches, record);
+            }
+          g_string_append_len (file->lines, line_start, line_length);
+        }
+      else
+        {
+          g_autofree char *lossy = NULL;
+
+          /* offsets into lossily converted text would be meaningless */
+          lossy = g_utf8_make_valid (line_start, line_length);
+          g_string_append (file->lines, lossy);
+        }
+      g_string_append_c (file->lines, '\n');
+      file->n_lines++;
+
+      if (line_end >= end)
+        break;
+      p = line_end + 1;
+    }
+
+  return g_steal_pointer (&file);
+}
+
+static const char *
+find_literal (const char *haystack,
+              gsize       haystack_length,
+              const char *needle,
+              gsize       needle_length)
+{
+  if (needle_length == 0 || haystack_length < needle_length)
+    return NULL;
+
+#ifdef __SSE2__
+  if (needle_length > 1)
+    {
+      __m128i first = _mm_set1_epi8 (needle[0]);
+      __m128i last  = _mm_set1_epi8 (needle[needle_length - 1]);
+      gsize   i     = 0;
+
+      for (; i + needle_length - 1 + 16 <= haystack_length; i += 16)
+        {
+          __m128i block_first = { 0 };
+          __m128i block_last  = { 0 };
+          guint   mask        = 0;
+
+          block_first = _mm_loadu_si128 ((const __m128i *) (haystack + i));
+          block_last  = _mm_loadu_si128 ((const __m128i *) (haystack + i + needle_length - 1));
+          mask        = _mm_movemask_epi8 (
+              _mm_and_si128 (
+                  _mm_cmpeq_epi8 (first, block_first),
+                  _mm_cmpeq_epi8 (last, block_last)));
+
+          while (mask != 0)
+            {
+              guint bit = __builtin_ctz (mask);
+
+              if (memcmp (haystack + i + bit + 1, needle + 1, needle_length - 2) == 0)
+                return haystack + i + bit;
+              mask &= mask - 1;
+            }
+        }
+
+      /* leftover tail */
+      haystack += i;
+      haystack_length -= i;
+    }
+#endif
+
+  return memmem (haystack, haystack_length, needle, needle_length);
+}
+
+/* End of saturn-content-search.c */
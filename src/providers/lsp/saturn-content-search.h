@@ -0,0 +1,59 @@
+/* saturn-content-search.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+#include "saturn-file-index.h"
+#include "saturn-grep.h"
+
+G_BEGIN_DECLS
+
+/* Searches the contents of every file in `index` for the literal `needle`
+   and blocks until done. Files are scanned on a pool of worker threads, but
+   `func` is only ever invoked on the calling thread, once per file with at
+   least one match */
+void
+saturn_content_search_run (SaturnFileIndex *index,
+                           const char      *needle,
+                           GCancellable    *cancellable,
+                           SaturnGrepFunc   func,
+                           gpointer         user_data);
+
+/* Like saturn_content_search_run(), but only searches `paths`, usually
+   the candidates a content index came up with */
+void
+saturn_content_search_run_paths (GPtrArray     *paths,
+                                 const char    *needle,
+                                 GCancellable  *cancellable,
+                                 SaturnGrepFunc func,
+                                 gpointer       user_data);
+
+/* Searches a single file, returning FALSE if `func` asked to stop */
+gboolean
+saturn_content_search_file (const char    *path,
+                            const char    *needle,
+                            SaturnGrepFunc func,
+                            gpointer       user_data);
+
+G_END_DECLS
+
+/* End of saturn-content-search.h */
@@ -0,0 +1,58 @@
+/* saturn-emoji-table.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* These are generated from emoji-table.lsp at build time by
+   gen-emoji-table.py. Every string lives in `saturn_emoji_strings`, NUL
+   terminated, and is referred to by its byte offset into it */
+
+typedef struct
+{
+  guint32 glyph;
+  guint32 name;
+  /* `name` casefolded */
+  guint32 folded;
+} SaturnEmojiEntry;
+
+/* A word of some casefolded name. Tokens are sorted by their bytes, and
+   each lists the ids of the entries using it, ascending, in
+   `saturn_emoji_postings` */
+typedef struct
+{
+  guint32 text;
+  guint32 postings;
+  guint32 n_postings;
+} SaturnEmojiToken;
+
+extern const char             saturn_emoji_strings[];
+extern const SaturnEmojiEntry saturn_emoji_entries[];
+extern const guint            saturn_emoji_n_entries;
+extern const SaturnEmojiToken saturn_emoji_tokens[];
+extern const guint            saturn_emoji_n_tokens;
+extern const guint16          saturn_emoji_postings[];
+
+G_END_DECLS
+
+/* End of saturn-emoji-table.h */
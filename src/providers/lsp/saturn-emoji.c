@@ -0,0 +1,182 @@
+/* saturn-emoji.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* Names are split into words at build time (see gen-emoji-table.py) and the
+   words sorted, so every word starting with some prefix sits in one run of
+   the token table, found by binary search. The emojis listed under that
+   run are marked in a bitset, one per query word, and the bitsets are
+   intersected. The GtkStringObjects handed out are created the first time
+   an emoji matches and reused by every query after. */
+
+#define G_LOG_DOMAIN "SATURN::EMOJI"
+
+#include <string.h>
+
+#include "saturn-emoji-table.h"
+#include "saturn-emoji.h"
+
+#define MAX_QUERY_WORDS 16
+
+#define STRING(offset) (saturn_emoji_strings + (offset))
+
+static void
+mark_prefix (const char *prefix,
+             guint32    *bits);
+
+static GtkStringObject *
+ensure_string_object (GtkStringObject **slot,
+                      guint32           offset);
+
+void
+saturn_emoji_query (const char     *query,
+                    SaturnEmojiFunc func,
+                    gpointer        user_data)
+{
+  static GtkStringObject **objects        = NULL;
+  g_autofree char *folded                 = NULL;
+  char            *words[MAX_QUERY_WORDS] = { 0 };
+  guint            n_words                = 0;
+  guint            n_bits                 = 0;
+  g_autofree guint32 *matched             = NULL;
+  g_autofree guint32 *current             = NULL;
+
+  g_return_if_fail (query != NULL);
+  g_return_if_fail (func != NULL);
+
+  /* two per emoji, the glyph followed by the name */
+  if (g_once_init_enter_pointer (&objects))
+    g_once_init_leave_pointer (&objects, g_new0 (GtkStringObject *, 2 * saturn_emoji_n_entries));
+
+  /* split in place, separators are overwritten with NULs */
+  folded = g_utf8_casefold (query, -1);
+  for (char *p = folded; *p != '\0' && n_words < MAX_QUERY_WORDS;)
+    {
+      char *word = p;
+
+      while (*p != '\0' && g_unichar_isalnum (g_utf8_get_char (p)))
+        p = g_utf8_next_char (p);
+
+      if (p > word)
+        words[n_words++] = word;
+      if (*p == '\0')
+        break;
+
+      {
+        char *separator = p;
+
+        p = g_utf8_next_char (p);
+        memset (separator, '\0', p - separator);
+      }
+    }
+  if (n_words == 0)
+    return;
+
+  n_bits  = (saturn_emoji_n_entries + 31) / 32;
+  matched = g_new0 (guint32, n_bits);
+  current = g_new0 (guint32, n_bits);
+
+  mark_prefix (words[0], matched);
+  for (guint i = 1; i < n_words; i++)
+    {
+      memset (current, 0, n_bits * sizeof (*current));
+      mark_prefix (words[i], current);
+      for (guint j = 0; j < n_bits; j++)
+        matched[j] &= current[j];
+    }
+
+  for (guint i = 0; i < n_bits; i++)
+    {
+      for (guint32 bits = matched[i]; bits != 0; bits &= bits - 1)
+        {
+          guint                   id    = i * 32 + __builtin_ctz (bits);
+          const SaturnEmojiEntry *entry = &saturn_emoji_entries[id];
+          GtkStringObject        *glyph = NULL;
+          GtkStringObject        *name  = NULL;
+
+          glyph = ensure_string_object (&objects[2 * id], entry->glyph);
+          name  = ensure_string_object (&objects[2 * id + 1], entry->name);
+          if (!func (glyph, name, user_data))
+            return;
+        }
+    }
+}
+
+static void
+mark_prefix (const char *prefix,
+             guint32    *bits)
+{
+  gsize length = 0;
+  guint lower  = 0;
+  guint upper  = saturn_emoji_n_tokens;
+
+  /* first token not sorting before `prefix` */
+  while (lower < upper)
+    {
+      guint middle = lower + (upper - lower) / 2;
+
+      if (strcmp (STRING (saturn_emoji_tokens[middle].text), prefix) < 0)
+        lower = middle + 1;
+      else
+        upper = middle;
+    }
+
+  length = strlen (prefix);
+  for (guint i = lower;
+       i < saturn_emoji_n_tokens &&
+       strncmp (STRING (saturn_emoji_tokens[i].text), prefix, length) == 0;
+       i++)
+    {
+      const SaturnEmojiToken *token = &saturn_emoji_tokens[i];
+
+      for (guint j = 0; j < token->n_postings; j++)
+        {
+          guint16 id = saturn_emoji_postings[token->postings + j];
+
+          bits[id / 32] |= 1u << (id % 32);
+        }
+    }
+}
+
+static GtkStringObject *
+ensure_string_object (GtkStringObject **slot,
+                      guint32           offset)
+{
+  GtkStringObject *object = NULL;
+
+  object = g_atomic_pointer_get (slot);
+  if (object == NULL)
+    {
+      GtkStringObject *new = NULL;
+
+      new = gtk_string_object_new (STRING (offset));
+      /* another query may have gotten here first */
+      if (g_atomic_pointer_compare_and_exchange (slot, NULL, new))
+        object = new;
+      else
+        {
+          g_object_unref (new);
+          object = g_atomic_pointer_get (slot);
+        }
+    }
+
+  return object;
+}
+
+/* End of saturn-emoji.c */
@@ -0,0 +1,44 @@
+/* saturn-emoji.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+/* `glyph` and `name` are shared between queries, take a reference to keep
+   them. Return FALSE to stop */
+typedef gboolean (*SaturnEmojiFunc) (GtkStringObject *glyph,
+                                     GtkStringObject *name,
+                                     gpointer         user_data);
+
+/* Visits every emoji for which each word of `query` is a case insensitive
+   prefix of some word in its name, in table order. Only the emojis listed
+   under matching words are ever looked at. The emoji table is compiled in,
+   so there is nothing to load first. Safe to call from any thread */
+void
+saturn_emoji_query (const char     *query,
+                    SaturnEmojiFunc func,
+                    gpointer        user_data);
+
+G_END_DECLS
+
+/* End of saturn-emoji.h */
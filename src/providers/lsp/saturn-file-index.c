@@ -0,0 +1,786 @@
+/* saturn-file-index.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+/* Every file name is broken up into casefolded trigrams, and each trigram maps
+   to a sorted posting list of file ids. A query token of length >= 3 can only
+   match names which contain all of its trigrams, so we intersect the postings
+   to get a small candidate set and then verify those. Queries made up of
+   shorter tokens fall back to scanning a per-file character bitmask.
+
+   Files are stored in immutable segments, one per batch, which form an
+   append-only singly linked list. The writer fully builds a segment, links it
+   behind the current tail and then publishes it by swapping the tail pointer.
+   A reader loads the tail once and walks from the head up to it, so it always
+   sees a consistent, versioned snapshot without taking any lock, and the
+   gatherer never waits on queries. Segments are only freed with the index,
+   and nothing is ever removed, so a rescan fills a new index instead and
+   then swaps it in as the default one.
+
+   Within a segment nothing is stored as a full path. Each file is a fixed
+   size entry pointing at its directory and at its basename in a shared
+   string pool. Directories are front-coded against the previous one, with a
+   full restart every DIRECTORY_RESTART_INTERVAL entries, and the casefolded
+   basename used for matching is only stored separately when it differs.
+   Postings are flattened into a single array once the segment is built. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "saturn-file-index.h"
+
+#define TRIGRAM_LENGTH             3
+#define DIRECTORY_RESTART_INTERVAL 16
+
+typedef struct
+{
+  guint64 mask;
+  guint32 directory;
+  /* offsets into the name pool */
+  guint32 name;
+  guint32 folded;
+} Entry;
+
+typedef struct
+{
+  const guint32 *ids;
+  guint          length;
+} Postings;
+
+typedef struct _Segment Segment;
+struct _Segment
+{
+  /* written once, before the following segment is published */
+  Segment *next;
+
+  guint64 version;
+  /* global id of the first file in this segment */
+  guint base;
+  guint n_files;
+
+  Entry *entries;
+  char  *names;
+
+  /* varint shared prefix length followed by the NUL-terminated suffix */
+  guint8 *directories;
+  guint  *directory_restarts;
+  guint   n_directories;
+
+  /* sorted trigrams, the postings of trigram i being ids
+     [trigram_starts[i], trigram_starts[i + 1]) */
+  guint32 *trigrams;
+  guint   *trigram_starts;
+  guint32 *ids;
+  guint    n_trigrams;
+};
+
+struct _SaturnFileIndex
+{
+  GObject parent_instance;
+
+  /* serializes writers only */
+  GMutex writer_mutex;
+
+  Segment *head;
+  Segment *tail;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnFileIndex, saturn_file_index, G_TYPE_OBJECT);
+
+typedef struct
+{
+  const char **tokens;
+  guint        n_tokens;
+  guint64      mask;
+} Query;
+
+static Segment *
+segment_new (const char *const *paths,
+             guint              n_paths);
+
+static void
+segment_free (Segment *segment);
+
+static void
+segment_decode_directory (Segment *segment,
+                          guint    id,
+                          GString *out);
+
+static gboolean
+segment_lookup_trigram (Segment  *segment,
+                        guint32   trigram,
+                        Postings *out);
+
+static gboolean
+segment_query (Segment            *segment,
+               Query              *query,
+               SaturnFileIndexFunc func,
+               gpointer            user_data);
+
+static guint64
+string_mask (const char *folded);
+
+static gboolean
+verify_name (const char  *folded,
+             const char **tokens,
+             guint        n_tokens);
+
+static GArray *
+intersect_postings (GArray *postings);
+
+static void
+saturn_file_index_dispose (GObject *object)
+{
+  SaturnFileIndex *self = SATURN_FILE_INDEX (object);
+
+  while (self->head != NULL)
+    {
+      Segment *next = self->head->next;
+
+      segment_free (self->head);
+      self->head = next;
+    }
+  self->tail = NULL;
+
+  G_OBJECT_CLASS (saturn_file_index_parent_class)->dispose (object);
+}
+
+static void
+saturn_file_index_finalize (GObject *object)
+{
+  SaturnFileIndex *self = SATURN_FILE_INDEX (object);
+
+  g_mutex_clear (&self->writer_mutex);
+
+  G_OBJECT_CLASS (saturn_file_index_parent_class)->finalize (object);
+}
+
+static void
+saturn_file_index_class_init (SaturnFileIndexClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_file_index_dispose;
+  object_class->finalize = saturn_file_index_finalize;
+}
+
+static void
+saturn_file_index_init (SaturnFileIndex *self)
+{
+  g_mutex_init (&self->writer_mutex);
+}
+
+static GMutex           default_mutex = { 0 };
+static SaturnFileIndex *default_index = NULL;
+
+SaturnFileIndex *
+saturn_file_index_dup_default (void)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&default_mutex);
+  if (default_index == NULL)
+    default_index = saturn_file_index_new ();
+
+  return g_object_ref (default_index);
+}
+
+void
+saturn_file_index_set_default (SaturnFileIndex *self)
+{
+  g_autoptr (SaturnFileIndex) old = NULL;
+
+  g_return_if_fail (SATURN_IS_FILE_INDEX (self));
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker        = g_mutex_locker_new (&default_mutex);
+    old           = g_steal_pointer (&default_index);
+    default_index = g_object_ref (self);
+  }
+
+  /* readers still holding the old one keep it alive */
+}
+
+SaturnFileIndex *
+saturn_file_index_new (void)
+{
+  return g_object_new (SATURN_TYPE_FILE_INDEX, NULL);
+}
+
+void
+saturn_file_index_add_batch (SaturnFileIndex   *self,
+                             const char *const *paths,
+                             guint              n_paths)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+  Segment *segment                = NULL;
+  Segment *tail                   = NULL;
+
+  g_return_if_fail (SATURN_IS_FILE_INDEX (self));
+  g_return_if_fail (paths != NULL || n_paths == 0);
+
+  /* the expensive part happens before anything is shared */
+  segment = segment_new (paths, n_paths);
+  if (segment->n_files == 0)
+    {
+      segment_free (segment);
+      return;
+    }
+
+  locker = g_mutex_locker_new (&self->writer_mutex);
+
+  tail = self->tail;
+  if (tail != NULL)
+    {
+      segment->base    = tail->base + tail->n_files;
+      segment->version = tail->version + 1;
+      tail->next       = segment;
+    }
+  else
+    g_atomic_pointer_set (&self->head, segment);
+
+  /* publish */
+  g_atomic_pointer_set (&self->tail, segment);
+}
+
+guint
+saturn_file_index_get_n_files (SaturnFileIndex *self)
+{
+  Segment *tail = NULL;
+
+  g_return_val_if_fail (SATURN_IS_FILE_INDEX (self), 0);
+
+  tail = g_atomic_pointer_get (&self->tail);
+  return tail != NULL ? tail->base + tail->n_files : 0;
+}
+
+guint64
+saturn_file_index_get_version (SaturnFileIndex *self)
+{
+  Segment *tail = NULL;
+
+  g_return_val_if_fail (SATURN_IS_FILE_INDEX (self), 0);
+
+  tail = g_atomic_pointer_get (&self->tail);
+  return tail != NULL ? tail->version + 1 : 0;
+}
+
+void
+saturn_file_index_query (SaturnFileIndex    *self,
+                         const char         *query,
+                         SaturnFileIndexFunc func,
+                         gpointer            user_data)
+{
+  g_autofree char *folded        = NULL;
+  g_auto (GStrv) split           = NULL;
+  g_autofree const char **tokens = NULL;
+  Query    parsed                = { 0 };
+  Segment *tail                  = NULL;
+
+  g_return_if_fail (SATURN_IS_FILE_INDEX (self));
+  g_return_if_fail (query != NULL);
+  g_return_if_fail (func != NULL);
+
+  folded = g_utf8_casefold (query, -1);
+  split  = g_strsplit (folded, " ", -1);
+  tokens = g_new0 (const char *, g_strv_length (split) + 1);
+
+  parsed.tokens = tokens;
+  for (guint i = 0; split[i] != NULL; i++)
+    {
+      if (*split[i] != '\0')
+        {
+          tokens[parsed.n_tokens++] = split[i];
+          parsed.mask |= string_mask (split[i]);
+        }
+    }
+
+  /* everything up to this tail is our snapshot, whatever gets appended
+     while we work is simply not seen */
+  tail = g_atomic_pointer_get (&self->tail);
+  if (tail == NULL)
+    return;
+
+  for (Segment *segment = g_atomic_pointer_get (&self->head);
+       segment != NULL;
+       segment = segment->next)
+    {
+      if (!segment_query (segment, &parsed, func, user_data))
+        return;
+      if (segment == tail)
+        break;
+    }
+}
+
+void
+saturn_file_index_foreach (SaturnFileIndex    *self,
+                           SaturnFileIndexFunc func,
+                           gpointer            user_data)
+{
+  g_return_if_fail (SATURN_IS_FILE_INDEX (self));
+  g_return_if_fail (func != NULL);
+
+  saturn_file_index_foreach_since (self, 0, func, user_data);
+}
+
+guint64
+saturn_file_index_foreach_since (SaturnFileIndex    *self,
+                                 guint64             version,
+                                 SaturnFileIndexFunc func,
+                                 gpointer            user_data)
+{
+  g_autoptr (GString) directory = NULL;
+  Segment *tail                 = NULL;
+
+  g_return_val_if_fail (SATURN_IS_FILE_INDEX (self), 0);
+  g_return_val_if_fail (func != NULL, 0);
+
+  tail = g_atomic_pointer_get (&self->tail);
+  if (tail == NULL)
+    return 0;
+
+  directory = g_string_new (NULL);
+  for (Segment *segment = g_atomic_pointer_get (&self->head);
+       segment != NULL;
+       segment = segment->next)
+    {
+      guint last_directory = G_MAXUINT;
+
+      /* anything older was already seen by the caller */
+      for (guint i = 0; segment->version >= version && i < segment->n_files; i++)
+        {
+          Entry *entry = segment->entries + i;
+
+          if (entry->directory != last_directory)
+            {
+              segment_decode_directory (segment, entry->directory, directory);
+              last_directory = entry->directory;
+            }
+          if (!func (directory->str, segment->names + entry->name, user_data))
+            return tail->version + 1;
+        }
+
+      if (segment == tail)
+        break;
+    }
+
+  return tail->version + 1;
+}
+
+static gint
+cmp_trigram (gconstpointer a,
+             gconstpointer b)
+{
+  guint32 trigram_a = GPOINTER_TO_UINT (*(gconstpointer *) a);
+  guint32 trigram_b = GPOINTER_TO_UINT (*(gconstpointer *) b);
+
+  return trigram_a < trigram_b ? -1 : trigram_a > trigram_b ? 1 : 0;
+}
+
+static Segment *
+segment_new (const char *const *paths,
+             guint              n_paths)
+{
+  Segment *segment                      = NULL;
+  g_autoptr (GHashTable) directory_ids  = NULL;
+  g_autoptr (GHashTable) trigrams       = NULL;
+  g_autoptr (GString) names             = NULL;
+  g_autoptr (GByteArray) directories    = NULL;
+  g_autoptr (GArray) directory_restarts = NULL;
+  g_autoptr (GString) last_directory    = NULL;
+  g_autofree gpointer *keys             = NULL;
+  guint n_keys                          = 0;
+  guint n_ids                           = 0;
+
+  segment          = g_new0 (Segment, 1);
+  segment->entries = g_new0 (Entry, MAX (n_paths, 1));
+
+  directory_ids = g_hash_table_new_full (
+      g_str_hash, g_str_equal, g_free, NULL);
+  trigrams = g_hash_table_new_full (
+      g_direct_hash, g_direct_equal,
+      NULL, (GDestroyNotify) g_array_unref);
+  names              = g_string_new (NULL);
+  directories        = g_byte_array_new ();
+  directory_restarts = g_array_new (FALSE, FALSE, sizeof (guint));
+  last_directory     = g_string_new (NULL);
+
+  for (guint i = 0; i < n_paths; i++)
+    {
+      const char      *path      = paths[i];
+      const char      *name      = NULL;
+      g_autofree char *directory = NULL;
+      g_autofree char *folded    = NULL;
+      gpointer         lookup    = NULL;
+      gsize            length    = 0;
+      Entry           *entry     = NULL;
+      guint32          id        = 0;
+
+      if (path == NULL)
+        continue;
+
+      name = strrchr (path, '/');
+      name = name != NULL ? name + 1 : path;
+      if (*name == '\0')
+        continue;
+
+      id    = segment->n_files++;
+      entry = segment->entries + id;
+
+      /* directories almost always arrive grouped, so front-coding against
+         the previously added one captures nearly all of the sharing */
+      directory = g_strndup (path, name - path);
+      if (g_hash_table_lookup_extended (directory_ids, directory, NULL, &lookup))
+        entry->directory = GPOINTER_TO_UINT (lookup);
+      else
+        {
+          gsize  shared = 0;
+          guint8 byte   = 0;
+
+          entry->directory = segment->n_directories++;
+
+          if (entry->directory % DIRECTORY_RESTART_INTERVAL == 0)
+            {
+              guint offset = directories->len;
+
+              g_array_append_val (directory_restarts, offset);
+              g_string_truncate (last_directory, 0);
+            }
+
+          while (shared < last_directory->len &&
+                 last_directory->str[shared] == directory[shared])
+            shared++;
+
+          length = shared;
+          do
+            {
+              byte = length & 0x7f;
+              length >>= 7;
+              if (length > 0)
+                byte |= 0x80;
+              g_byte_array_append (directories, &byte, 1);
+            }
+          while (length > 0);
+          g_byte_array_append (
+              directories,
+              (const guint8 *) directory + shared,
+              strlen (directory + shared) + 1);
+
+          g_string_assign (last_directory, directory);
+          g_hash_table_replace (
+              directory_ids,
+              g_steal_pointer (&directory),
+              GUINT_TO_POINTER (entry->directory));
+        }
+
+      folded = g_utf8_casefold (name, -1);
+      length = strlen (folded);
+
+      entry->mask = string_mask (folded);
+      entry->name = names->len;
+      g_string_append_len (names, name, strlen (name) + 1);
+      if (strcmp (folded, name) == 0)
+        entry->folded = entry->name;
+      else
+        {
+          entry->folded = names->len;
+          g_string_append_len (names, folded, length + 1);
+        }
+
+      for (gsize j = 0; j + TRIGRAM_LENGTH <= length; j++)
+        {
+          guint32 trigram  = 0;
+          GArray *postings = NULL;
+
+          trigram = (guchar) folded[j] << 16 |
+                    (guchar) folded[j + 1] << 8 |
+                    (guchar) folded[j + 2];
+
+          postings = g_hash_table_lookup (trigrams, GUINT_TO_POINTER (trigram));
+          if (postings == NULL)
+            {
+              postings = g_array_new (FALSE, FALSE, sizeof (guint32));
+              g_hash_table_replace (trigrams, GUINT_TO_POINTER (trigram), postings);
+            }
+          else if (g_array_index (postings, guint32, postings->len - 1) == id)
+            /* repeated trigram in the same name */
+            continue;
+
+          g_array_append_val (postings, id);
+          n_ids++;
+        }
+    }
+
+  segment->entries            = g_renew (Entry, segment->entries, MAX (segment->n_files, 1));
+  segment->names              = g_string_free (g_steal_pointer (&names), FALSE);
+  segment->directories        = g_byte_array_free (g_steal_pointer (&directories), FALSE);
+  segment->directory_restarts = (guint *) (gpointer) g_array_free (g_steal_pointer (&directory_restarts), FALSE);
+
+  keys = g_hash_table_get_keys_as_array (trigrams, &n_keys);
+  qsort (keys, n_keys, sizeof (*keys), cmp_trigram);
+
+  segment->n_trigrams     = n_keys;
+  segment->trigrams       = g_new (guint32, MAX (n_keys, 1));
+  segment->trigram_starts = g_new (guint, n_keys + 1);
+  segment->ids            = g_new (guint32, MAX (n_ids, 1));
+
+  n_ids = 0;
+  for (guint i = 0; i < n_keys; i++)
+    {
+      GArray *postings = g_hash_table_lookup (trigrams, keys[i]);
+
+      segment->trigrams[i]       = GPOINTER_TO_UINT (keys[i]);
+      segment->trigram_starts[i] = n_ids;
+      memcpy (segment->ids + n_ids, postings->data, postings->len * sizeof (guint32));
+      n_ids += postings->len;
+    }
+  segment->trigram_starts[n_keys] = n_ids;
+
+  return segment;
+}
+
+static void
+segment_free (Segment *segment)
+{
+  g_free (segment->entries);
+  g_free (segment->names);
+  g_free (segment->directories);
+  g_free (segment->directory_restarts);
+  g_free (segment->trigrams);
+  g_free (segment->trigram_starts);
+  g_free (segment->ids);
+  g_free (segment);
+}
+
+static void
+segment_decode_directory (Segment *segment,
+                          guint    id,
+                          GString *out)
+{
+  const guint8 *p = NULL;
+
+  p = segment->directories + segment->directory_restarts[id / DIRECTORY_RESTART_INTERVAL];
+  for (guint i = id - id % DIRECTORY_RESTART_INTERVAL; i <= id; i++)
+    {
+      gsize shared = 0;
+      guint shift  = 0;
+
+      do
+        {
+          shared |= (gsize) (*p & 0x7f) << shift;
+          shift += 7;
+        }
+      while (*p++ & 0x80);
+
+      g_string_truncate (out, shared);
+      g_string_append (out, (const char *) p);
+      p += out->len - shared + 1;
+    }
+}
+
+static gboolean
+segment_lookup_trigram (Segment  *segment,
+                        guint32   trigram,
+                        Postings *out)
+{
+  guint lo = 0;
+  guint hi = segment->n_trigrams;
+
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+
+      if (segment->trigrams[mid] < trigram)
+        lo = mid + 1;
+      else if (segment->trigrams[mid] > trigram)
+        hi = mid;
+      else
+        {
+          out->ids    = segment->ids + segment->trigram_starts[mid];
+          out->length = segment->trigram_starts[mid + 1] - segment->trigram_starts[mid];
+          return TRUE;
+        }
+    }
+
+  return FALSE;
+}
+
+static gboolean
+segment_query (Segment            *segment,
+               Query              *query,
+               SaturnFileIndexFunc func,
+               gpointer            user_data)
+{
+  g_autoptr (GArray) postings   = NULL;
+  g_autoptr (GArray) candidates = NULL;
+  g_autoptr (GString) directory = NULL;
+  guint last_directory          = G_MAXUINT;
+
+  postings = g_array_new (FALSE, FALSE, sizeof (Postings));
+  for (guint i = 0; i < query->n_tokens; i++)
+    {
+      const char *token  = query->tokens[i];
+      gsize       length = 0;
+
+      length = strlen (token);
+      for (gsize j = 0; j + TRIGRAM_LENGTH <= length; j++)
+        {
+          guint32  trigram = 0;
+          Postings list    = { 0 };
+
+          trigram = (guchar) token[j] << 16 |
+                    (guchar) token[j + 1] << 8 |
+                    (guchar) token[j + 2];
+
+          if (!segment_lookup_trigram (segment, trigram, &list))
+            /* no file in this segment contains this trigram */
+            return TRUE;
+          g_array_append_val (postings, list);
+        }
+    }
+
+  if (postings->len > 0)
+    candidates = intersect_postings (postings);
+
+  directory = g_string_new (NULL);
+
+#define EMIT(_id)                                                                 \
+  G_STMT_START                                                                    \
+  {                                                                               \
+    Entry *_entry = segment->entries + (_id);                                     \
+                                                                                  \
+    if ((_entry->mask & query->mask) == query->mask &&                            \
+        verify_name (segment->names + _entry->folded,                             \
+                     query->tokens, query->n_tokens))                             \
+      {                                                                           \
+        if (_entry->directory != last_directory)                                  \
+          {                                                                       \
+            segment_decode_directory (segment, _entry->directory, directory);     \
+            last_directory = _entry->directory;                                   \
+          }                                                                       \
+        if (!func (directory->str, segment->names + _entry->name, user_data))     \
+          return FALSE;                                                           \
+      }                                                                           \
+  }                                                                               \
+  G_STMT_END
+
+  if (candidates != NULL)
+    {
+      for (guint i = 0; i < candidates->len; i++)
+        EMIT (g_array_index (candidates, guint32, i));
+    }
+  else
+    {
+      for (guint i = 0; i < segment->n_files; i++)
+        EMIT (i);
+    }
+
+#undef EMIT
+
+  return TRUE;
+}
+
+static guint64
+string_mask (const char *folded)
+{
+  guint64 mask = 0;
+
+  for (const guchar *p = (const guchar *) folded; *p != '\0'; p++)
+    {
+      if (*p >= 'a' && *p <= 'z')
+        mask |= G_GUINT64_CONSTANT (1) << (*p - 'a');
+      else if (*p >= '0' && *p <= '9')
+        mask |= G_GUINT64_CONSTANT (1) << (26 + *p - '0');
+      else
+        mask |= G_GUINT64_CONSTANT (1) << (36 + *p % 28);
+    }
+
+  return mask;
+}
+
+static gboolean
+verify_name (const char  *folded,
+             const char **tokens,
+             guint        n_tokens)
+{
+  for (guint i = 0; i < n_tokens; i++)
+    {
+      if (strstr (folded, tokens[i]) == NULL)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+static gint
+cmp_postings_length (const Postings *a,
+                     const Postings *b)
+{
+  return (gint) a->length - (gint) b->length;
+}
+
+static GArray *
+intersect_postings (GArray *postings)
+{
+  Postings *smallest   = NULL;
+  GArray   *candidates = NULL;
+
+  /* start with the rarest trigram so that the working set only shrinks */
+  g_array_sort (postings, (GCompareFunc) cmp_postings_length);
+
+  smallest   = &g_array_index (postings, Postings, 0);
+  candidates = g_array_sized_new (FALSE, FALSE, sizeof (guint32), smallest->length);
+  g_array_append_vals (candidates, smallest->ids, smallest->length);
+
+  for (guint i = 1; i < postings->len && candidates->len > 0; i++)
+    {
+      Postings *list = &g_array_index (postings, Postings, i);
+      guint     a    = 0;
+      guint     b    = 0;
+      guint     out  = 0;
+
+      if (list->ids == smallest->ids)
+        continue;
+
+      while (a < candidates->len && b < list->length)
+        {
+          guint32 a_id = g_array_index (candidates, guint32, a);
+          guint32 b_id = list->ids[b];
+
+          if (a_id < b_id)
+            a++;
+          else if (a_id > b_id)
+            b++;
+          else
+            {
+              g_array_index (candidates, guint32, out++) = a_id;
+              a++;
+              b++;
+            }
+        }
+      g_array_set_size (candidates, out);
+    }
+
+  return candidates;
+}
+
+/* End of saturn-file-index.c */
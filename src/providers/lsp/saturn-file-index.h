@@ -0,0 +1,81 @@
+/* saturn-file-index.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_FILE_INDEX (saturn_file_index_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnFileIndex, saturn_file_index, SATURN, FILE_INDEX, GObject)
+
+/* `directory` always has a trailing slash. Return FALSE to stop the query */
+typedef gboolean (*SaturnFileIndexFunc) (const char *directory,
+                                         const char *name,
+                                         gpointer    user_data);
+
+/* The index the fs provider fills, which a rescan replaces wholesale, so
+   hold on to the returned reference for as long as a query runs */
+SaturnFileIndex *
+saturn_file_index_dup_default (void);
+
+void
+saturn_file_index_set_default (SaturnFileIndex *self);
+
+SaturnFileIndex *
+saturn_file_index_new (void);
+
+void
+saturn_file_index_add_batch (SaturnFileIndex   *self,
+                             const char *const *paths,
+                             guint              n_paths);
+
+guint
+saturn_file_index_get_n_files (SaturnFileIndex *self);
+
+/* Bumped every time a batch is published, 0 while empty */
+guint64
+saturn_file_index_get_version (SaturnFileIndex *self);
+
+void
+saturn_file_index_query (SaturnFileIndex    *self,
+                         const char         *query,
+                         SaturnFileIndexFunc func,
+                         gpointer            user_data);
+
+/* Visits every file in the current snapshot */
+void
+saturn_file_index_foreach (SaturnFileIndex    *self,
+                           SaturnFileIndexFunc func,
+                           gpointer            user_data);
+
+/* Only visits the files published once the index was at `version`, and
+   returns the version of the snapshot visited, which is what to pass next
+   time to see just the files added in between */
+guint64
+saturn_file_index_foreach_since (SaturnFileIndex    *self,
+                                 guint64             version,
+                                 SaturnFileIndexFunc func,
+                                 gpointer            user_data);
+
+G_END_DECLS
+
+/* End of saturn-file-index.h */
@@ -0,0 +1,752 @@
+/* saturn-git-index.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* Tracked files come straight out of .git/index (versions 2 through 4, see
+   gitformat-index(5)). Untracked files are found by walking the work tree
+   and filtering with the same exclude sources `--exclude-standard` uses:
+   per-directory .gitignore files, .git/info/exclude and the user's global
+   ignore file. Split and sparse indexes are not supported. */
+
+#define G_LOG_DOMAIN "SATURN::GIT-INDEX"
+
+#include <string.h>
+#include <sys/stat.h>
+
+#include "saturn-git-index.h"
+
+#define CACHE_MAGIC "saturn-git-list-files 2\n"
+
+typedef struct
+{
+  char    *pattern;
+  gboolean negated;
+  gboolean dir_only;
+  /* the pattern contains a slash, so it matches against the path relative
+     to the ignore file rather than just the basename */
+  gboolean anchored;
+} IgnoreRule;
+
+typedef struct
+{
+  /* directory of the ignore file relative to the work tree, with a
+     trailing slash, or "" for the top level */
+  char   *base;
+  GArray *rules;
+} IgnoreList;
+
+typedef struct
+{
+  const char *worktree;
+  GHashTable *tracked;
+  GPtrArray  *lists;
+  GPtrArray  *files;
+} Walk;
+
+static gint64
+get_index_mtime (const char *index_path);
+
+static gboolean
+read_index (const char *index_path,
+            gsize       hash_length,
+            GPtrArray  *files,
+            GError    **error);
+
+static gsize
+get_hash_length (const char *git_dir);
+
+static GPtrArray *
+read_cache_file (const char *path,
+                 gint64      mtime);
+
+static void
+write_cache_file (const char *path,
+                  gint64      mtime,
+                  GPtrArray  *files);
+
+static IgnoreList *
+ignore_list_load (const char *path,
+                  const char *base);
+
+static void
+ignore_list_free (IgnoreList *list);
+
+static gboolean
+is_ignored (Walk       *walk,
+            const char *path,
+            const char *name,
+            gboolean    is_dir);
+
+static gboolean
+wildmatch (const char *pattern,
+           const char *text);
+
+static void
+walk_directory (Walk    *walk,
+                GString *relative);
+
+GPtrArray *
+saturn_git_list_files (const char *worktree,
+                       const char *cache_dir,
+                       GError    **error)
+{
+  g_autofree char *git_dir          = NULL;
+  g_autofree char *index_path       = NULL;
+  g_autofree char *cache_path       = NULL;
+  gint64           mtime            = 0;
+  g_autoptr (GPtrArray) files       = NULL;
+  g_autoptr (GHashTable) tracked    = NULL;
+  g_autoptr (GPtrArray) lists       = NULL;
+  g_autoptr (GString) relative      = NULL;
+  g_autofree char *global_exclude   = NULL;
+  g_autofree char *info_exclude     = NULL;
+  Walk             walk             = { 0 };
+
+  g_return_val_if_fail (worktree != NULL, NULL);
+
+  git_dir = g_build_filename (worktree, ".git", NULL);
+  if (!g_file_test (git_dir, G_FILE_TEST_IS_DIR))
+    {
+      /* a gitfile pointing elsewhere, as with linked worktrees */
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                   "%s is not a directory", git_dir);
+      return NULL;
+    }
+
+  index_path = g_build_filename (git_dir, "index", NULL);
+  mtime      = get_index_mtime (index_path);
+
+  /* only the tracked files are cached, since they are all that .git/index
+     vouches for. New untracked files and edited ignore files have to show
+     up, so the work tree is walked every time */
+  if (cache_dir != NULL)
+    {
+      g_autofree char *checksum = NULL;
+
+      checksum   = g_compute_checksum_for_string (G_CHECKSUM_SHA1, worktree, -1);
+      cache_path = g_build_filename (cache_dir, "git-index", checksum, NULL);
+      files      = read_cache_file (cache_path, mtime);
+    }
+
+  if (files == NULL)
+    {
+      files = g_ptr_array_new_with_free_func (g_free);
+      if (!read_index (index_path, get_hash_length (git_dir), files, error))
+        return NULL;
+
+      if (cache_path != NULL)
+        write_cache_file (cache_path, mtime, files);
+    }
+
+  tracked = g_hash_table_new (g_str_hash, g_str_equal);
+  for (guint i = 0; i < files->len; i++)
+    g_hash_table_add (tracked, g_ptr_array_index (files, i));
+
+  lists = g_ptr_array_new_with_free_func ((GDestroyNotify) ignore_list_free);
+
+  /* lowest precedence first, see gitignore(5) */
+  global_exclude = g_build_filename (g_get_user_config_dir (), "git", "ignore", NULL);
+  g_ptr_array_add (lists, ignore_list_load (global_exclude, ""));
+  info_exclude = g_build_filename (git_dir, "info", "exclude", NULL);
+  g_ptr_array_add (lists, ignore_list_load (info_exclude, ""));
+
+  walk.worktree = worktree;
+  walk.tracked  = tracked;
+  walk.lists    = lists;
+  walk.files    = files;
+
+  relative = g_string_new (NULL);
+  walk_directory (&walk, relative);
+
+  return g_steal_pointer (&files);
+}
+
+static gint64
+get_index_mtime (const char *index_path)
+{
+  struct stat st = { 0 };
+
+  if (stat (index_path, &st) != 0)
+    /* a repository without any commits or staged files */
+    return 0;
+
+  return (gint64) st.st_mtim.tv_sec * G_GINT64_CONSTANT (1000000000) + st.st_mtim.tv_nsec;
+}
+
+static gsize
+get_hash_length (const char *git_dir)
+{
+  g_autofree char *config_path = NULL;
+  g_autofree char *contents    = NULL;
+  g_autofree char *lower       = NULL;
+  const char      *p           = NULL;
+
+  config_path = g_build_filename (git_dir, "config", NULL);
+  if (!g_file_get_contents (config_path, &contents, NULL, NULL))
+    return 20;
+
+  /* only `extensions.objectFormat = sha256` changes anything */
+  lower = g_ascii_strdown (contents, -1);
+  p     = strstr (lower, "objectformat");
+  if (p == NULL)
+    return 20;
+
+  p += strlen ("objectformat");
+  while (*p == ' ' || *p == '\t' || *p == '=')
+    p++;
+
+  return g_str_has_prefix (p, "sha256") ? 32 : 20;
+}
+
+static inline guint32
+read_be32 (const guint8 *p)
+{
+  guint32 value = 0;
+
+  memcpy (&value, p, sizeof (value));
+  return GUINT32_FROM_BE (value);
+}
+
+static inline guint16
+read_be16 (const guint8 *p)
+{
+  guint16 value = 0;
+
+  memcpy (&value, p, sizeof (value));
+  return GUINT16_FROM_BE (value);
+}
+
+static gboolean
+decode_varint (const guint8 **p,
+               const guint8  *end,
+               guint64       *out)
+{
+  const guint8 *q     = *p;
+  guint64       value = 0;
+  guint8        c     = 0;
+
+  /* the offset encoding also used by packfiles, where each continuation
+     adds one so that every value has exactly one representation */
+  if (q >= end)
+    return FALSE;
+  c     = *q++;
+  value = c & 0x7f;
+  while (c & 0x80)
+    {
+      if (q >= end)
+        return FALSE;
+      c     = *q++;
+      value = ((value + 1) << 7) | (c & 0x7f);
+    }
+
+  *p   = q;
+  *out = value;
+  return TRUE;
+}
+
+static gboolean
+read_index (const char *index_path,
+            gsize       hash_length,
+            GPtrArray  *files,
+            GError    **error)
+{
+  g_autoptr (GError) local_error = NULL;
+  g_autoptr (GMappedFile) mapped = NULL;
+  g_autoptr (GString) name       = NULL;
+  const guint8 *data             = NULL;
+  gsize         length           = 0;
+  const guint8 *p                = NULL;
+  const guint8 *end              = NULL;
+  guint32       version          = 0;
+  guint32       n_entries        = 0;
+
+  mapped = g_mapped_file_new (index_path, FALSE, &local_error);
+  if (mapped == NULL)
+    {
+      if (g_error_matches (local_error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+        return TRUE;
+      g_propagate_error (error, g_steal_pointer (&local_error));
+      return FALSE;
+    }
+
+  data   = (const guint8 *) g_mapped_file_get_contents (mapped);
+  length = g_mapped_file_get_length (mapped);
+
+#define INVALID()                                                   \
+  G_STMT_START                                                      \
+  {                                                                 \
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,        \
+                 "%s is malformed at offset %" G_GSIZE_FORMAT,      \
+                 index_path, (gsize) (p != NULL ? p - data : 0));   \
+    return FALSE;                                                   \
+  }                                                                 \
+  G_STMT_END
+
+  if (length < 12 + hash_length || memcmp (data, "DIRC", 4) != 0)
+    INVALID ();
+
+  version   = read_be32 (data + 4);
+  n_entries = read_be32 (data + 8);
+  if (version < 2 || version > 4)
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                   "%s has unsupported version %u", index_path, version);
+      return FALSE;
+    }
+
+  p    = data + 12;
+  end  = data + length - hash_length;
+  name = g_string_new (NULL);
+
+  for (guint32 i = 0; i < n_entries; i++)
+    {
+      const guint8 *entry  = p;
+      const guint8 *nul    = NULL;
+      guint32       mode   = 0;
+      guint16       flags  = 0;
+      gsize         header = 0;
+
+      /* ctime, mtime, dev, ino, mode, uid, gid, size, object id, flags */
+      header = 40 + hash_length + 2;
+      if ((gsize) (end - p) < header)
+        INVALID ();
+
+      mode  = read_be32 (p + 24);
+      flags = read_be16 (p + 40 + hash_length);
+      p += header;
+
+      if (flags & 0x4000)
+        {
+          /* extended flags */
+          if (version < 3 || end - p < 2)
+            INVALID ();
+          p += 2;
+        }
+
+      if (version == 4)
+        {
+          guint64 strip = 0;
+
+          /* the name is the previous one minus `strip` trailing bytes, plus
+             the suffix which follows */
+          if (!decode_varint (&p, end, &strip) || strip > name->len)
+            INVALID ();
+          g_string_truncate (name, name->len - strip);
+
+          nul = memchr (p, '\0', end - p);
+          if (nul == NULL)
+            INVALID ();
+          g_string_append_len (name, (const char *) p, nul - p);
+          p = nul + 1;
+        }
+      else
+        {
+          nul = memchr (p, '\0', end - p);
+          if (nul == NULL)
+            INVALID ();
+          g_string_assign (name, "");
+          g_string_append_len (name, (const char *) p, nul - p);
+
+          /* entries are NUL padded to a multiple of eight */
+          p = entry + ((p - entry + (nul - p) + 8) & ~7);
+          if (p > end)
+            INVALID ();
+        }
+
+      if ((mode & S_IFMT) == S_IFDIR)
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                       "%s is a sparse index", index_path);
+          return FALSE;
+        }
+
+      /* unmerged paths have one entry per stage */
+      if (files->len > 0 &&
+          strcmp (g_ptr_array_index (files, files->len - 1), name->str) == 0)
+        continue;
+
+      g_ptr_array_add (files, g_strdup (name->str));
+    }
+
+  while (end - p >= 8)
+    {
+      guint32 size = read_be32 (p + 4);
+
+      if (memcmp (p, "link", 4) == 0)
+        {
+          /* the entries above are only a delta against a shared index */
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                       "%s is a split index", index_path);
+          return FALSE;
+        }
+      if ((gsize) (end - p - 8) < size)
+        INVALID ();
+      p += 8 + size;
+    }
+
+#undef INVALID
+
+  return TRUE;
+}
+
+static GPtrArray *
+read_cache_file (const char *path,
+                 gint64      mtime)
+{
+  g_autofree char *contents   = NULL;
+  gsize            length     = 0;
+  const char      *p          = NULL;
+  const char      *end        = NULL;
+  char            *newline    = NULL;
+  gint64           file_mtime = 0;
+  GPtrArray       *files      = NULL;
+
+  if (!g_file_get_contents (path, &contents, &length, NULL))
+    return NULL;
+  if (!g_str_has_prefix (contents, CACHE_MAGIC))
+    return NULL;
+
+  /* magic, mtime line, then NUL terminated paths */
+  p       = contents + strlen (CACHE_MAGIC);
+  end     = contents + length;
+  newline = memchr (p, '\n', end - p);
+  if (newline == NULL)
+    return NULL;
+  *newline   = '\0';
+  file_mtime = g_ascii_strtoll (p, NULL, 10);
+  if (file_mtime != mtime)
+    return NULL;
+
+  files = g_ptr_array_new_with_free_func (g_free);
+  for (p = newline + 1; p < end;)
+    {
+      gsize n = strnlen (p, end - p);
+
+      g_ptr_array_add (files, g_strndup (p, n));
+      p += n + 1;
+    }
+
+  return files;
+}
+
+static void
+write_cache_file (const char *path,
+                  gint64      mtime,
+                  GPtrArray  *files)
+{
+  g_autoptr (GError) local_error = NULL;
+  g_autofree char *dirname       = NULL;
+  g_autoptr (GString) contents   = NULL;
+
+  dirname = g_path_get_dirname (path);
+  g_mkdir_with_parents (dirname, 0755);
+
+  contents = g_string_new (CACHE_MAGIC);
+  g_string_append_printf (contents, "%" G_GINT64_FORMAT "\n", mtime);
+  for (guint i = 0; i < files->len; i++)
+    {
+      const char *file = g_ptr_array_index (files, i);
+
+      g_string_append_len (contents, file, strlen (file) + 1);
+    }
+
+  if (!g_file_set_contents (path, contents->str, contents->len, &local_error))
+    g_warning ("Unable to write git file list cache to %s: %s",
+               path, local_error->message);
+}
+
+static IgnoreList *
+ignore_list_load (const char *path,
+                  const char *base)
+{
+  g_autofree char *contents = NULL;
+  g_auto (GStrv) lines      = NULL;
+  IgnoreList      *list     = NULL;
+
+  list        = g_new0 (IgnoreList, 1);
+  list->base  = g_strdup (base);
+  list->rules = g_array_new (FALSE, TRUE, sizeof (IgnoreRule));
+
+  if (!g_file_get_contents (path, &contents, NULL, NULL))
+    return list;
+
+  lines = g_strsplit (contents, "\n", -1);
+  for (guint i = 0; lines[i] != NULL; i++)
+    {
+      char      *line   = lines[i];
+      gsize      length = 0;
+      IgnoreRule rule   = { 0 };
+
+      length = strlen (line);
+      if (length > 0 && line[length - 1] == '\r')
+        line[--length] = '\0';
+
+      /* trailing spaces are ignored unless escaped */
+      while (length > 0 && line[length - 1] == ' ' &&
+             !(length > 1 && line[length - 2] == '\\'))
+        line[--length] = '\0';
+
+      if (length == 0 || *line == '#')
+        continue;
+
+      if (*line == '!')
+        {
+          rule.negated = TRUE;
+          line++;
+          length--;
+        }
+      else if (*line == '\\' && (line[1] == '!' || line[1] == '#'))
+        {
+          line++;
+          length--;
+        }
+
+      if (length > 0 && line[length - 1] == '/')
+        {
+          rule.dir_only    = TRUE;
+          line[--length] = '\0';
+        }
+
+      if (length == 0)
+        continue;
+
+      rule.anchored = strchr (line, '/') != NULL;
+      if (*line == '/')
+        line++;
+
+      rule.pattern = g_strdup (line);
+      g_array_append_val (list->rules, rule);
+    }
+
+  return list;
+}
+
+static void
+ignore_list_free (IgnoreList *list)
+{
+  for (guint i = 0; i < list->rules->len; i++)
+    g_free (g_array_index (list->rules, IgnoreRule, i).pattern);
+  g_array_unref (list->rules);
+  g_free (list->base);
+  g_free (list);
+}
+
+static gboolean
+is_ignored (Walk       *walk,
+            const char *path,
+            const char *name,
+            gboolean    is_dir)
+{
+  /* deeper ignore files take precedence, and within a file the last
+     matching rule wins */
+  for (guint i = walk->lists->len; i > 0; i--)
+    {
+      IgnoreList *list     = g_ptr_array_index (walk->lists, i - 1);
+      const char *relative = path + strlen (list->base);
+
+      for (guint j = list->rules->len; j > 0; j--)
+        {
+          IgnoreRule *rule = &g_array_index (list->rules, IgnoreRule, j - 1);
+
+          if (rule->dir_only && !is_dir)
+            continue;
+
+          if (wildmatch (rule->pattern, rule->anchored ? relative : name))
+            return !rule->negated;
+        }
+    }
+
+  return FALSE;
+}
+
+/* gitignore flavored fnmatch, where `*` and `?` stop at slashes and `**`
+   spans any number of directories */
+static gboolean
+wildmatch (const char *pattern,
+           const char *text)
+{
+  const char *p = pattern;
+  const char *t = text;
+
+  for (; *p != '\0'; p++, t++)
+    {
+      switch (*p)
+        {
+        case '?':
+          if (*t == '\0' || *t == '/')
+            return FALSE;
+          break;
+
+        case '*':
+          if (p[1] == '*' &&
+              (p == pattern || p[-1] == '/') &&
+              (p[2] == '\0' || p[2] == '/'))
+            {
+              if (p[2] == '\0')
+                return TRUE;
+
+              /* zero or more leading directories */
+              if (wildmatch (p + 3, t))
+                return TRUE;
+              for (; *t != '\0'; t++)
+                {
+                  if (*t == '/' && wildmatch (p + 3, t + 1))
+                    return TRUE;
+                }
+              return FALSE;
+            }
+
+          while (*p == '*')
+            p++;
+          if (*p == '\0')
+            return strchr (t, '/') == NULL;
+
+          for (;; t++)
+            {
+              if (wildmatch (p, t))
+                return TRUE;
+              if (*t == '\0' || *t == '/')
+                return FALSE;
+            }
+
+        case '[':
+          {
+            const char *c       = p + 1;
+            gboolean    negated = FALSE;
+            gboolean    matched = FALSE;
+
+            if (*c == '!' || *c == '^')
+              {
+                negated = TRUE;
+                c++;
+              }
+
+            /* a leading ] is literal */
+            do
+              {
+                if (*c == '\0')
+                  break;
+                if (c[1] == '-' && c[2] != ']' && c[2] != '\0')
+                  {
+                    if (*t >= c[0] && *t <= c[2])
+                      matched = TRUE;
+                    c += 3;
+                  }
+                else
+                  {
+                    if (*t == *c)
+                      matched = TRUE;
+                    c++;
+                  }
+              }
+            while (*c != ']');
+
+            if (*c == '\0')
+              {
+                /* unterminated, so take the bracket literally */
+                if (*t != '[')
+                  return FALSE;
+                break;
+              }
+
+            if (*t == '\0' || *t == '/' || matched == negated)
+              return FALSE;
+            p = c;
+          }
+          break;
+
+        case '\\':
+          if (p[1] != '\0')
+            p++;
+          if (*t != *p)
+            return FALSE;
+          break;
+
+        default:
+          if (*t != *p)
+            return FALSE;
+          break;
+        }
+    }
+
+  return *t == '\0';
+}
+
+static void
+walk_directory (Walk    *walk,
+                GString *relative)
+{
+  g_autofree char *path       = NULL;
+  g_autofree char *ignore     = NULL;
+  g_autoptr (GDir) dir        = NULL;
+  IgnoreList      *list       = NULL;
+  const char      *name       = NULL;
+  gsize            prefix_len = 0;
+
+  path = g_build_filename (walk->worktree, relative->str, NULL);
+  dir  = g_dir_open (path, 0, NULL);
+  if (dir == NULL)
+    return;
+
+  ignore = g_build_filename (path, ".gitignore", NULL);
+  list   = ignore_list_load (ignore, relative->str);
+  if (list->rules->len > 0)
+    g_ptr_array_add (walk->lists, list);
+  else
+    g_clear_pointer (&list, ignore_list_free);
+
+  prefix_len = relative->len;
+  while ((name = g_dir_read_name (dir)) != NULL)
+    {
+      g_autofree char *child = NULL;
+      struct stat      st    = { 0 };
+
+      if (strcmp (name, ".git") == 0)
+        continue;
+
+      g_string_append (relative, name);
+      child = g_build_filename (path, name, NULL);
+
+      if (lstat (child, &st) == 0 &&
+          !is_ignored (walk, relative->str, name, S_ISDIR (st.st_mode)))
+        {
+          if (S_ISDIR (st.st_mode))
+            {
+              g_autofree char *nested = NULL;
+
+              /* nested repositories are left to their own index */
+              nested = g_build_filename (child, ".git", NULL);
+              if (!g_file_test (nested, G_FILE_TEST_EXISTS))
+                {
+                  g_string_append_c (relative, '/');
+                  walk_directory (walk, relative);
+                }
+            }
+          else if (!g_hash_table_contains (walk->tracked, relative->str))
+            g_ptr_array_add (walk->files, g_strdup (relative->str));
+        }
+
+      g_string_truncate (relative, prefix_len);
+    }
+
+  if (list != NULL)
+    g_ptr_array_remove_index (walk->lists, walk->lists->len - 1);
+}
+
+/* End of saturn-git-index.c */
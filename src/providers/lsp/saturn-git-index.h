@@ -0,0 +1,40 @@
+/* saturn-git-index.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* Returns the paths, relative to `worktree`, that `git ls-files --cached
+   --others --exclude-standard` would print, without spawning git. If
+   `cache_dir` is non-NULL the tracked files are cached there for as long as
+   .git/index keeps the same mtime. Untracked files are always looked up
+   afresh. Fails with G_IO_ERROR_NOT_SUPPORTED for repositories the reader
+   can't handle, in which case callers should fall back to git itself */
+GPtrArray *
+saturn_git_list_files (const char *worktree,
+                       const char *cache_dir,
+                       GError    **error);
+
+G_END_DECLS
+
+/* End of saturn-git-index.h */
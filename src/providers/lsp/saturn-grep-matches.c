@@ -0,0 +1,296 @@
+/* saturn-grep-matches.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define G_LOG_DOMAIN "SATURN::GREP-MATCHES"
+
+#include <string.h>
+
+#include "saturn-grep-matches.h"
+#include "util.h"
+
+/* roughly a few screens worth */
+#define PREVIEW_PAGE_LINES 64
+
+static const char *highlight_colors[] = {
+  "#3584e4aa",
+  "#2190a4aa",
+  "#3a944aaa",
+  "#c88800aa",
+  "#ed5b00aa",
+  "#e62d42aa",
+  "#d56199aa",
+  "#9141acaa",
+  "#6f8396aa",
+};
+
+struct _SaturnGrepMatches
+{
+  GObject parent_instance;
+
+  char *path;
+
+  /* every matched line, each terminated by a single newline */
+  char  *text;
+  gsize  text_length;
+  guint  n_lines;
+  /* guint64 */
+  GArray *line_numbers;
+  /* SaturnGrepSubmatch, ordered by line */
+  GArray *submatches;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnGrepMatches, saturn_grep_matches, G_TYPE_OBJECT);
+
+SATURN_DEFINE_DATA (
+    preview,
+    Preview,
+    {
+      SaturnGrepMatches *matches;
+      GtkTextBuffer     *buffer;
+      /* how far into the matches the buffer has been filled */
+      guint next_line;
+      gsize next_offset;
+      guint next_submatch;
+    },
+    SATURN_RELEASE_DATA (matches, g_object_unref);
+    SATURN_RELEASE_DATA (buffer, g_object_unref));
+
+static GtkTextTagTable *
+get_tag_table (GtkTextTag ***tags_out);
+
+static void
+preview_fill (PreviewData *preview,
+              guint        n_lines);
+
+static void
+adjustment_changed (GtkAdjustment *adjustment,
+                    PreviewData   *preview);
+
+static void
+saturn_grep_matches_dispose (GObject *object)
+{
+  SaturnGrepMatches *self = SATURN_GREP_MATCHES (object);
+
+  g_clear_pointer (&self->path, g_free);
+  g_clear_pointer (&self->text, g_free);
+  g_clear_pointer (&self->line_numbers, g_array_unref);
+  g_clear_pointer (&self->submatches, g_array_unref);
+
+  G_OBJECT_CLASS (saturn_grep_matches_parent_class)->dispose (object);
+}
+
+static void
+saturn_grep_matches_class_init (SaturnGrepMatchesClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose = saturn_grep_matches_dispose;
+}
+
+static void
+saturn_grep_matches_init (SaturnGrepMatches *self)
+{
+}
+
+SaturnGrepMatches *
+saturn_grep_matches_new (SaturnGrepFile *file)
+{
+  SaturnGrepMatches *self = NULL;
+
+  g_return_val_if_fail (file != NULL, NULL);
+
+  self               = g_object_new (SATURN_TYPE_GREP_MATCHES, NULL);
+  self->path         = g_strdup (file->path);
+  self->text         = g_strndup (file->lines->str, file->lines->len);
+  self->text_length  = file->lines->len;
+  self->n_lines      = file->n_lines;
+  self->line_numbers = g_array_copy (file->line_numbers);
+  self->submatches   = g_array_copy (file->submatches);
+
+  return self;
+}
+
+const char *
+saturn_grep_matches_get_path (SaturnGrepMatches *self)
+{
+  g_return_val_if_fail (SATURN_IS_GREP_MATCHES (self), NULL);
+  return self->path;
+}
+
+guint
+saturn_grep_matches_get_n_lines (SaturnGrepMatches *self)
+{
+  g_return_val_if_fail (SATURN_IS_GREP_MATCHES (self), 0);
+  return self->n_lines;
+}
+
+GtkWidget *
+saturn_grep_matches_create_preview (SaturnGrepMatches *self)
+{
+  g_autoptr (PreviewData) preview = NULL;
+  GtkWidget     *view             = NULL;
+  GtkWidget     *window           = NULL;
+  GtkAdjustment *adjustment       = NULL;
+
+  g_return_val_if_fail (SATURN_IS_GREP_MATCHES (self), NULL);
+
+  /* every preview shares the same handful of highlight tags */
+  preview          = preview_data_new ();
+  preview->matches = g_object_ref (self);
+  preview->buffer  = gtk_text_buffer_new (get_tag_table (NULL));
+  preview_fill (preview, PREVIEW_PAGE_LINES);
+
+  view = gtk_text_view_new_with_buffer (preview->buffer);
+  gtk_text_view_set_editable (GTK_TEXT_VIEW (view), FALSE);
+  gtk_text_view_set_monospace (GTK_TEXT_VIEW (view), TRUE);
+  gtk_widget_add_css_class (view, "text-preview");
+
+  window = gtk_scrolled_window_new ();
+  gtk_scrolled_window_set_child (GTK_SCROLLED_WINDOW (window), view);
+
+  if (preview->next_line < self->n_lines)
+    {
+      adjustment = gtk_scrolled_window_get_vadjustment (GTK_SCROLLED_WINDOW (window));
+      g_signal_connect_data (
+          adjustment, "changed",
+          G_CALLBACK (adjustment_changed),
+          preview_data_ref (preview), (GClosureNotify) preview_data_unref,
+          G_CONNECT_DEFAULT);
+      g_signal_connect_data (
+          adjustment, "value-changed",
+          G_CALLBACK (adjustment_changed),
+          preview_data_ref (preview), (GClosureNotify) preview_data_unref,
+          G_CONNECT_DEFAULT);
+    }
+
+  return window;
+}
+
+static GtkTextTagTable *
+get_tag_table (GtkTextTag ***tags_out)
+{
+  static GtkTextTagTable *table                                 = NULL;
+  static GtkTextTag      *tags[G_N_ELEMENTS (highlight_colors)] = { 0 };
+
+  if (g_once_init_enter_pointer (&table))
+    {
+      GtkTextTagTable *new_table = NULL;
+
+      new_table = gtk_text_tag_table_new ();
+      for (guint i = 0; i < G_N_ELEMENTS (highlight_colors); i++)
+        {
+          GdkRGBA rgba = { 0 };
+
+          gdk_rgba_parse (&rgba, highlight_colors[i]);
+          tags[i] = gtk_text_tag_new (NULL);
+          g_object_set (tags[i], "background-rgba", &rgba, NULL);
+          gtk_text_tag_table_add (new_table, tags[i]);
+        }
+
+      g_once_init_leave_pointer (&table, new_table);
+    }
+
+  if (tags_out != NULL)
+    *tags_out = tags;
+  return table;
+}
+
+static void
+preview_fill (PreviewData *preview,
+              guint        n_lines)
+{
+  SaturnGrepMatches *self = preview->matches;
+  GtkTextTag       **tags = NULL;
+
+  get_tag_table (&tags);
+
+  for (guint i = 0; i < n_lines && preview->next_line < self->n_lines; i++)
+    {
+      const char *line          = self->text + preview->next_offset;
+      const char *newline       = NULL;
+      gsize       line_length   = 0;
+      char        number[32]    = { 0 };
+      int         number_length = 0;
+      GtkTextIter end           = { 0 };
+      int         line_offset   = 0;
+
+      newline     = memchr (line, '\n', self->text_length - preview->next_offset);
+      line_length = newline != NULL ? (gsize) (newline - line) : self->text_length - preview->next_offset;
+
+      number_length = g_snprintf (
+          number, sizeof (number), "%s%" G_GUINT64_FORMAT ": ",
+          preview->next_line > 0 ? "\n" : "",
+          g_array_index (self->line_numbers, guint64, preview->next_line));
+
+      gtk_text_buffer_get_end_iter (preview->buffer, &end);
+      gtk_text_buffer_insert (preview->buffer, &end, number, number_length);
+      /* char offsets rather than line indices, since the line itself may
+         contain characters the buffer breaks lines at */
+      line_offset = gtk_text_iter_get_offset (&end);
+      gtk_text_buffer_insert (preview->buffer, &end, line, line_length);
+
+      for (; preview->next_submatch < self->submatches->len; preview->next_submatch++)
+        {
+          SaturnGrepSubmatch *submatch = NULL;
+          GtkTextIter         start    = { 0 };
+          GtkTextIter         stop     = { 0 };
+
+          submatch = &g_array_index (self->submatches, SaturnGrepSubmatch, preview->next_submatch);
+          if (submatch->line != preview->next_line)
+            break;
+
+          gtk_text_buffer_get_iter_at_offset (
+              preview->buffer, &start,
+              line_offset + g_utf8_strlen (line, submatch->start));
+          gtk_text_buffer_get_iter_at_offset (
+              preview->buffer, &stop,
+              line_offset + g_utf8_strlen (line, submatch->end));
+          gtk_text_buffer_apply_tag (
+              preview->buffer,
+              tags[submatch->line % G_N_ELEMENTS (highlight_colors)],
+              &start, &stop);
+        }
+
+      preview->next_offset += line_length + 1;
+      preview->next_line++;
+    }
+}
+
+static void
+adjustment_changed (GtkAdjustment *adjustment,
+                    PreviewData   *preview)
+{
+  double value     = 0.0;
+  double page_size = 0.0;
+  double upper     = 0.0;
+
+  if (preview->next_line >= preview->matches->n_lines)
+    return;
+
+  value     = gtk_adjustment_get_value (adjustment);
+  page_size = gtk_adjustment_get_page_size (adjustment);
+  upper     = gtk_adjustment_get_upper (adjustment);
+
+  /* stay a page ahead of the viewport */
+  if (value + 2 * page_size >= upper)
+    preview_fill (preview, PREVIEW_PAGE_LINES);
+}
+
+/* End of saturn-grep-matches.c */
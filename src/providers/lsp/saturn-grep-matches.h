@@ -0,0 +1,51 @@
+/* saturn-grep-matches.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gtk/gtk.h>
+
+#include "saturn-grep.h"
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_GREP_MATCHES (saturn_grep_matches_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnGrepMatches, saturn_grep_matches, SATURN, GREP_MATCHES, GObject)
+
+/* Copies the match records out of `file`. Safe to call from any thread,
+   nothing gets laid out until a preview is requested */
+SaturnGrepMatches *
+saturn_grep_matches_new (SaturnGrepFile *file);
+
+const char *
+saturn_grep_matches_get_path (SaturnGrepMatches *self);
+
+guint
+saturn_grep_matches_get_n_lines (SaturnGrepMatches *self);
+
+/* Creates a scrollable view of the matched lines with every match
+   highlighted. Lines are only inserted into its buffer as they are about to
+   be scrolled into view. Main thread only */
+GtkWidget *
+saturn_grep_matches_create_preview (SaturnGrepMatches *self);
+
+G_END_DECLS
+
+/* End of saturn-grep-matches.h */
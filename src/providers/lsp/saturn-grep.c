@@ -0,0 +1,280 @@
+/* saturn-grep.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* ripgrep's --json output is one event per line: "begin" when it starts
+   reporting a file, "match" for every matching line and "end" once the
+   file is done. We only ever hold a single file's matches in memory. */
+
+#define G_LOG_DOMAIN "SATURN::GREP"
+
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <json-glib/json-glib.h>
+
+#include "saturn-grep.h"
+
+static void
+child_setup (gpointer user_data);
+
+static void
+kill_process_group (GCancellable *cancellable,
+                    GSubprocess  *subprocess);
+
+static char *
+dup_text_or_bytes (JsonObject *object,
+                   const char *member,
+                   gboolean   *was_valid);
+
+SaturnGrepFile *
+saturn_grep_file_new (const char *path)
+{
+  SaturnGrepFile *file = NULL;
+
+  file               = g_new0 (SaturnGrepFile, 1);
+  file->path         = g_strdup (path);
+  file->lines        = g_string_new (NULL);
+  file->line_numbers = g_array_new (FALSE, FALSE, sizeof (guint64));
+  file->submatches   = g_array_new (FALSE, FALSE, sizeof (SaturnGrepSubmatch));
+
+  return file;
+}
+
+void
+saturn_grep_file_free (SaturnGrepFile *file)
+{
+  g_free (file->path);
+  g_string_free (file->lines, TRUE);
+  g_array_unref (file->line_numbers);
+  g_array_unref (file->submatches);
+  g_free (file);
+}
+
+gboolean
+saturn_grep_run (const char    *pattern,
+                 const char    *directory,
+                 GCancellable  *cancellable,
+                 SaturnGrepFunc func,
+                 gpointer       user_data,
+                 GError       **error)
+{
+  g_autoptr (GError) local_error           = NULL;
+  g_autoptr (GSubprocessLauncher) launcher = NULL;
+  g_autoptr (GSubprocess) subprocess       = NULL;
+  g_autoptr (GDataInputStream) stream      = NULL;
+  g_autoptr (JsonParser) parser            = NULL;
+  g_autoptr (SaturnGrepFile) file          = NULL;
+  gulong   handler                         = 0;
+  gboolean stopped                         = FALSE;
+
+  g_return_val_if_fail (pattern != NULL, FALSE);
+  g_return_val_if_fail (directory != NULL, FALSE);
+  g_return_val_if_fail (func != NULL, FALSE);
+
+  launcher = g_subprocess_launcher_new (
+      G_SUBPROCESS_FLAGS_STDOUT_PIPE |
+      G_SUBPROCESS_FLAGS_STDERR_SILENCE);
+  g_subprocess_launcher_set_child_setup (launcher, child_setup, NULL, NULL);
+
+  subprocess = g_subprocess_launcher_spawn (
+      launcher, error,
+      "rg", "--json", "--", pattern, directory, NULL);
+  if (subprocess == NULL)
+    return FALSE;
+
+  if (cancellable != NULL)
+    /* runs right away if we were superseded before even starting */
+    handler = g_cancellable_connect (
+        cancellable,
+        G_CALLBACK (kill_process_group),
+        g_object_ref (subprocess),
+        g_object_unref);
+
+  stream = g_data_input_stream_new (g_subprocess_get_stdout_pipe (subprocess));
+  parser = json_parser_new_immutable ();
+
+  while (!stopped)
+    {
+      g_autofree char *line   = NULL;
+      gsize            length = 0;
+      JsonNode        *root   = NULL;
+      JsonObject      *event  = NULL;
+      JsonObject      *data   = NULL;
+      const char      *type   = NULL;
+
+      line = g_data_input_stream_read_line (stream, &length, cancellable, &local_error);
+      if (line == NULL)
+        break;
+
+      if (!json_parser_load_from_data (parser, line, length, NULL))
+        continue;
+      root = json_parser_get_root (parser);
+      if (root == NULL || !JSON_NODE_HOLDS_OBJECT (root))
+        continue;
+
+      event = json_node_get_object (root);
+      type  = json_object_get_string_member_with_default (event, "type", "");
+      if (!json_object_has_member (event, "data"))
+        continue;
+      data = json_object_get_object_member (event, "data");
+      if (data == NULL)
+        continue;
+
+      if (g_strcmp0 (type, "begin") == 0)
+        {
+          g_autofree char *path = NULL;
+
+          path = dup_text_or_bytes (data, "path", NULL);
+          g_clear_pointer (&file, saturn_grep_file_free);
+          file = saturn_grep_file_new (path);
+        }
+      else if (g_strcmp0 (type, "match") == 0 && file != NULL)
+        {
+          g_autofree char *text        = NULL;
+          gboolean         valid       = FALSE;
+          gsize            text_length = 0;
+          guint64          line_number = 0;
+          JsonArray       *submatches  = NULL;
+
+          text        = dup_text_or_bytes (data, "lines", &valid);
+          text_length = strlen (text);
+          if (text_length > 0 && text[text_length - 1] == '\n')
+            text[--text_length] = '\0';
+          if (text_length > 0 && text[text_length - 1] == '\r')
+            text[--text_length] = '\0';
+
+          line_number = json_object_get_int_member_with_default (data, "line_number", 0);
+          g_array_append_val (file->line_numbers, line_number);
+
+          if (valid && json_object_has_member (data, "submatches"))
+            submatches = json_object_get_array_member (data, "submatches");
+
+          /* offsets into lossily converted text would be meaningless */
+          for (guint i = 0; submatches != NULL && i < json_array_get_length (submatches); i++)
+            {
+              JsonObject        *submatch = NULL;
+              SaturnGrepSubmatch record   = { 0 };
+
+              submatch = json_array_get_object_element (submatches, i);
+              if (submatch == NULL)
+                continue;
+
+              record.line  = file->n_lines;
+              record.start = json_object_get_int_member_with_default (submatch, "start", 0);
+              record.end   = json_object_get_int_member_with_default (submatch, "end", 0);
+              record.end   = MIN (record.end, text_length);
+              if (record.start >= record.end)
+                continue;
+
+              g_array_append_val (file->submatches, record);
+            }
+
+          g_string_append_len (file->lines, text, text_length);
+          g_string_append_c (file->lines, '\n');
+          file->n_lines++;
+        }
+      else if (g_strcmp0 (type, "end") == 0 && file != NULL)
+        {
+          if (file->n_lines > 0 && !func (file, user_data))
+            stopped = TRUE;
+          g_clear_pointer (&file, saturn_grep_file_free);
+        }
+    }
+
+  if (handler != 0)
+    g_cancellable_disconnect (cancellable, handler);
+
+  if (stopped || local_error != NULL)
+    kill_process_group (NULL, subprocess);
+  /* reap the child */
+  g_subprocess_wait (subprocess, NULL, NULL);
+
+  if (local_error != NULL &&
+      !g_error_matches (local_error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+    {
+      g_propagate_error (error, g_steal_pointer (&local_error));
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+static void
+child_setup (gpointer user_data)
+{
+  /* rg may spawn preprocessors of its own, so we kill the whole group */
+  setpgid (0, 0);
+}
+
+static void
+kill_process_group (GCancellable *cancellable,
+                    GSubprocess  *subprocess)
+{
+  const char *identifier = NULL;
+
+  identifier = g_subprocess_get_identifier (subprocess);
+  if (identifier == NULL)
+    /* already exited */
+    return;
+
+  kill (-(pid_t) g_ascii_strtoll (identifier, NULL, 10), SIGKILL);
+}
+
+static char *
+dup_text_or_bytes (JsonObject *object,
+                   const char *member,
+                   gboolean   *was_valid)
+{
+  JsonObject *inner = NULL;
+  const char *text  = NULL;
+
+  if (was_valid != NULL)
+    *was_valid = FALSE;
+
+  if (!json_object_has_member (object, member))
+    return g_strdup ("");
+  inner = json_object_get_object_member (object, member);
+  if (inner == NULL)
+    return g_strdup ("");
+
+  text = json_object_get_string_member_with_default (inner, "text", NULL);
+  if (text != NULL)
+    {
+      if (was_valid != NULL)
+        *was_valid = TRUE;
+      return g_strdup (text);
+    }
+
+  /* anything that isn't valid UTF-8 comes base64 encoded */
+  text = json_object_get_string_member_with_default (inner, "bytes", NULL);
+  if (text != NULL)
+    {
+      g_autofree guchar *decoded = NULL;
+      gsize              length  = 0;
+
+      decoded = g_base64_decode (text, &length);
+      return g_utf8_make_valid ((const char *) decoded, length);
+    }
+
+  return g_strdup ("");
+}
+
+/* End of saturn-grep.c */
@@ -0,0 +1,74 @@
+/* saturn-grep.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef struct
+{
+  /* index into the file's matched lines */
+  guint line;
+  /* byte offsets within that line */
+  guint start;
+  guint end;
+} SaturnGrepSubmatch;
+
+typedef struct
+{
+  char *path;
+  /* every matched line, each terminated by a single newline */
+  GString *lines;
+  guint    n_lines;
+  /* guint64, the 1-based line number of each matched line */
+  GArray *line_numbers;
+  /* SaturnGrepSubmatch */
+  GArray *submatches;
+} SaturnGrepFile;
+
+SaturnGrepFile *
+saturn_grep_file_new (const char *path);
+
+void
+saturn_grep_file_free (SaturnGrepFile *file);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC (SaturnGrepFile, saturn_grep_file_free);
+
+/* Called once per file, as soon as ripgrep is done with it. Return FALSE
+   to stop the search */
+typedef gboolean (*SaturnGrepFunc) (SaturnGrepFile *file,
+                                    gpointer        user_data);
+
+/* Runs ripgrep over `directory` and blocks until it exits. The process is
+   started in its own process group, and the whole group is killed as soon
+   as `cancellable` is cancelled or `func` returns FALSE */
+gboolean
+saturn_grep_run (const char    *pattern,
+                 const char    *directory,
+                 GCancellable  *cancellable,
+                 SaturnGrepFunc func,
+                 gpointer       user_data,
+                 GError       **error);
+
+G_END_DECLS
+
+/* End of saturn-grep.h */
@@ -0,0 +1,361 @@
+/* saturn-history.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* The history is a small saturn-binary-file.h file laid out as
+
+     magic
+     guint32 n_entries, then each entry's guint32 count, gint64 last used
+     time in seconds and text string
+
+   Entries are unique and kept most recently used first, and only the
+   MAX_ENTRIES most recent survive, so the file never grows past a few
+   hundred kilobytes no matter how long saturn is used. It is rewritten whole
+   on every record, which happens at most once per run. */
+
+#define G_LOG_DOMAIN "SATURN::HISTORY"
+
+#include <glib/gstdio.h>
+#include <string.h>
+
+#include "saturn-binary-file.h"
+#include "saturn-history.h"
+
+#define HISTORY_MAGIC "SATHIST1"
+
+#define MAX_ENTRIES     500
+/* anything longer is hardly worth substituting back in */
+#define MAX_TEXT_LENGTH 4096
+
+typedef struct
+{
+  char   *text;
+  guint32 count;
+  gint64  last_used;
+} Entry;
+
+struct _SaturnHistory
+{
+  GObject parent_instance;
+
+  char *path;
+  char *legacy_path;
+
+  GMutex      mutex;
+  gboolean    loaded;
+  /* Entry, most recently used first */
+  GPtrArray  *entries;
+  /* text -> Entry */
+  GHashTable *lookup;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnHistory, saturn_history, G_TYPE_OBJECT);
+
+static void
+entry_free (Entry *entry);
+
+static void
+ensure_loaded (SaturnHistory *self);
+
+static void
+add_entry (SaturnHistory *self,
+           Entry         *entry);
+
+static gboolean
+read_history (SaturnHistory *self,
+              GError       **error);
+
+static gboolean
+import_legacy (SaturnHistory *self,
+               GError       **error);
+
+static gboolean
+write_history (SaturnHistory *self,
+               GError       **error);
+
+static void
+saturn_history_dispose (GObject *object)
+{
+  SaturnHistory *self = SATURN_HISTORY (object);
+
+  g_clear_pointer (&self->path, g_free);
+  g_clear_pointer (&self->legacy_path, g_free);
+  g_clear_pointer (&self->lookup, g_hash_table_unref);
+  g_clear_pointer (&self->entries, g_ptr_array_unref);
+
+  G_OBJECT_CLASS (saturn_history_parent_class)->dispose (object);
+}
+
+static void
+saturn_history_finalize (GObject *object)
+{
+  SaturnHistory *self = SATURN_HISTORY (object);
+
+  g_mutex_clear (&self->mutex);
+
+  G_OBJECT_CLASS (saturn_history_parent_class)->finalize (object);
+}
+
+static void
+saturn_history_class_init (SaturnHistoryClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_history_dispose;
+  object_class->finalize = saturn_history_finalize;
+}
+
+static void
+saturn_history_init (SaturnHistory *self)
+{
+  g_mutex_init (&self->mutex);
+  self->entries = g_ptr_array_new_with_free_func ((GDestroyNotify) entry_free);
+  self->lookup  = g_hash_table_new (g_str_hash, g_str_equal);
+}
+
+SaturnHistory *
+saturn_history_new (const char *path,
+                    const char *legacy_path)
+{
+  SaturnHistory *self = NULL;
+
+  g_return_val_if_fail (path != NULL, NULL);
+
+  self              = g_object_new (SATURN_TYPE_HISTORY, NULL);
+  self->path        = g_strdup (path);
+  self->legacy_path = g_strdup (legacy_path);
+
+  return self;
+}
+
+gboolean
+saturn_history_record (SaturnHistory *self,
+                       const char    *text,
+                       GError       **error)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+  Entry *entry                    = NULL;
+  guint  position                 = 0;
+
+  g_return_val_if_fail (SATURN_IS_HISTORY (self), FALSE);
+  g_return_val_if_fail (text != NULL, FALSE);
+
+  if (*text == '\0' || strlen (text) > MAX_TEXT_LENGTH)
+    return TRUE;
+
+  locker = g_mutex_locker_new (&self->mutex);
+  ensure_loaded (self);
+
+  entry = g_hash_table_lookup (self->lookup, text);
+  if (entry != NULL)
+    {
+      /* moved up front below, there are only ever a few hundred */
+      if (g_ptr_array_find (self->entries, entry, &position))
+        g_ptr_array_steal_index (self->entries, position);
+    }
+  else
+    {
+      entry       = g_new0 (Entry, 1);
+      entry->text = g_strdup (text);
+      g_hash_table_replace (self->lookup, entry->text, entry);
+    }
+  entry->count++;
+  entry->last_used = g_get_real_time () / G_USEC_PER_SEC;
+  g_ptr_array_insert (self->entries, 0, entry);
+
+  while (self->entries->len > MAX_ENTRIES)
+    {
+      Entry *oldest = g_ptr_array_index (self->entries, self->entries->len - 1);
+
+      g_hash_table_remove (self->lookup, oldest->text);
+      g_ptr_array_remove_index (self->entries, self->entries->len - 1);
+    }
+
+  return write_history (self, error);
+}
+
+void
+saturn_history_foreach (SaturnHistory    *self,
+                        SaturnHistoryFunc func,
+                        gpointer          user_data)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  g_return_if_fail (SATURN_IS_HISTORY (self));
+  g_return_if_fail (func != NULL);
+
+  locker = g_mutex_locker_new (&self->mutex);
+  ensure_loaded (self);
+
+  for (guint i = 0; i < self->entries->len; i++)
+    {
+      Entry *entry = g_ptr_array_index (self->entries, i);
+
+      if (!func (entry->text, entry->count, entry->last_used, user_data))
+        break;
+    }
+}
+
+static void
+entry_free (Entry *entry)
+{
+  g_free (entry->text);
+  g_free (entry);
+}
+
+static void
+ensure_loaded (SaturnHistory *self)
+{
+  g_autoptr (GError) local_error = NULL;
+
+  if (self->loaded)
+    return;
+  self->loaded = TRUE;
+
+  if (g_file_test (self->path, G_FILE_TEST_EXISTS))
+    {
+      if (!read_history (self, &local_error))
+        g_warning ("Unable to read history: %s", local_error->message);
+    }
+  else if (self->legacy_path != NULL &&
+           g_file_test (self->legacy_path, G_FILE_TEST_EXISTS))
+    {
+      if (!import_legacy (self, &local_error))
+        g_warning ("Unable to import history: %s", local_error->message);
+    }
+
+  if (local_error != NULL)
+    {
+      /* start over rather than keep half of it */
+      g_hash_table_remove_all (self->lookup);
+      g_ptr_array_set_size (self->entries, 0);
+    }
+}
+
+/* entries are added oldest last */
+static void
+add_entry (SaturnHistory *self,
+           Entry         *entry)
+{
+  g_hash_table_replace (self->lookup, entry->text, entry);
+  g_ptr_array_add (self->entries, entry);
+}
+
+static gboolean
+read_history (SaturnHistory *self,
+              GError       **error)
+{
+  g_auto (SaturnBinaryReader) reader = { 0 };
+  guint32 n_entries                  = 0;
+
+  if (!saturn_binary_reader_init (&reader, self->path, HISTORY_MAGIC, error) ||
+      !saturn_binary_reader_read_u32 (&reader, &n_entries, error))
+    return FALSE;
+
+  for (guint32 i = 0; i < n_entries && i < MAX_ENTRIES; i++)
+    {
+      guint32 count     = 0;
+      gint64  last_used = 0;
+      char   *text      = NULL;
+      Entry  *entry     = NULL;
+
+      if (!saturn_binary_reader_read_u32 (&reader, &count, error) ||
+          !saturn_binary_reader_read_i64 (&reader, &last_used, error) ||
+          !saturn_binary_reader_read_string (&reader, &text, error))
+        return FALSE;
+
+      entry            = g_new0 (Entry, 1);
+      entry->text      = text;
+      entry->count     = count;
+      entry->last_used = last_used;
+
+      if (g_hash_table_contains (self->lookup, entry->text))
+        entry_free (entry);
+      else
+        add_entry (self, entry);
+    }
+
+  return TRUE;
+}
+
+static gboolean
+import_legacy (SaturnHistory *self,
+               GError       **error)
+{
+  g_autofree char *contents = NULL;
+  g_auto (GStrv) lines      = NULL;
+  GStatBuf         st       = { 0 };
+  gint64           mtime    = 0;
+  guint            n_lines  = 0;
+
+  if (!g_file_get_contents (self->legacy_path, &contents, NULL, error))
+    return FALSE;
+
+  if (g_stat (self->legacy_path, &st) == 0)
+    mtime = st.st_mtime;
+
+  /* the old log had one line per selection, oldest first */
+  lines   = g_strsplit (contents, "\n", -1);
+  n_lines = g_strv_length (lines);
+  for (guint i = n_lines; i > 0; i--)
+    {
+      const char *line  = lines[i - 1];
+      Entry      *entry = NULL;
+
+      if (*line == '\0' || strlen (line) > MAX_TEXT_LENGTH)
+        continue;
+
+      entry = g_hash_table_lookup (self->lookup, line);
+      if (entry == NULL)
+        {
+          if (self->entries->len >= MAX_ENTRIES)
+            continue;
+
+          entry            = g_new0 (Entry, 1);
+          entry->text      = g_strdup (line);
+          entry->last_used = mtime;
+          add_entry (self, entry);
+        }
+      entry->count++;
+    }
+
+  return TRUE;
+}
+
+static gboolean
+write_history (SaturnHistory *self,
+               GError       **error)
+{
+  g_autoptr (GByteArray) out = NULL;
+
+  out = saturn_binary_writer_new (HISTORY_MAGIC);
+  saturn_binary_writer_add_u32 (out, self->entries->len);
+  for (guint i = 0; i < self->entries->len; i++)
+    {
+      Entry *entry = g_ptr_array_index (self->entries, i);
+
+      saturn_binary_writer_add_u32 (out, entry->count);
+      saturn_binary_writer_add_i64 (out, entry->last_used);
+      saturn_binary_writer_add_string (out, entry->text);
+    }
+
+  return saturn_binary_writer_save (out, self->path, error);
+}
+
+/* End of saturn-history.c */
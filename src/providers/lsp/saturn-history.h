@@ -0,0 +1,59 @@
+/* saturn-history.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_HISTORY (saturn_history_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnHistory, saturn_history, SATURN, HISTORY, GObject)
+
+/* Return FALSE to stop */
+typedef gboolean (*SaturnHistoryFunc) (const char *text,
+                                       guint       count,
+                                       gint64      last_used,
+                                       gpointer    user_data);
+
+/* `path` is where the history is persisted. If nothing is there yet, the
+   plain text log at `legacy_path`, if any, is imported instead. Nothing is
+   read until the history is first used */
+SaturnHistory *
+saturn_history_new (const char *path,
+                    const char *legacy_path);
+
+/* Bumps the use count and timestamp of `text`, adding it if it's new and
+   dropping the least recently used entry if that makes for too many, then
+   writes the history out */
+gboolean
+saturn_history_record (SaturnHistory *self,
+                       const char    *text,
+                       GError       **error);
+
+/* Visits every entry, most recently used first */
+void
+saturn_history_foreach (SaturnHistory    *self,
+                        SaturnHistoryFunc func,
+                        gpointer          user_data);
+
+G_END_DECLS
+
+/* End of saturn-history.h */
@@ -0,0 +1,226 @@
+/* saturn-icon-cache.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* Resolving an icon name walks the theme's directories, which includes the
+   flatpak export paths appinfo.lsp adds, and may well hit the disk. The
+   resulting paintables are kept here, keyed by name and size, and the
+   appinfo provider prefetches every application icon from a worker thread
+   right after loading its catalogue. GtkIconTheme does its own locking, and
+   GTK_ICON_LOOKUP_PRELOAD has the texture loaded in the background too. */
+
+#define G_LOG_DOMAIN "SATURN::ICON-CACHE"
+
+#include "saturn-icon-cache.h"
+#include "util.h"
+
+struct _SaturnIconCache
+{
+  GObject parent_instance;
+
+  GtkIconTheme *theme;
+  int           scale;
+
+  GMutex      mutex;
+  GHashTable *icons;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnIconCache, saturn_icon_cache, G_TYPE_OBJECT);
+
+SATURN_DEFINE_DATA (
+    prefetch,
+    Prefetch,
+    {
+      GStrv icon_names;
+      int   size;
+    },
+    SATURN_RELEASE_DATA (icon_names, g_strfreev));
+
+static void
+theme_changed (SaturnIconCache *self,
+               GtkIconTheme    *theme);
+
+static void
+prefetch_thread (GTask           *task,
+                 SaturnIconCache *self,
+                 PrefetchData    *data,
+                 GCancellable    *cancellable);
+
+static void
+saturn_icon_cache_dispose (GObject *object)
+{
+  SaturnIconCache *self = SATURN_ICON_CACHE (object);
+
+  g_clear_object (&self->theme);
+  g_clear_pointer (&self->icons, g_hash_table_unref);
+
+  G_OBJECT_CLASS (saturn_icon_cache_parent_class)->dispose (object);
+}
+
+static void
+saturn_icon_cache_finalize (GObject *object)
+{
+  SaturnIconCache *self = SATURN_ICON_CACHE (object);
+
+  g_mutex_clear (&self->mutex);
+
+  G_OBJECT_CLASS (saturn_icon_cache_parent_class)->finalize (object);
+}
+
+static void
+saturn_icon_cache_class_init (SaturnIconCacheClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose  = saturn_icon_cache_dispose;
+  object_class->finalize = saturn_icon_cache_finalize;
+}
+
+static void
+saturn_icon_cache_init (SaturnIconCache *self)
+{
+  GdkDisplay *display  = NULL;
+  GListModel *monitors = NULL;
+
+  g_mutex_init (&self->mutex);
+  self->icons = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_object_unref);
+
+  display     = gdk_display_get_default ();
+  self->theme = g_object_ref (gtk_icon_theme_get_for_display (display));
+  g_signal_connect_object (
+      self->theme, "changed",
+      G_CALLBACK (theme_changed),
+      self, G_CONNECT_SWAPPED);
+
+  /* good enough for the largest monitor, GTK scales down just fine */
+  self->scale = 1;
+  monitors    = gdk_display_get_monitors (display);
+  for (guint i = 0; i < g_list_model_get_n_items (monitors); i++)
+    {
+      g_autoptr (GdkMonitor) monitor = NULL;
+
+      monitor     = g_list_model_get_item (monitors, i);
+      self->scale = MAX (self->scale, gdk_monitor_get_scale_factor (monitor));
+    }
+}
+
+SaturnIconCache *
+saturn_icon_cache_get_default (void)
+{
+  static SaturnIconCache *cache = NULL;
+
+  if (g_once_init_enter_pointer (&cache))
+    g_once_init_leave_pointer (&cache, g_object_new (SATURN_TYPE_ICON_CACHE, NULL));
+
+  return cache;
+}
+
+GdkPaintable *
+saturn_icon_cache_lookup (SaturnIconCache *self,
+                          const char      *icon_name,
+                          int              size)
+{
+  g_autofree char *key         = NULL;
+  GdkPaintable    *paintable   = NULL;
+  g_autoptr (GdkPaintable) new = NULL;
+
+  g_return_val_if_fail (SATURN_IS_ICON_CACHE (self), NULL);
+  g_return_val_if_fail (icon_name != NULL, NULL);
+
+  key = g_strdup_printf ("%d:%s", size, icon_name);
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker    = g_mutex_locker_new (&self->mutex);
+    paintable = g_hash_table_lookup (self->icons, key);
+    if (paintable != NULL)
+      return g_object_ref (paintable);
+  }
+
+  /* looked up without holding our lock, the theme has its own */
+  if (g_path_is_absolute (icon_name))
+    {
+      g_autoptr (GFile) file = NULL;
+
+      file = g_file_new_for_path (icon_name);
+      new  = GDK_PAINTABLE (gtk_icon_paintable_new_for_file (file, size, self->scale));
+    }
+  else
+    new = GDK_PAINTABLE (gtk_icon_theme_lookup_icon (
+        self->theme, icon_name, NULL,
+        size, self->scale,
+        GTK_TEXT_DIR_NONE,
+        GTK_ICON_LOOKUP_PRELOAD));
+
+  {
+    g_autoptr (GMutexLocker) locker = NULL;
+
+    locker = g_mutex_locker_new (&self->mutex);
+    /* someone else may have raced us here, either result is fine */
+    g_hash_table_replace (self->icons, g_steal_pointer (&key), g_object_ref (new));
+  }
+
+  return g_steal_pointer (&new);
+}
+
+void
+saturn_icon_cache_prefetch (SaturnIconCache   *self,
+                            const char *const *icon_names,
+                            int                size)
+{
+  g_autoptr (GTask) task        = NULL;
+  g_autoptr (PrefetchData) data = NULL;
+
+  g_return_if_fail (SATURN_IS_ICON_CACHE (self));
+  g_return_if_fail (icon_names != NULL);
+
+  data             = prefetch_data_new ();
+  data->icon_names = g_strdupv ((GStrv) icon_names);
+  data->size       = size;
+
+  task = g_task_new (self, NULL, NULL, NULL);
+  g_task_set_source_tag (task, saturn_icon_cache_prefetch);
+  g_task_set_task_data (task, prefetch_data_ref (data), prefetch_data_unref);
+  g_task_run_in_thread (task, (GTaskThreadFunc) prefetch_thread);
+}
+
+static void
+theme_changed (SaturnIconCache *self,
+               GtkIconTheme    *theme)
+{
+  g_autoptr (GMutexLocker) locker = NULL;
+
+  locker = g_mutex_locker_new (&self->mutex);
+  g_hash_table_remove_all (self->icons);
+}
+
+static void
+prefetch_thread (GTask           *task,
+                 SaturnIconCache *self,
+                 PrefetchData    *data,
+                 GCancellable    *cancellable)
+{
+  for (char **icon_name = data->icon_names; *icon_name != NULL; icon_name++)
+    g_object_unref (saturn_icon_cache_lookup (self, *icon_name, data->size));
+
+  g_task_return_boolean (task, TRUE);
+}
+
+/* End of saturn-icon-cache.c */
@@ -0,0 +1,52 @@
+/* saturn-icon-cache.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_ICON_CACHE (saturn_icon_cache_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnIconCache, saturn_icon_cache, SATURN, ICON_CACHE, GObject)
+
+/* Caches icons of the default display's icon theme. Must be created on
+   the main thread */
+SaturnIconCache *
+saturn_icon_cache_get_default (void);
+
+/* Returns the icon for `icon_name`, which may also be an absolute path,
+   at `size` pixels. Misses are looked up on the spot. Safe to call from
+   any thread */
+GdkPaintable *
+saturn_icon_cache_lookup (SaturnIconCache *self,
+                          const char      *icon_name,
+                          int              size);
+
+/* Looks up and starts loading every icon in `icon_names` at `size` from a
+   worker thread, so that later lookups are hits */
+void
+saturn_icon_cache_prefetch (SaturnIconCache   *self,
+                            const char *const *icon_names,
+                            int                size);
+
+G_END_DECLS
+
+/* End of saturn-icon-cache.h */
@@ -0,0 +1,118 @@
+/* saturn-launch.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define G_LOG_DOMAIN "SATURN::LAUNCH"
+
+#include "config.h"
+#include <glib/gi18n.h>
+
+#include "saturn-launch.h"
+
+static gboolean
+launch (GStrv argv);
+
+static void
+wait_check_cb (GSubprocess  *subprocess,
+               GAsyncResult *result,
+               char         *command);
+
+static void
+report_failure (const char *command,
+                GError     *error);
+
+void
+saturn_launch_async (const char *const *argv)
+{
+  g_return_if_fail (argv != NULL && argv[0] != NULL);
+
+  /* the wait is dispatched to the context the subprocess was spawned
+     from, which has to be one somebody actually iterates */
+  g_main_context_invoke_full (
+      NULL, G_PRIORITY_DEFAULT,
+      (GSourceFunc) launch,
+      g_strdupv ((GStrv) argv),
+      (GDestroyNotify) g_strfreev);
+}
+
+static gboolean
+launch (GStrv argv)
+{
+  g_autoptr (GError) local_error     = NULL;
+  g_autofree char *command           = NULL;
+  g_autoptr (GSubprocess) subprocess = NULL;
+
+  command    = g_strjoinv (" ", argv);
+  subprocess = g_subprocess_newv (
+      (const char *const *) argv,
+      G_SUBPROCESS_FLAGS_NONE,
+      &local_error);
+  if (subprocess == NULL)
+    {
+      report_failure (command, local_error);
+      return G_SOURCE_REMOVE;
+    }
+
+  /* selecting usually closes the window right after this, which would end
+     the application before the outcome could be reported */
+  if (g_application_get_default () != NULL)
+    g_application_hold (g_application_get_default ());
+
+  g_subprocess_wait_check_async (
+      subprocess, NULL,
+      (GAsyncReadyCallback) wait_check_cb,
+      g_steal_pointer (&command));
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+wait_check_cb (GSubprocess  *subprocess,
+               GAsyncResult *result,
+               char         *command)
+{
+  g_autoptr (GError) local_error = NULL;
+
+  if (!g_subprocess_wait_check_finish (subprocess, result, &local_error))
+    report_failure (command, local_error);
+
+  g_free (command);
+  if (g_application_get_default () != NULL)
+    g_application_release (g_application_get_default ());
+}
+
+static void
+report_failure (const char *command,
+                GError     *error)
+{
+  GApplication *application              = NULL;
+  g_autoptr (GNotification) notification = NULL;
+
+  g_warning ("Unable to launch %s: %s", command, error->message);
+
+  application = g_application_get_default ();
+  if (application == NULL)
+    return;
+
+  notification = g_notification_new (_ ("Launch Failed"));
+  g_notification_set_body (notification, error->message);
+  g_application_send_notification (application, NULL, notification);
+}
+
+/* End of saturn-launch.c */
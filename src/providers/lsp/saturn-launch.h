@@ -0,0 +1,36 @@
+/* saturn-launch.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* Spawns `argv` and returns right away. The process is reaped from the
+   default main context, and a failure to start it or a non-zero exit is
+   logged and reported with a desktop notification rather than to the
+   caller. Safe to call from any thread */
+void
+saturn_launch_async (const char *const *argv);
+
+G_END_DECLS
+
+/* End of saturn-launch.h */
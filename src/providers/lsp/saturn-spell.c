@@ -0,0 +1,329 @@
+/* saturn-spell.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+/* `enchant-2 -a` speaks the ispell pipe protocol. It prints a banner once,
+   then answers every line written to it with a line per word followed by
+   an empty line. Misspelled words come back as
+
+     & word count offset: suggestion, suggestion, ...
+
+   or as "# word offset" when there is nothing to suggest. Starting it means
+   loading dictionaries, so a single session is kept around for as long as
+   saturn runs. It is driven by a thread of its own, which only ever picks
+   up the most recent request. */
+
+#define G_LOG_DOMAIN "SATURN::SPELL"
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+
+#include "saturn-spell.h"
+
+typedef struct
+{
+  const char *text;
+
+  /* filled in by the session thread */
+  gboolean   done;
+  GPtrArray *suggestions;
+  GError    *error;
+} Request;
+
+typedef struct
+{
+  GMutex   mutex;
+  GCond    cond;
+  /* the newest request the session thread hasn't picked up yet */
+  Request *pending;
+
+  /* only ever touched by the session thread */
+  GSubprocess      *subprocess;
+  GDataInputStream *output;
+} Session;
+
+static Session *
+get_session (void);
+
+static gpointer
+session_thread (Session *session);
+
+static gboolean
+session_ensure_running (Session *session,
+                        GError **error);
+
+static void
+session_stop (Session *session);
+
+static GPtrArray *
+session_check (Session    *session,
+               const char *text,
+               GError    **error);
+
+static GPtrArray *
+parse_suggestions (const char *line);
+
+gboolean
+saturn_spell_suggest (const char     *text,
+                      SaturnSpellFunc func,
+                      gpointer        user_data,
+                      GError        **error)
+{
+  Session *session = NULL;
+  Request  request = { 0 };
+
+  g_return_val_if_fail (text != NULL, FALSE);
+  g_return_val_if_fail (func != NULL, FALSE);
+
+  session      = get_session ();
+  request.text = text;
+
+  g_mutex_lock (&session->mutex);
+  /* whoever is still waiting for their turn has been typed over */
+  if (session->pending != NULL)
+    session->pending->done = TRUE;
+  session->pending = &request;
+  g_cond_broadcast (&session->cond);
+  while (!request.done)
+    g_cond_wait (&session->cond, &session->mutex);
+  g_mutex_unlock (&session->mutex);
+
+  if (request.error != NULL)
+    {
+      g_propagate_error (error, request.error);
+      return FALSE;
+    }
+
+  if (request.suggestions != NULL)
+    {
+      for (guint i = 0; i < request.suggestions->len; i++)
+        {
+          if (!func (g_ptr_array_index (request.suggestions, i), user_data))
+            break;
+        }
+      g_ptr_array_unref (request.suggestions);
+    }
+
+  return TRUE;
+}
+
+static Session *
+get_session (void)
+{
+  static Session *session = NULL;
+
+  if (g_once_init_enter_pointer (&session))
+    {
+      Session *new_session = NULL;
+
+      new_session = g_new0 (Session, 1);
+      g_mutex_init (&new_session->mutex);
+      g_cond_init (&new_session->cond);
+      g_thread_unref (g_thread_new (
+          "Spell Session",
+          (GThreadFunc) session_thread,
+          new_session));
+
+      g_once_init_leave_pointer (&session, new_session);
+    }
+
+  return session;
+}
+
+static gpointer
+session_thread (Session *session)
+{
+  sigset_t pipe_set = { 0 };
+
+  /* writing to a session that died should fail with EPIPE rather than
+     take saturn down with it */
+  sigemptyset (&pipe_set);
+  sigaddset (&pipe_set, SIGPIPE);
+  pthread_sigmask (SIG_BLOCK, &pipe_set, NULL);
+
+  for (;;)
+    {
+      Request   *request     = NULL;
+      GPtrArray *suggestions = NULL;
+      GError    *local_error = NULL;
+
+      g_mutex_lock (&session->mutex);
+      while (session->pending == NULL)
+        g_cond_wait (&session->cond, &session->mutex);
+      /* the caller blocks until we are done, so its text stays valid */
+      request = g_steal_pointer (&session->pending);
+      g_mutex_unlock (&session->mutex);
+
+      suggestions = session_check (session, request->text, &local_error);
+
+      g_mutex_lock (&session->mutex);
+      request->suggestions = suggestions;
+      request->error       = local_error;
+      request->done        = TRUE;
+      g_cond_broadcast (&session->cond);
+      g_mutex_unlock (&session->mutex);
+    }
+
+  return NULL;
+}
+
+static gboolean
+session_ensure_running (Session *session,
+                        GError **error)
+{
+  g_autoptr (GError) local_error      = NULL;
+  g_autoptr (GSubprocess) subprocess  = NULL;
+  g_autoptr (GDataInputStream) output = NULL;
+  g_autofree char *banner             = NULL;
+
+  if (session->subprocess != NULL)
+    return TRUE;
+
+  subprocess = g_subprocess_new (
+      G_SUBPROCESS_FLAGS_STDIN_PIPE |
+          G_SUBPROCESS_FLAGS_STDOUT_PIPE |
+          G_SUBPROCESS_FLAGS_STDERR_SILENCE,
+      error,
+      "enchant-2", "-a", NULL);
+  if (subprocess == NULL)
+    return FALSE;
+
+  output = g_data_input_stream_new (g_subprocess_get_stdout_pipe (subprocess));
+
+  /* the banner, which looks like
+     "@(#) International Ispell Version 3.1.20 (but really Enchant 2.8.15)" */
+  banner = g_data_input_stream_read_line_utf8 (output, NULL, NULL, &local_error);
+  if (banner == NULL)
+    {
+      g_subprocess_force_exit (subprocess);
+      g_subprocess_wait (subprocess, NULL, NULL);
+
+      if (local_error != NULL)
+        g_propagate_error (error, g_steal_pointer (&local_error));
+      else
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                     "enchant-2 exited without starting a session");
+      return FALSE;
+    }
+
+  session->subprocess = g_steal_pointer (&subprocess);
+  session->output     = g_steal_pointer (&output);
+
+  return TRUE;
+}
+
+static void
+session_stop (Session *session)
+{
+  if (session->subprocess == NULL)
+    return;
+
+  g_subprocess_force_exit (session->subprocess);
+  /* reap the child */
+  g_subprocess_wait (session->subprocess, NULL, NULL);
+
+  g_clear_object (&session->output);
+  g_clear_object (&session->subprocess);
+}
+
+static GPtrArray *
+session_check (Session    *session,
+               const char *text,
+               GError    **error)
+{
+  g_autoptr (GError) local_error    = NULL;
+  g_autofree char *line             = NULL;
+  g_autofree char *command          = NULL;
+  GOutputStream *input              = NULL;
+  g_autoptr (GPtrArray) suggestions = NULL;
+
+  if (!session_ensure_running (session, error))
+    return NULL;
+
+  /* a leading '^' keeps the line from being read as a command, and
+     anything after a newline would be a line of its own */
+  line    = g_strdelimit (g_strdup (text), "\r\n", ' ');
+  command = g_strconcat ("^", line, "\n", NULL);
+
+  input = g_subprocess_get_stdin_pipe (session->subprocess);
+  if (!g_output_stream_write_all (input, command, strlen (command), NULL, NULL, error))
+    {
+      session_stop (session);
+      return NULL;
+    }
+
+  for (;;)
+    {
+      g_autofree char *reply = NULL;
+
+      reply = g_data_input_stream_read_line_utf8 (session->output, NULL, NULL, &local_error);
+      if (reply == NULL)
+        {
+          session_stop (session);
+
+          if (local_error != NULL)
+            g_propagate_error (error, g_steal_pointer (&local_error));
+          else
+            g_set_error (error, G_IO_ERROR, G_IO_ERROR_BROKEN_PIPE,
+                         "enchant-2 exited unexpectedly");
+          return NULL;
+        }
+
+      /* the reply is over */
+      if (*reply == '\0')
+        break;
+
+      /* '?' is a guess, which carries suggestions just the same */
+      if (suggestions == NULL && (*reply == '&' || *reply == '?'))
+        suggestions = parse_suggestions (reply);
+    }
+
+  if (suggestions == NULL)
+    suggestions = g_ptr_array_new_with_free_func (g_free);
+
+  return g_steal_pointer (&suggestions);
+}
+
+static GPtrArray *
+parse_suggestions (const char *line)
+{
+  GPtrArray  *suggestions = NULL;
+  const char *colon       = NULL;
+  g_auto (GStrv) parts    = NULL;
+
+  suggestions = g_ptr_array_new_with_free_func (g_free);
+
+  colon = strchr (line, ':');
+  if (colon == NULL)
+    return suggestions;
+
+  parts = g_strsplit (colon + 1, ",", -1);
+  for (guint i = 0; parts[i] != NULL; i++)
+    {
+      const char *suggestion = NULL;
+
+      suggestion = g_strstrip (parts[i]);
+      if (*suggestion != '\0')
+        g_ptr_array_add (suggestions, g_strdup (suggestion));
+    }
+
+  return suggestions;
+}
+
+/* End of saturn-spell.c */
@@ -0,0 +1,43 @@
+/* saturn-spell.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* Return FALSE to stop */
+typedef gboolean (*SaturnSpellFunc) (const char *suggestion,
+                                     gpointer    user_data);
+
+/* Spell checks `text` with the shared enchant-2 session, starting it first
+   if it isn't running, and visits the suggestions for its first misspelled
+   word. Blocks until the session has answered. A call still waiting for its
+   turn when another one comes in is superseded and returns TRUE without
+   visiting anything. Safe to call from any thread */
+gboolean
+saturn_spell_suggest (const char     *text,
+                      SaturnSpellFunc func,
+                      gpointer        user_data,
+                      GError        **error);
+
+G_END_DECLS
+
+/* End of saturn-spell.h */
@@ -18,10 +18,15 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <string.h>
+
 #include "saturn-cl-completion-provider.h"
 #include "saturn-cl-completion-proposal.h"
 #include "util.h"
 
+/* only this many of the best matches are ever sorted and shown */
+#define MAX_PROPOSALS 256
+
 struct _SaturnClCompletionProvider
 {
   GObject parent_instance;
@@ -30,9 +35,28 @@ struct _SaturnClCompletionProvider
   int         priority;
   char       *title;
 
-  GPtrArray *latest_snapshot;
+  /* taken lazily and dropped whenever the model changes */
+  GPtrArray  *latest_snapshot;
+  /* the first character of every proposal in the snapshot, ASCII as bits
+     and anything else as keys */
+  guint64     leading_ascii[2];
+  GHashTable *leading_other;
+
+  /* every proposal the last query matched, in snapshot order. Since a
+     longer query can only match a subset of those, refiltering for a
+     grown word only has to look at these */
+  char      *narrow_query;
+  GPtrArray *narrow_matches;
 };
 
+typedef struct
+{
+  SaturnClCompletionProposal *proposal;
+  guint                       score;
+  /* position among the candidates, so that ties keep their order */
+  guint                       position;
+} Match;
+
 static void
 completion_provider_iface_init (GtkSourceCompletionProviderInterface *iface);
 
@@ -58,25 +82,49 @@ static GParamSpec *props[LAST_PROP] = { 0 };
 static GPtrArray *
 make_model_snapshot (GListModel *model);
 
+static void
+ensure_snapshot (SaturnClCompletionProvider *self);
+
+static void
+invalidate_snapshot (SaturnClCompletionProvider *self);
+
+static void
+model_changed (SaturnClCompletionProvider *self,
+               guint                       position,
+               guint                       removed,
+               guint                       added,
+               GListModel                 *model);
+
+static void
+remember_matches (SaturnClCompletionProvider *self,
+                  const char                 *folded,
+                  GPtrArray                  *matches);
+
+static void
+forget_matches (SaturnClCompletionProvider *self);
+
 static GListModel *
-filter (const char *query,
-        GPtrArray  *proposals,
-        GListStore *edit);
+filter (const char *folded,
+        GPtrArray  *candidates,
+        GPtrArray **matches_out);
 
 static gint
-cmp_proposal (SaturnClCompletionProposal *proposal_a,
-              SaturnClCompletionProposal *proposal_b,
-              GHashTable                 *scores);
+cmp_match (const Match *a,
+           const Match *b);
 
 SATURN_DEFINE_DATA (
     populate_async,
     PopulateAsync,
     {
+      /* casefolded */
       char      *query;
       GPtrArray *snapshot;
+      /* filled in by the thread */
+      GPtrArray *matches;
     },
     SATURN_RELEASE_DATA (query, g_free);
-    SATURN_RELEASE_DATA (snapshot, g_ptr_array_unref));
+    SATURN_RELEASE_DATA (snapshot, g_ptr_array_unref);
+    SATURN_RELEASE_DATA (matches, g_ptr_array_unref));
 
 static void
 populate_async_thread (GTask                      *task,
@@ -89,8 +137,11 @@ saturn_cl_completion_provider_dispose (GObject *object)
 {
   SaturnClCompletionProvider *self = SATURN_CL_COMPLETION_PROVIDER (object);
 
+  if (self->model != NULL)
+    g_signal_handlers_disconnect_by_func (self->model, model_changed, self);
   g_clear_pointer (&self->model, g_object_unref);
   g_clear_pointer (&self->title, g_free);
+  invalidate_snapshot (self);
 
   G_OBJECT_CLASS (saturn_cl_completion_provider_parent_class)->dispose (object);
 }
@@ -206,25 +257,13 @@ completion_provider_is_trigger (GtkSourceCompletionProvider *provider,
   if (g_unichar_isspace (ch))
     return FALSE;
 
-  if (self->latest_snapshot == NULL)
-    self->latest_snapshot = make_model_snapshot (self->model);
+  ensure_snapshot (self);
 
   /* check if there is at least one leading char */
-  for (guint i = 0; i < self->latest_snapshot->len; i++)
-    {
-      SaturnClCompletionProposal *proposal   = NULL;
-      const char                 *string     = NULL;
-      gunichar                    leading_ch = 0;
-
-      proposal   = g_ptr_array_index (self->latest_snapshot, i);
-      string     = saturn_cl_completion_proposal_get_string (proposal);
-      leading_ch = g_utf8_get_char (string);
-
-      if (ch == leading_ch)
-        return TRUE;
-    }
-
-  return FALSE;
+  if (ch < 128)
+    return (self->leading_ascii[ch / 64] & (G_GUINT64_CONSTANT (1) << (ch % 64))) != 0;
+  else
+    return g_hash_table_contains (self->leading_other, GUINT_TO_POINTER (ch));
 }
 
 static gboolean
@@ -247,16 +286,22 @@ completion_provider_populate (GtkSourceCompletionProvider *provider,
                               GtkSourceCompletionContext  *context,
                               GError                     **error)
 {
-  SaturnClCompletionProvider *self  = SATURN_CL_COMPLETION_PROVIDER (provider);
-  const char                 *query = NULL;
+  SaturnClCompletionProvider *self = SATURN_CL_COMPLETION_PROVIDER (provider);
+  g_autofree char *word            = NULL;
+  g_autofree char *folded          = NULL;
+  GListModel      *res_model       = NULL;
+  GPtrArray       *matches         = NULL;
 
   if (self->model == NULL)
     return NULL;
-  query = gtk_source_completion_context_get_word (context);
+  word   = gtk_source_completion_context_get_word (context);
+  folded = g_utf8_casefold (word, -1);
+
+  ensure_snapshot (self);
+  res_model = filter (folded, self->latest_snapshot, &matches);
+  remember_matches (self, folded, matches);
 
-  if (self->latest_snapshot == NULL)
-    self->latest_snapshot = make_model_snapshot (self->model);
-  return filter (query, self->latest_snapshot, NULL);
+  return res_model;
 }
 
 static void
@@ -267,7 +312,7 @@ completion_provider_populate_async (GtkSourceCompletionProvider *provider,
                                     gpointer                     user_data)
 {
   SaturnClCompletionProvider *self   = SATURN_CL_COMPLETION_PROVIDER (provider);
-  const char                 *query  = NULL;
+  g_autofree char *word              = NULL;
   g_autoptr (PopulateAsyncData) data = NULL;
   g_autoptr (GTask) task             = NULL;
 
@@ -279,12 +324,11 @@ completion_provider_populate_async (GtkSourceCompletionProvider *provider,
       return;
     }
 
-  query = gtk_source_completion_context_get_word (context);
-  if (self->latest_snapshot == NULL)
-    self->latest_snapshot = make_model_snapshot (self->model);
+  word = gtk_source_completion_context_get_word (context);
+  ensure_snapshot (self);
 
   data           = populate_async_data_new ();
-  data->query    = g_strdup (query);
+  data->query    = g_utf8_casefold (word, -1);
   data->snapshot = g_ptr_array_ref (self->latest_snapshot);
 
   task = g_task_new (self, cancellable, callback, user_data);
@@ -301,10 +345,19 @@ completion_provider_populate_finish (GtkSourceCompletionProvider *provider,
                                      GError                     **error)
 {
   SaturnClCompletionProvider *self = SATURN_CL_COMPLETION_PROVIDER (provider);
+  PopulateAsyncData          *data = NULL;
+  GListModel                 *res  = NULL;
 
-  (void) self;
+  res = g_task_propagate_pointer (G_TASK (result), error);
+  if (res == NULL)
+    return NULL;
 
-  return g_task_propagate_pointer (G_TASK (result), error);
+  /* the thread is done with the task data by now */
+  data = g_task_get_task_data (G_TASK (result));
+  if (data->snapshot == self->latest_snapshot)
+    remember_matches (self, data->query, g_steal_pointer (&data->matches));
+
+  return res;
 }
 
 static void
@@ -312,14 +365,29 @@ completion_provider_refilter (GtkSourceCompletionProvider *provider,
                               GtkSourceCompletionContext  *context,
                               GListModel                  *model)
 {
-  SaturnClCompletionProvider *self  = SATURN_CL_COMPLETION_PROVIDER (provider);
-  const char                 *query = NULL;
-  g_autoptr (GListModel) res_model  = NULL;
+  SaturnClCompletionProvider *self = SATURN_CL_COMPLETION_PROVIDER (provider);
+  g_autofree char *word            = NULL;
+  g_autofree char *folded          = NULL;
+  GPtrArray       *candidates      = NULL;
+  GPtrArray       *matches         = NULL;
+  g_autoptr (GListModel) res_model = NULL;
+
+  if (self->model == NULL)
+    return;
+  word   = gtk_source_completion_context_get_word (context);
+  folded = g_utf8_casefold (word, -1);
 
-  query = gtk_source_completion_context_get_word (context);
-  if (self->latest_snapshot == NULL)
-    self->latest_snapshot = make_model_snapshot (self->model);
-  res_model = filter (query, self->latest_snapshot, NULL);
+  ensure_snapshot (self);
+
+  /* narrowing is only sound while the word keeps growing */
+  if (self->narrow_query != NULL &&
+      g_str_has_prefix (folded, self->narrow_query))
+    candidates = self->narrow_matches;
+  else
+    candidates = self->latest_snapshot;
+
+  res_model = filter (folded, candidates, &matches);
+  remember_matches (self, folded, matches);
 
   gtk_source_completion_context_set_proposals_for_provider (context, provider, res_model);
 }
@@ -507,9 +575,18 @@ saturn_cl_completion_provider_set_model (SaturnClCompletionProvider *self,
   if (model == self->model)
     return;
 
+  if (self->model != NULL)
+    g_signal_handlers_disconnect_by_func (self->model, model_changed, self);
   g_clear_pointer (&self->model, g_object_unref);
+  invalidate_snapshot (self);
+
   if (model != NULL)
-    self->model = g_object_ref (model);
+    {
+      self->model = g_object_ref (model);
+      g_signal_connect_swapped (
+          model, "items-changed",
+          G_CALLBACK (model_changed), self);
+    }
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_MODEL]);
 }
@@ -583,79 +660,192 @@ make_model_snapshot (GListModel *model)
   return g_steal_pointer (&parray);
 }
 
-static GListModel *
-filter (const char *query,
-        GPtrArray  *proposals,
-        GListStore *edit)
+static void
+ensure_snapshot (SaturnClCompletionProvider *self)
+{
+  if (self->latest_snapshot != NULL)
+    return;
+
+  self->latest_snapshot = make_model_snapshot (self->model);
+  self->leading_other   = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+  for (guint i = 0; i < self->latest_snapshot->len; i++)
+    {
+      SaturnClCompletionProposal *proposal   = NULL;
+      const char                 *string     = NULL;
+      gunichar                    leading_ch = 0;
+
+      proposal   = g_ptr_array_index (self->latest_snapshot, i);
+      string     = saturn_cl_completion_proposal_get_string (proposal);
+      leading_ch = g_utf8_get_char (string);
+
+      if (leading_ch < 128)
+        self->leading_ascii[leading_ch / 64] |= G_GUINT64_CONSTANT (1) << (leading_ch % 64);
+      else
+        g_hash_table_add (self->leading_other, GUINT_TO_POINTER (leading_ch));
+    }
+}
+
+static void
+invalidate_snapshot (SaturnClCompletionProvider *self)
+{
+  g_clear_pointer (&self->latest_snapshot, g_ptr_array_unref);
+  g_clear_pointer (&self->leading_other, g_hash_table_unref);
+  memset (self->leading_ascii, 0, sizeof (self->leading_ascii));
+
+  /* whatever was matched against the old snapshot can't be narrowed */
+  forget_matches (self);
+}
+
+static void
+model_changed (SaturnClCompletionProvider *self,
+               guint                       position,
+               guint                       removed,
+               guint                       added,
+               GListModel                 *model)
+{
+  invalidate_snapshot (self);
+}
+
+static void
+remember_matches (SaturnClCompletionProvider *self,
+                  const char                 *folded,
+                  GPtrArray                  *matches)
+{
+  forget_matches (self);
+  self->narrow_query   = g_strdup (folded);
+  self->narrow_matches = matches;
+}
+
+static void
+forget_matches (SaturnClCompletionProvider *self)
+{
+  g_clear_pointer (&self->narrow_query, g_free);
+  g_clear_pointer (&self->narrow_matches, g_ptr_array_unref);
+}
+
+static inline gboolean
+match_is_worse (const Match *a,
+                const Match *b)
+{
+  return cmp_match (a, b) > 0;
+}
+
+static void
+heap_sift_up (Match *heap,
+              guint  i)
+{
+  while (i > 0)
+    {
+      guint parent = (i - 1) / 2;
+      Match tmp    = { 0 };
+
+      if (!match_is_worse (&heap[i], &heap[parent]))
+        break;
+
+      tmp          = heap[i];
+      heap[i]      = heap[parent];
+      heap[parent] = tmp;
+      i            = parent;
+    }
+}
+
+static void
+heap_sift_down (Match *heap,
+                guint  n,
+                guint  i)
 {
-  g_autofree char *folded       = NULL;
-  g_autoptr (GHashTable) scores = NULL;
-  g_autoptr (GListStore) store  = NULL;
+  for (;;)
+    {
+      guint worst = i;
+      guint left  = 2 * i + 1;
+      guint right = left + 1;
+      Match tmp   = { 0 };
+
+      if (left < n && match_is_worse (&heap[left], &heap[worst]))
+        worst = left;
+      if (right < n && match_is_worse (&heap[right], &heap[worst]))
+        worst = right;
+      if (worst == i)
+        break;
+
+      tmp         = heap[i];
+      heap[i]     = heap[worst];
+      heap[worst] = tmp;
+      i           = worst;
+    }
+}
 
-  folded = g_utf8_casefold (query, -1);
-  scores = g_hash_table_new (g_direct_hash, g_direct_equal);
+static GListModel *
+filter (const char *folded,
+        GPtrArray  *candidates,
+        GPtrArray **matches_out)
+{
+  g_autoptr (GPtrArray) matches = NULL;
+  g_autoptr (GArray) heap       = NULL;
+  g_autofree gpointer *items    = NULL;
+  GListStore *store             = NULL;
 
-  if (edit == NULL)
-    store = g_list_store_new (GTK_SOURCE_TYPE_COMPLETION_PROPOSAL);
+  matches = g_ptr_array_new_with_free_func (g_object_unref);
+  /* the worst of the best MAX_PROPOSALS matches so far sits at the root,
+     so everything else is a single comparison away from being dropped */
+  heap = g_array_sized_new (FALSE, FALSE, sizeof (Match), MAX_PROPOSALS);
 
-  for (guint i = 0; i < proposals->len; i++)
+  for (guint i = 0; i < candidates->len; i++)
     {
       SaturnClCompletionProposal *proposal = NULL;
       const char                 *string   = NULL;
-      guint                       score    = 0;
-      gboolean                    match    = FALSE;
+      Match                       match    = { 0 };
 
-      proposal = g_ptr_array_index (proposals, i);
+      proposal = g_ptr_array_index (candidates, i);
       string   = saturn_cl_completion_proposal_get_string (proposal);
 
-      match = gtk_source_completion_fuzzy_match (string, folded, &score);
-      if (match)
+      if (!gtk_source_completion_fuzzy_match (string, folded, &match.score))
+        continue;
+      g_ptr_array_add (matches, g_object_ref (proposal));
+
+      match.proposal = proposal;
+      match.position = i;
+
+      if (heap->len < MAX_PROPOSALS)
+        {
+          g_array_append_val (heap, match);
+          heap_sift_up ((Match *) heap->data, heap->len - 1);
+        }
+      else if (match_is_worse (&g_array_index (heap, Match, 0), &match))
         {
-          g_hash_table_replace (scores, proposal, GUINT_TO_POINTER (score));
-          if (edit == NULL)
-            g_list_store_insert_sorted (store, proposal, (GCompareDataFunc) cmp_proposal, scores);
+          g_array_index (heap, Match, 0) = match;
+          heap_sift_down ((Match *) heap->data, heap->len, 0);
         }
     }
 
-  if (edit != NULL)
-    {
-      guint n_items = 0;
+  /* only the page we keep gets sorted */
+  g_array_sort (heap, (GCompareFunc) cmp_match);
 
-      for (guint i = 0; i < g_list_model_get_n_items (G_LIST_MODEL (edit));)
-        {
-          g_autoptr (SaturnClCompletionProposal) proposal = NULL;
+  items = g_new (gpointer, heap->len);
+  for (guint i = 0; i < heap->len; i++)
+    items[i] = g_array_index (heap, Match, i).proposal;
 
-          proposal = g_list_model_get_item (G_LIST_MODEL (edit), i);
-          if (g_hash_table_contains (scores, proposal))
-            i++;
-          else
-            g_list_store_remove (edit, i);
-        }
+  /* a single items-changed rather than one per proposal */
+  store = g_list_store_new (GTK_SOURCE_TYPE_COMPLETION_PROPOSAL);
+  g_list_store_splice (store, 0, 0, items, heap->len);
 
-      n_items = g_list_model_get_n_items (G_LIST_MODEL (edit));
-      if (n_items > 0)
-        g_list_store_sort (edit, (GCompareDataFunc) cmp_proposal, scores);
-      return G_LIST_MODEL (edit);
-    }
-  else
-    return (GListModel *) g_steal_pointer (&store);
+  if (matches_out != NULL)
+    *matches_out = g_steal_pointer (&matches);
+  return G_LIST_MODEL (store);
 }
 
 static gint
-cmp_proposal (SaturnClCompletionProposal *proposal_a,
-              SaturnClCompletionProposal *proposal_b,
-              GHashTable                 *scores)
+cmp_match (const Match *a,
+           const Match *b)
 {
-  guint score_a = 0;
-  guint score_b = 0;
-
-  score_a = GPOINTER_TO_UINT (g_hash_table_lookup (scores, proposal_a));
-  score_b = GPOINTER_TO_UINT (g_hash_table_lookup (scores, proposal_b));
-
-  if (score_b > score_a)
-    return -1;
+  /* lowest score first, the order matches were always listed in */
+  if (a->score != b->score)
+    return a->score < b->score ? -1 : 1;
+  else if (a->position != b->position)
+    return a->position < b->position ? -1 : 1;
   else
-    return 1;
+    return 0;
 }
 
 static void
@@ -664,9 +854,13 @@ populate_async_thread (GTask                      *task,
                        PopulateAsyncData          *data,
                        GCancellable               *cancellable)
 {
+  GListModel *res = NULL;
+
   if (g_task_return_error_if_cancelled (task))
     return;
-  g_task_return_pointer (task, filter (data->query, data->snapshot, NULL), g_object_unref);
+
+  res = filter (data->query, data->snapshot, &data->matches);
+  g_task_return_pointer (task, res, g_object_unref);
 }
 
 /* End of saturn-cl-completion-provider.c */
@@ -18,10 +18,13 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#define G_LOG_DOMAIN "SATURN::APPLICATION"
+
 #include "config.h"
 #include <glib/gi18n.h>
 
 #include "saturn-application.h"
+#include "saturn-frecency.h"
 #include "saturn-provider.h"
 #include "saturn-window.h"
 
@@ -31,10 +34,17 @@ struct _SaturnApplication
 {
   AdwApplication parent_instance;
 
-  gboolean initializing;
-  char    *selected_text;
+  gboolean        initializing;
+  gboolean        resident;
+  char           *selected_text;
+  SaturnProvider *selected_provider;
 
   GListStore *providers;
+
+  /* for timing how long an activation takes to show up */
+  gint64         activated_at;
+  GdkFrameClock *paint_clock;
+  gulong         after_paint;
 };
 
 G_DEFINE_FINAL_TYPE (SaturnApplication, saturn_application, ADW_TYPE_APPLICATION)
@@ -45,6 +55,7 @@ enum
 
   PROP_INITIALIZING,
   PROP_SELECTED_TEXT,
+  PROP_SELECTED_PROVIDER,
 
   LAST_PROP
 };
@@ -53,6 +64,36 @@ static GParamSpec *props[LAST_PROP] = { 0 };
 static void
 ensure_providers (SaturnApplication *self);
 
+static GtkWindow *
+ensure_window (SaturnApplication *self);
+
+static void
+become_resident (SaturnApplication *self);
+
+static void
+record_selection (SaturnApplication *self);
+
+static void
+after_paint_cb (SaturnApplication *self,
+                GdkFrameClock     *clock);
+
+static void
+window_visible_changed (SaturnApplication *self,
+                        GParamSpec        *pspec,
+                        GtkWindow         *window);
+
+static void
+saturn_application_dispose (GObject *object)
+{
+  SaturnApplication *self = SATURN_APPLICATION (object);
+
+  if (self->paint_clock != NULL)
+    g_clear_signal_handler (&self->after_paint, self->paint_clock);
+  g_clear_object (&self->paint_clock);
+
+  G_OBJECT_CLASS (saturn_application_parent_class)->dispose (object);
+}
+
 static void
 saturn_application_get_property (GObject    *object,
                                  guint       prop_id,
@@ -69,6 +110,9 @@ saturn_application_get_property (GObject    *object,
     case PROP_SELECTED_TEXT:
       g_value_set_string (value, self->selected_text);
       break;
+    case PROP_SELECTED_PROVIDER:
+      g_value_set_object (value, self->selected_provider);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
     }
@@ -93,6 +137,10 @@ saturn_application_set_property (GObject      *object,
       g_clear_pointer (&self->selected_text, g_free);
       self->selected_text = g_value_dup_string (value);
       break;
+    case PROP_SELECTED_PROVIDER:
+      g_clear_object (&self->selected_provider);
+      self->selected_provider = g_value_dup_object (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
     }
@@ -112,6 +160,32 @@ saturn_application_new (const char       *application_id,
                        NULL);
 }
 
+static int
+saturn_application_handle_local_options (GApplication *app,
+                                         GVariantDict *options)
+{
+  SaturnApplication *self = SATURN_APPLICATION (app);
+
+  if (g_variant_dict_contains (options, "resident"))
+    self->resident = TRUE;
+
+  return -1;
+}
+
+static void
+saturn_application_startup (GApplication *app)
+{
+  SaturnApplication *self = SATURN_APPLICATION (app);
+
+  G_APPLICATION_CLASS (saturn_application_parent_class)->startup (app);
+
+  /* only reached in the primary instance */
+  if (g_application_get_flags (app) & G_APPLICATION_IS_SERVICE)
+    self->resident = TRUE;
+  if (self->resident)
+    become_resident (self);
+}
+
 static void
 saturn_application_activate (GApplication *app)
 {
@@ -122,20 +196,23 @@ saturn_application_activate (GApplication *app)
 
   self = SATURN_APPLICATION (app);
 
-  window = gtk_application_get_active_window (GTK_APPLICATION (app));
-  if (window == NULL)
+  self->activated_at = g_get_monotonic_time ();
+  window             = ensure_window (self);
+  gtk_window_present (window);
+
+  if (self->paint_clock != NULL)
+    g_clear_signal_handler (&self->after_paint, self->paint_clock);
+  g_clear_object (&self->paint_clock);
+
+  self->paint_clock = gtk_widget_get_frame_clock (GTK_WIDGET (window));
+  if (self->paint_clock != NULL)
     {
-      window = g_object_new (SATURN_TYPE_WINDOW,
-                             "application", app,
-                             "providers", self->providers,
-                             NULL);
-      g_object_bind_property (
-          self, "initializing",
-          window, "initializing",
-          G_BINDING_SYNC_CREATE);
+      g_object_ref (self->paint_clock);
+      self->after_paint = g_signal_connect_object (
+          self->paint_clock, "after-paint",
+          G_CALLBACK (after_paint_cb),
+          self, G_CONNECT_SWAPPED);
     }
-
-  gtk_window_present (window);
 }
 
 static void
@@ -148,6 +225,8 @@ saturn_application_shutdown (GApplication *app)
 
   self = SATURN_APPLICATION (app);
 
+  record_selection (self);
+
   n_providers = g_list_model_get_n_items (G_LIST_MODEL (self->providers));
   for (guint i = 0; i < n_providers; i++)
     {
@@ -166,6 +245,7 @@ saturn_application_class_init (SaturnApplicationClass *klass)
   GObjectClass      *object_class = G_OBJECT_CLASS (klass);
   GApplicationClass *app_class    = G_APPLICATION_CLASS (klass);
 
+  object_class->dispose      = saturn_application_dispose;
   object_class->set_property = saturn_application_set_property;
   object_class->get_property = saturn_application_get_property;
 
@@ -181,10 +261,19 @@ saturn_application_class_init (SaturnApplicationClass *klass)
           NULL, NULL, NULL,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+  props[PROP_SELECTED_PROVIDER] =
+      g_param_spec_object (
+          "selected-provider",
+          NULL, NULL,
+          SATURN_TYPE_PROVIDER,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
-  app_class->activate = saturn_application_activate;
-  app_class->shutdown = saturn_application_shutdown;
+  app_class->handle_local_options = saturn_application_handle_local_options;
+  app_class->startup              = saturn_application_startup;
+  app_class->activate             = saturn_application_activate;
+  app_class->shutdown             = saturn_application_shutdown;
 }
 
 static void
@@ -233,6 +322,13 @@ saturn_application_init (SaturnApplication *self)
 {
   self->providers = g_list_store_new (SATURN_TYPE_PROVIDER);
 
+  g_application_add_main_option (
+      G_APPLICATION (self),
+      "resident", 0,
+      G_OPTION_FLAG_NONE, G_OPTION_ARG_NONE,
+      _ ("Keep running in the background after the window is closed"),
+      NULL);
+
   g_action_map_add_action_entries (
       G_ACTION_MAP (self),
       app_actions,
@@ -305,3 +401,106 @@ ensure_providers (SaturnApplication *self)
       saturn_provider_init_global (provider);
     }
 }
+
+/* Once resident, closing the window merely hides it and later invocations
+   activate us over D-Bus, with every provider and index still warm */
+static void
+become_resident (SaturnApplication *self)
+{
+  g_application_hold (G_APPLICATION (self));
+
+  /* build the window up front and give it a surface, without mapping it, so
+     the first activation only has to show it. Once lisp is up it also runs
+     the empty query and lays out its first rows while still hidden */
+  gtk_widget_realize (GTK_WIDGET (ensure_window (self)));
+}
+
+static GtkWindow *
+ensure_window (SaturnApplication *self)
+{
+  GtkWindow *window = NULL;
+
+  /* there is only ever the one window, and a resident process keeps it
+     around while hidden */
+  window = gtk_application_get_active_window (GTK_APPLICATION (self));
+  if (window != NULL)
+    return window;
+
+  window = g_object_new (SATURN_TYPE_WINDOW,
+                         "application", self,
+                         "providers", self->providers,
+                         NULL);
+  g_object_bind_property (
+      self, "initializing",
+      window, "initializing",
+      G_BINDING_SYNC_CREATE);
+
+  if (self->resident)
+    {
+      gtk_window_set_hide_on_close (window, TRUE);
+      g_signal_connect_object (
+          window, "notify::visible",
+          G_CALLBACK (window_visible_changed),
+          self, G_CONNECT_SWAPPED);
+    }
+
+  return window;
+}
+
+static void
+record_selection (SaturnApplication *self)
+{
+  g_autoptr (GError) local_error = NULL;
+  guint n_providers              = 0;
+
+  if (self->selected_provider == NULL ||
+      self->selected_text == NULL)
+    return;
+
+  n_providers = g_list_model_get_n_items (G_LIST_MODEL (self->providers));
+  for (guint i = 0; i < n_providers; i++)
+    {
+      g_autoptr (SaturnProvider) provider = NULL;
+
+      provider = g_list_model_get_item (G_LIST_MODEL (self->providers), i);
+      saturn_provider_record_selection (provider, self->selected_text);
+    }
+
+  if (!saturn_frecency_record (
+          saturn_frecency_get_default (),
+          saturn_provider_get_name (self->selected_provider),
+          self->selected_text,
+          &local_error))
+    g_warning ("Unable to record selection: %s", local_error->message);
+}
+
+static void
+window_visible_changed (SaturnApplication *self,
+                        GParamSpec        *pspec,
+                        GtkWindow         *window)
+{
+  if (gtk_widget_get_visible (GTK_WIDGET (window)))
+    return;
+
+  /* a resident process doesn't get to shut down after every selection, so
+     record it now and get the window ready for the next activation */
+  record_selection (self);
+  g_object_set (
+      self,
+      "selected-text", NULL,
+      "selected-provider", NULL,
+      NULL);
+
+  saturn_window_reset (SATURN_WINDOW (window));
+}
+
+static void
+after_paint_cb (SaturnApplication *self,
+                GdkFrameClock     *clock)
+{
+  g_debug ("Activation to first paint took %.2f ms",
+           (g_get_monotonic_time () - self->activated_at) / 1000.0);
+
+  g_clear_signal_handler (&self->after_paint, clock);
+  g_clear_object (&self->paint_clock);
+}
@@ -0,0 +1,208 @@
+/* saturn-binary-file.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#define G_LOG_DOMAIN "SATURN::BINARY-FILE"
+
+#include <glib/gstdio.h>
+#include <string.h>
+
+#include "saturn-binary-file.h"
+
+#define NULL_STRING G_MAXUINT32
+
+gboolean
+saturn_binary_reader_init (SaturnBinaryReader *reader,
+                           const char         *path,
+                           const char         *magic,
+                           GError            **error)
+{
+  gsize length = 0;
+
+  g_return_val_if_fail (reader != NULL, FALSE);
+  g_return_val_if_fail (path != NULL, FALSE);
+  g_return_val_if_fail (magic != NULL, FALSE);
+
+  *reader      = (SaturnBinaryReader) { 0 };
+  reader->path = g_strdup (path);
+
+  if (!g_file_get_contents (path, &reader->contents, &length, error))
+    return FALSE;
+
+  reader->p   = (const guint8 *) reader->contents;
+  reader->end = reader->p + length;
+
+  if (length < strlen (magic) ||
+      memcmp (reader->contents, magic, strlen (magic)) != 0)
+    return saturn_binary_reader_set_invalid (reader, error);
+  reader->p += strlen (magic);
+
+  return TRUE;
+}
+
+void
+saturn_binary_reader_clear (SaturnBinaryReader *reader)
+{
+  g_return_if_fail (reader != NULL);
+
+  g_clear_pointer (&reader->path, g_free);
+  g_clear_pointer (&reader->contents, g_free);
+  reader->p   = NULL;
+  reader->end = NULL;
+}
+
+static gboolean
+read_bytes (SaturnBinaryReader *reader,
+            gpointer            out,
+            gsize               size,
+            GError            **error)
+{
+  if ((gsize) (reader->end - reader->p) < size)
+    return saturn_binary_reader_set_invalid (reader, error);
+
+  memcpy (out, reader->p, size);
+  reader->p += size;
+  return TRUE;
+}
+
+gboolean
+saturn_binary_reader_read_u32 (SaturnBinaryReader *reader,
+                               guint32            *out,
+                               GError            **error)
+{
+  return read_bytes (reader, out, sizeof (*out), error);
+}
+
+gboolean
+saturn_binary_reader_read_i64 (SaturnBinaryReader *reader,
+                               gint64             *out,
+                               GError            **error)
+{
+  return read_bytes (reader, out, sizeof (*out), error);
+}
+
+gboolean
+saturn_binary_reader_read_string (SaturnBinaryReader *reader,
+                                  char              **out,
+                                  GError            **error)
+{
+  if (!saturn_binary_reader_read_nullable_string (reader, out, error))
+    return FALSE;
+  if (*out == NULL)
+    return saturn_binary_reader_set_invalid (reader, error);
+
+  return TRUE;
+}
+
+gboolean
+saturn_binary_reader_read_nullable_string (SaturnBinaryReader *reader,
+                                           char              **out,
+                                           GError            **error)
+{
+  guint32 length = 0;
+
+  if (!saturn_binary_reader_read_u32 (reader, &length, error))
+    return FALSE;
+  if (length == NULL_STRING)
+    {
+      *out = NULL;
+      return TRUE;
+    }
+  if ((gsize) (reader->end - reader->p) < length)
+    return saturn_binary_reader_set_invalid (reader, error);
+
+  *out = g_strndup ((const char *) reader->p, length);
+  reader->p += length;
+  return TRUE;
+}
+
+gboolean
+saturn_binary_reader_set_invalid (SaturnBinaryReader *reader,
+                                  GError            **error)
+{
+  g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+               "%s is malformed at offset %" G_GSIZE_FORMAT,
+               reader->path,
+               (gsize) (reader->p - (const guint8 *) reader->contents));
+  return FALSE;
+}
+
+GByteArray *
+saturn_binary_writer_new (const char *magic)
+{
+  GByteArray *out = NULL;
+
+  g_return_val_if_fail (magic != NULL, NULL);
+
+  out = g_byte_array_new ();
+  g_byte_array_append (out, (const guint8 *) magic, strlen (magic));
+  return out;
+}
+
+void
+saturn_binary_writer_add_u32 (GByteArray *out,
+                              guint32     value)
+{
+  g_byte_array_append (out, (const guint8 *) &value, sizeof (value));
+}
+
+void
+saturn_binary_writer_add_i64 (GByteArray *out,
+                              gint64      value)
+{
+  g_byte_array_append (out, (const guint8 *) &value, sizeof (value));
+}
+
+void
+saturn_binary_writer_add_string (GByteArray *out,
+                                 const char *string)
+{
+  gsize length = 0;
+
+  if (string == NULL)
+    {
+      saturn_binary_writer_add_u32 (out, NULL_STRING);
+      return;
+    }
+
+  length = strlen (string);
+  saturn_binary_writer_add_u32 (out, length);
+  g_byte_array_append (out, (const guint8 *) string, length);
+}
+
+gboolean
+saturn_binary_writer_save (GByteArray *out,
+                           const char *path,
+                           GError    **error)
+{
+  g_autofree char *dirname = NULL;
+
+  dirname = g_path_get_dirname (path);
+  g_mkdir_with_parents (dirname, 0755);
+
+  return g_file_set_contents_full (
+      path,
+      (const char *) out->data,
+      out->len,
+      G_FILE_SET_CONTENTS_CONSISTENT,
+      0644,
+      error);
+}
+
+/* End of saturn-binary-file.c */
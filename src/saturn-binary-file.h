@@ -0,0 +1,106 @@
+/* saturn-binary-file.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/* The small caches saturn keeps on disk are native endian files which start
+   with a magic string, followed by guint32 and gint64 values and strings,
+   where a string is a guint32 length followed by its bytes and G_MAXUINT32
+   stands for NULL. Any change to a layout needs a new magic. */
+
+typedef struct
+{
+  char         *path;
+  char         *contents;
+  const guint8 *p;
+  const guint8 *end;
+} SaturnBinaryReader;
+
+/* Reads all of `path` and checks it starts with `magic` */
+gboolean
+saturn_binary_reader_init (SaturnBinaryReader *reader,
+                           const char         *path,
+                           const char         *magic,
+                           GError            **error);
+
+void
+saturn_binary_reader_clear (SaturnBinaryReader *reader);
+
+G_DEFINE_AUTO_CLEANUP_CLEAR_FUNC (SaturnBinaryReader, saturn_binary_reader_clear);
+
+/* Each of these sets a G_IO_ERROR_INVALID_DATA error naming the file when
+   it runs past the end of it */
+gboolean
+saturn_binary_reader_read_u32 (SaturnBinaryReader *reader,
+                               guint32            *out,
+                               GError            **error);
+
+gboolean
+saturn_binary_reader_read_i64 (SaturnBinaryReader *reader,
+                               gint64             *out,
+                               GError            **error);
+
+/* Also fails on a NULL string */
+gboolean
+saturn_binary_reader_read_string (SaturnBinaryReader *reader,
+                                  char              **out,
+                                  GError            **error);
+
+gboolean
+saturn_binary_reader_read_nullable_string (SaturnBinaryReader *reader,
+                                           char              **out,
+                                           GError            **error);
+
+/* For contents that are well formed but make no sense, always returns
+   FALSE */
+gboolean
+saturn_binary_reader_set_invalid (SaturnBinaryReader *reader,
+                                  GError            **error);
+
+/* Returns a buffer holding just `magic` for the functions below */
+GByteArray *
+saturn_binary_writer_new (const char *magic);
+
+void
+saturn_binary_writer_add_u32 (GByteArray *out,
+                              guint32     value);
+
+void
+saturn_binary_writer_add_i64 (GByteArray *out,
+                              gint64      value);
+
+/* `string` may be NULL */
+void
+saturn_binary_writer_add_string (GByteArray *out,
+                                 const char *string);
+
+/* Creates the parent directories of `path` and atomically replaces it */
+gboolean
+saturn_binary_writer_save (GByteArray *out,
+                           const char *path,
+                           GError    **error);
+
+G_END_DECLS
+
+/* End of saturn-binary-file.h */
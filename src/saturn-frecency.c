@@ -0,0 +1,339 @@
+/* saturn-frecency.c
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* How often and how recently each item was picked, per provider. The table
+   is a saturn-binary-file.h file laid out as
+
+     magic
+     guint32 n_entries, then each entry's provider and key strings,
+     guint32 count and gint64 last used time in seconds
+
+   Only the MAX_ENTRIES most recently used entries are kept. The boost decays with
+   age in a few steps, the way browsers rank their history. */
+
+#define G_LOG_DOMAIN "SATURN::FRECENCY"
+
+#include "saturn-binary-file.h"
+#include "saturn-frecency.h"
+
+#define FRECENCY_MAGIC "SATFREC1"
+
+#define MAX_ENTRIES 1000
+/* a boost of a half is reached at this many recent picks */
+#define HALF_BOOST_POINTS 4.0
+
+typedef struct
+{
+  guint32 count;
+  gint64  last_used;
+} Entry;
+
+struct _SaturnFrecency
+{
+  GObject parent_instance;
+
+  char    *path;
+  gboolean loaded;
+
+  /* provider -> (key -> Entry) */
+  GHashTable *providers;
+  guint       n_entries;
+};
+
+G_DEFINE_FINAL_TYPE (SaturnFrecency, saturn_frecency, G_TYPE_OBJECT);
+
+static void
+ensure_loaded (SaturnFrecency *self);
+
+static Entry *
+lookup_entry (SaturnFrecency *self,
+              const char     *provider,
+              const char     *key,
+              gboolean        create);
+
+static void
+evict_oldest (SaturnFrecency *self);
+
+static gboolean
+read_table (SaturnFrecency *self,
+            GError        **error);
+
+static gboolean
+write_table (SaturnFrecency *self,
+             GError        **error);
+
+static void
+saturn_frecency_dispose (GObject *object)
+{
+  SaturnFrecency *self = SATURN_FRECENCY (object);
+
+  g_clear_pointer (&self->path, g_free);
+  g_clear_pointer (&self->providers, g_hash_table_unref);
+
+  G_OBJECT_CLASS (saturn_frecency_parent_class)->dispose (object);
+}
+
+static void
+saturn_frecency_class_init (SaturnFrecencyClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->dispose = saturn_frecency_dispose;
+}
+
+static void
+saturn_frecency_init (SaturnFrecency *self)
+{
+  self->providers = g_hash_table_new_full (
+      g_str_hash, g_str_equal,
+      g_free, (GDestroyNotify) g_hash_table_unref);
+}
+
+SaturnFrecency *
+saturn_frecency_get_default (void)
+{
+  static SaturnFrecency *frecency = NULL;
+
+  if (frecency == NULL)
+    {
+      const char *appid = NULL;
+
+      appid          = g_application_get_application_id (g_application_get_default ());
+      frecency       = g_object_new (SATURN_TYPE_FRECENCY, NULL);
+      frecency->path = g_build_filename (g_get_user_cache_dir (), appid, "frecency", NULL);
+    }
+
+  return frecency;
+}
+
+double
+saturn_frecency_get_boost (SaturnFrecency *self,
+                           const char     *provider,
+                           const char     *key)
+{
+  Entry *entry  = NULL;
+  gint64 age    = 0;
+  double weight = 0.0;
+  double points = 0.0;
+
+  g_return_val_if_fail (SATURN_IS_FRECENCY (self), 0.0);
+  g_return_val_if_fail (provider != NULL, 0.0);
+  g_return_val_if_fail (key != NULL, 0.0);
+
+  ensure_loaded (self);
+
+  entry = lookup_entry (self, provider, key, FALSE);
+  if (entry == NULL)
+    return 0.0;
+
+  age = (g_get_real_time () / G_USEC_PER_SEC - entry->last_used) / (60 * 60 * 24);
+  if (age < 4)
+    weight = 1.0;
+  else if (age < 14)
+    weight = 0.7;
+  else if (age < 31)
+    weight = 0.5;
+  else if (age < 90)
+    weight = 0.3;
+  else
+    weight = 0.1;
+
+  points = entry->count * weight;
+  return points / (points + HALF_BOOST_POINTS);
+}
+
+gboolean
+saturn_frecency_record (SaturnFrecency *self,
+                        const char     *provider,
+                        const char     *key,
+                        GError        **error)
+{
+  Entry *entry = NULL;
+
+  g_return_val_if_fail (SATURN_IS_FRECENCY (self), FALSE);
+  g_return_val_if_fail (provider != NULL, FALSE);
+  g_return_val_if_fail (key != NULL, FALSE);
+
+  ensure_loaded (self);
+
+  entry = lookup_entry (self, provider, key, TRUE);
+  entry->count++;
+  entry->last_used = g_get_real_time () / G_USEC_PER_SEC;
+
+  while (self->n_entries > MAX_ENTRIES)
+    evict_oldest (self);
+
+  return write_table (self, error);
+}
+
+static void
+ensure_loaded (SaturnFrecency *self)
+{
+  g_autoptr (GError) local_error = NULL;
+
+  if (self->loaded)
+    return;
+  self->loaded = TRUE;
+
+  if (!read_table (self, &local_error))
+    {
+      if (!g_error_matches (local_error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+        g_warning ("Unable to read frecency table: %s", local_error->message);
+
+      /* drop whatever was read before the error too */
+      g_hash_table_remove_all (self->providers);
+      self->n_entries = 0;
+    }
+}
+
+static Entry *
+lookup_entry (SaturnFrecency *self,
+              const char     *provider,
+              const char     *key,
+              gboolean        create)
+{
+  GHashTable *entries = NULL;
+  Entry      *entry   = NULL;
+
+  entries = g_hash_table_lookup (self->providers, provider);
+  if (entries == NULL)
+    {
+      if (!create)
+        return NULL;
+
+      entries = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+      g_hash_table_replace (self->providers, g_strdup (provider), entries);
+    }
+
+  entry = g_hash_table_lookup (entries, key);
+  if (entry == NULL && create)
+    {
+      entry = g_new0 (Entry, 1);
+      g_hash_table_replace (entries, g_strdup (key), entry);
+      self->n_entries++;
+    }
+
+  return entry;
+}
+
+static void
+evict_oldest (SaturnFrecency *self)
+{
+  GHashTableIter providers_iter = { 0 };
+  GHashTable    *entries        = NULL;
+  GHashTable    *oldest_entries = NULL;
+  const char    *oldest_key     = NULL;
+  gint64         oldest_time    = G_MAXINT64;
+
+  g_hash_table_iter_init (&providers_iter, self->providers);
+  while (g_hash_table_iter_next (&providers_iter, NULL, (gpointer *) &entries))
+    {
+      GHashTableIter entries_iter = { 0 };
+      const char    *key          = NULL;
+      Entry         *entry        = NULL;
+
+      g_hash_table_iter_init (&entries_iter, entries);
+      while (g_hash_table_iter_next (&entries_iter, (gpointer *) &key, (gpointer *) &entry))
+        {
+          if (entry->last_used < oldest_time)
+            {
+              oldest_entries = entries;
+              oldest_key     = key;
+              oldest_time    = entry->last_used;
+            }
+        }
+    }
+
+  if (oldest_entries != NULL)
+    {
+      g_hash_table_remove (oldest_entries, oldest_key);
+      self->n_entries--;
+    }
+}
+
+static gboolean
+read_table (SaturnFrecency *self,
+            GError        **error)
+{
+  g_auto (SaturnBinaryReader) reader = { 0 };
+  guint32 n_entries                  = 0;
+
+  if (!saturn_binary_reader_init (&reader, self->path, FRECENCY_MAGIC, error) ||
+      !saturn_binary_reader_read_u32 (&reader, &n_entries, error))
+    return FALSE;
+
+  for (guint32 i = 0; i < n_entries; i++)
+    {
+      g_autofree char *provider = NULL;
+      g_autofree char *key      = NULL;
+      guint32          count    = 0;
+      gint64           last     = 0;
+      Entry           *entry    = NULL;
+
+      if (!saturn_binary_reader_read_string (&reader, &provider, error) ||
+          !saturn_binary_reader_read_string (&reader, &key, error) ||
+          !saturn_binary_reader_read_u32 (&reader, &count, error) ||
+          !saturn_binary_reader_read_i64 (&reader, &last, error))
+        return FALSE;
+
+      entry            = lookup_entry (self, provider, key, TRUE);
+      entry->count     = count;
+      entry->last_used = last;
+    }
+
+  while (self->n_entries > MAX_ENTRIES)
+    evict_oldest (self);
+
+  return TRUE;
+}
+
+static gboolean
+write_table (SaturnFrecency *self,
+             GError        **error)
+{
+  g_autoptr (GByteArray) out      = NULL;
+  GHashTableIter   providers_iter = { 0 };
+  const char      *provider       = NULL;
+  GHashTable      *entries        = NULL;
+
+  out = saturn_binary_writer_new (FRECENCY_MAGIC);
+  saturn_binary_writer_add_u32 (out, self->n_entries);
+
+  g_hash_table_iter_init (&providers_iter, self->providers);
+  while (g_hash_table_iter_next (&providers_iter, (gpointer *) &provider, (gpointer *) &entries))
+    {
+      GHashTableIter entries_iter = { 0 };
+      const char    *key          = NULL;
+      Entry         *entry        = NULL;
+
+      g_hash_table_iter_init (&entries_iter, entries);
+      while (g_hash_table_iter_next (&entries_iter, (gpointer *) &key, (gpointer *) &entry))
+        {
+          saturn_binary_writer_add_string (out, provider);
+          saturn_binary_writer_add_string (out, key);
+          saturn_binary_writer_add_u32 (out, entry->count);
+          saturn_binary_writer_add_i64 (out, entry->last_used);
+        }
+    }
+
+  return saturn_binary_writer_save (out, self->path, error);
+}
+
+/* End of saturn-frecency.c */
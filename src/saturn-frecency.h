@@ -0,0 +1,52 @@
+/* saturn-frecency.h
+ *
+ * Copyright 2026 Eva M
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define SATURN_TYPE_FRECENCY (saturn_frecency_get_type ())
+G_DECLARE_FINAL_TYPE (SaturnFrecency, saturn_frecency, SATURN, FRECENCY, GObject)
+
+/* Persisted in the application's cache directory. Main thread only, like
+   everything else here */
+SaturnFrecency *
+saturn_frecency_get_default (void);
+
+/* Returns how much to scale up the score of an item of `provider` whose
+   selection would report `key`, between 0 for never picked and 1 for
+   picked often and recently. A single hash lookup once loaded */
+double
+saturn_frecency_get_boost (SaturnFrecency *self,
+                           const char     *provider,
+                           const char     *key);
+
+/* Counts a selection and writes the table out */
+gboolean
+saturn_frecency_record (SaturnFrecency *self,
+                        const char     *provider,
+                        const char     *key,
+                        GError        **error);
+
+G_END_DECLS
+
+/* End of saturn-frecency.h */
@@ -23,6 +23,7 @@
 /* clang-format off */
 G_DEFINE_QUARK (saturn-provider-quark, saturn_provider);
 G_DEFINE_QUARK (saturn-provider-score-quark, saturn_provider_score);
+G_DEFINE_QUARK (saturn-provider-key-quark, saturn_provider_key);
 /* clang-format on */
 
 G_DEFINE_ENUM_TYPE (
@@ -34,6 +35,12 @@ G_DEFINE_ENUM_TYPE (
 
 G_DEFINE_INTERFACE (SaturnProvider, saturn_provider, G_TYPE_OBJECT)
 
+static const char *
+saturn_provider_real_get_name (SaturnProvider *self)
+{
+  return G_OBJECT_TYPE_NAME (self);
+}
+
 static void
 saturn_provider_real_init_global (SaturnProvider *self)
 {
@@ -45,6 +52,12 @@ saturn_provider_real_deinit_global (SaturnProvider *self,
 {
 }
 
+static void
+saturn_provider_real_record_selection (SaturnProvider *self,
+                                       const char     *selected_text)
+{
+}
+
 static void
 saturn_provider_real_query (SaturnProvider            *self,
                             GObject                   *object,
@@ -127,8 +140,10 @@ saturn_provider_real_unbind_preview (SaturnProvider *self,
 static void
 saturn_provider_default_init (SaturnProviderInterface *iface)
 {
+  iface->get_name           = saturn_provider_real_get_name;
   iface->init_global        = saturn_provider_real_init_global;
   iface->deinit_global      = saturn_provider_real_deinit_global;
+  iface->record_selection   = saturn_provider_real_record_selection;
   iface->query              = saturn_provider_real_query;
   iface->score              = saturn_provider_real_score;
   iface->select             = saturn_provider_real_select;
@@ -142,6 +157,13 @@ saturn_provider_default_init (SaturnProviderInterface *iface)
   iface->unbind_preview     = saturn_provider_real_unbind_preview;
 }
 
+const char *
+saturn_provider_get_name (SaturnProvider *self)
+{
+  g_return_val_if_fail (SATURN_IS_PROVIDER (self), NULL);
+  return SATURN_PROVIDER_GET_IFACE (self)->get_name (self);
+}
+
 void
 saturn_provider_init_global (SaturnProvider *self)
 {
@@ -157,6 +179,16 @@ saturn_provider_deinit_global (SaturnProvider *self,
   return SATURN_PROVIDER_GET_IFACE (self)->deinit_global (self, selected_text);
 }
 
+void
+saturn_provider_record_selection (SaturnProvider *self,
+                                  const char     *selected_text)
+{
+  g_return_if_fail (SATURN_IS_PROVIDER (self));
+  g_return_if_fail (selected_text != NULL);
+
+  return SATURN_PROVIDER_GET_IFACE (self)->record_selection (self, selected_text);
+}
+
 void
 saturn_provider_query (SaturnProvider            *self,
                        GObject                   *object,
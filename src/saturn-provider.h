@@ -32,6 +32,11 @@ GQuark saturn_provider_quark (void);
 #define SATURN_PROVIDER_SCORE_QUARK (saturn_provider_score_quark ())
 GQuark saturn_provider_score_quark (void);
 
+/* the text selecting an item would report, as a string. Providers may set
+   this on their results so that frequently picked ones rank higher */
+#define SATURN_PROVIDER_KEY_QUARK (saturn_provider_key_quark ())
+GQuark saturn_provider_key_quark (void);
+
 #define SATURN_PROVIDER_MAX_SCORE_DOUBLE 100000.0
 
 typedef enum
@@ -50,9 +55,16 @@ struct _SaturnProviderInterface
 {
   GTypeInterface parent_iface;
 
+  /* should stay the same across runs */
+  const char *(*get_name) (SaturnProvider *self);
+
   void (*init_global) (SaturnProvider *self);
   void (*deinit_global) (SaturnProvider *self,
                          const char     *selected_text);
+  /* called for every final selection, which may happen many times over the
+     life of a resident process */
+  void (*record_selection) (SaturnProvider *self,
+                            const char     *selected_text);
 
   void (*query) (SaturnProvider            *self,
                  GObject                   *object,
@@ -96,6 +108,9 @@ struct _SaturnProviderInterface
                           AdwBin         *preview);
 };
 
+const char *
+saturn_provider_get_name (SaturnProvider *self);
+
 void
 saturn_provider_init_global (SaturnProvider *self);
 
@@ -103,6 +118,10 @@ void
 saturn_provider_deinit_global (SaturnProvider *self,
                                const char     *selected_text);
 
+void
+saturn_provider_record_selection (SaturnProvider *self,
+                                  const char     *selected_text);
+
 void
 saturn_provider_query (SaturnProvider            *self,
                        GObject                   *object,
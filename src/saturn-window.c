@@ -21,6 +21,7 @@
 #include "config.h"
 #include <glib/gi18n.h>
 
+#include "saturn-frecency.h"
 #include "saturn-provider.h"
 #include "saturn-threadsafe-list-store.h"
 #include "saturn-window.h"
@@ -32,6 +33,9 @@ start_query (SaturnWindow *self,
 static void
 try_string_query (SaturnWindow *self);
 
+static void
+allocate_hidden (SaturnWindow *self);
+
 struct _SaturnWindow
 {
   AdwApplicationWindow parent_instance;
@@ -42,6 +46,7 @@ struct _SaturnWindow
   SaturnThreadsafeListStore *model;
 
   guint debounce;
+  guint allocate_hidden;
   /* if less than 0, explicit selection is active */
   int      explicit_selection;
   gpointer selected_item;
@@ -72,6 +77,10 @@ cmp_item (GObject *a,
           GObject *b,
           GObject *query);
 
+static gsize
+get_score (GObject *item,
+           GObject *query);
+
 static void
 saturn_window_dispose (GObject *object)
 {
@@ -80,6 +89,7 @@ saturn_window_dispose (GObject *object)
   g_clear_object (&self->selected_item);
   g_clear_object (&self->model);
   g_clear_handle_id (&self->debounce, g_source_remove);
+  g_clear_handle_id (&self->allocate_hidden, g_source_remove);
 
   g_clear_object (&self->providers);
 
@@ -215,6 +225,15 @@ selection_changed_cb (SaturnWindow *self,
 
   g_snprintf (buf, sizeof (buf), "%u", n_items);
   gtk_label_set_label (self->status_label, buf);
+
+  /* a resident window is realized ahead of time and runs the empty query
+     while hidden, so build the rows it will open with right away */
+  if (self->allocate_hidden == 0 &&
+      gtk_widget_get_realized (GTK_WIDGET (self)) &&
+      !gtk_widget_get_mapped (GTK_WIDGET (self)))
+    self->allocate_hidden = g_idle_add_once (
+        (GSourceOnceFunc) allocate_hidden,
+        self);
 }
 
 static void
@@ -346,6 +365,7 @@ action_select_candidate (GtkWidget  *widget,
       g_object_set (
           g_application_get_default (),
           "selected-text", selected_text,
+          "selected-provider", provider,
           NULL);
       gtk_window_close (GTK_WINDOW (self));
       break;
@@ -466,6 +486,24 @@ saturn_window_get_providers (SaturnWindow *self)
   return self->providers;
 }
 
+void
+saturn_window_reset (SaturnWindow *self)
+{
+  g_return_if_fail (SATURN_IS_WINDOW (self));
+
+  g_clear_object (&self->selected_item);
+  g_clear_handle_id (&self->debounce, g_source_remove);
+  adw_bin_set_child (self->preview_bin, NULL);
+
+  /* back to the state of a freshly opened window, running the empty query
+     again even if the entry is already clear */
+  if (*gtk_editable_get_text (self->entry) != '\0')
+    gtk_editable_set_text (self->entry, "");
+  else
+    try_string_query (self);
+  gtk_widget_grab_focus (GTK_WIDGET (self->entry));
+}
+
 static void
 start_query (SaturnWindow *self,
              gpointer      search_object)
@@ -508,6 +546,35 @@ try_string_query (SaturnWindow *self)
   start_query (self, string);
 }
 
+/* The list view only creates and binds rows when it is allocated, which
+   GTK otherwise doesn't do before the window is mapped. Laying the hidden
+   window out at its default size builds the first screen of rows, which
+   the real allocation reuses as long as the size and model are unchanged */
+static void
+allocate_hidden (SaturnWindow *self)
+{
+  GtkWidget *widget     = GTK_WIDGET (self);
+  int        width      = 0;
+  int        height     = 0;
+  int        min_width  = 0;
+  int        min_height = 0;
+
+  self->allocate_hidden = 0;
+  if (!gtk_widget_get_realized (widget) ||
+      gtk_widget_get_mapped (widget))
+    return;
+
+  gtk_window_get_default_size (GTK_WINDOW (self), &width, &height);
+  gtk_widget_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
+                      &min_width, NULL, NULL, NULL);
+  width = MAX (width, min_width);
+  gtk_widget_measure (widget, GTK_ORIENTATION_VERTICAL, width,
+                      &min_height, NULL, NULL, NULL);
+  height = MAX (height, min_height);
+
+  gtk_widget_allocate (widget, width, height, -1, NULL);
+}
+
 static gint
 cmp_item (GObject *a,
           GObject *b,
@@ -516,25 +583,38 @@ cmp_item (GObject *a,
   gsize a_score = 0;
   gsize b_score = 0;
 
-  a_score = GPOINTER_TO_SIZE (g_object_get_qdata (a, SATURN_PROVIDER_SCORE_QUARK));
-  b_score = GPOINTER_TO_SIZE (g_object_get_qdata (b, SATURN_PROVIDER_SCORE_QUARK));
-
   /* TODO: if same provider, have a special cmp impl func? */
 
-  if (a_score == 0)
-    {
-      SaturnProvider *provider = NULL;
+  a_score = get_score (a, query);
+  b_score = get_score (b, query);
 
-      provider = g_object_get_qdata (a, SATURN_PROVIDER_QUARK);
-      a_score  = saturn_provider_score (provider, a, query);
-    }
-  if (b_score == 0)
-    {
-      SaturnProvider *provider = NULL;
+  return a_score > b_score ? -1 : 1;
+}
 
-      provider = g_object_get_qdata (b, SATURN_PROVIDER_QUARK);
-      b_score  = saturn_provider_score (provider, b, query);
-    }
+static gsize
+get_score (GObject *item,
+           GObject *query)
+{
+  gsize           score    = 0;
+  SaturnProvider *provider = NULL;
+  const char     *key      = NULL;
 
-  return a_score > b_score ? -1 : 1;
+  score = GPOINTER_TO_SIZE (g_object_get_qdata (item, SATURN_PROVIDER_SCORE_QUARK));
+  if (score != 0)
+    return score;
+
+  provider = g_object_get_qdata (item, SATURN_PROVIDER_QUARK);
+  score    = saturn_provider_score (provider, item, query);
+
+  /* items picked often and recently get up to twice their score, stored
+     along with it so this only happens once per item */
+  key = g_object_get_qdata (item, SATURN_PROVIDER_KEY_QUARK);
+  if (key != NULL)
+    score += (gsize) (score * saturn_frecency_get_boost (
+                                  saturn_frecency_get_default (),
+                                  saturn_provider_get_name (provider),
+                                  key));
+
+  g_object_set_qdata (item, SATURN_PROVIDER_SCORE_QUARK, GSIZE_TO_POINTER (score));
+  return score;
 }
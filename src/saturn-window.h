@@ -35,4 +35,7 @@ saturn_window_set_providers (SaturnWindow *self,
 GListModel *
 saturn_window_get_providers (SaturnWindow *self);
 
+void
+saturn_window_reset (SaturnWindow *self);
+
 G_END_DECLS